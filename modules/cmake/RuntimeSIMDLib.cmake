@@ -12,6 +12,29 @@ function(make_lib_simd_runtime name file)
         target_compile_options(${name}_avx PRIVATE -mavx -mfma -Wno-unused-command-line-argument)
     endif()
 
+    add_library(${name}_avx2 STATIC)
+    target_sources(${name}_avx2 PRIVATE ${file})
+    target_compile_definitions(${name}_avx2 PRIVATE BYOD_COMPILING_WITH_AVX2=1)
+    if(WIN32)
+        target_compile_options(${name}_avx2 PRIVATE /arch:AVX2)
+    else()
+        target_compile_options(${name}_avx2 PRIVATE -mavx2 -mfma -Wno-unused-command-line-argument)
+    endif()
+
+    set(simd_libs ${name}_sse_or_arm ${name}_avx ${name}_avx2)
+
+    if(BYOD_BUILD_AVX512)
+        add_library(${name}_avx512 STATIC)
+        target_sources(${name}_avx512 PRIVATE ${file})
+        target_compile_definitions(${name}_avx512 PRIVATE BYOD_COMPILING_WITH_AVX512=1)
+        if(WIN32)
+            target_compile_options(${name}_avx512 PRIVATE /arch:AVX512)
+        else()
+            target_compile_options(${name}_avx512 PRIVATE -mavx512f -mavx512dq -mavx512vl -mavx512bw -mfma -Wno-unused-command-line-argument)
+        endif()
+        list(APPEND simd_libs ${name}_avx512)
+    endif()
+
     add_library(${name} INTERFACE)
-    target_link_libraries(${name} INTERFACE ${name}_sse_or_arm ${name}_avx)
+    target_link_libraries(${name} INTERFACE ${simd_libs})
 endfunction()
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""
+Converts neural network weights from JSON into the binary format read by
+ModelWeights (see src/processors/drive/neural_utils/ModelWeights.h), so that
+the plugin doesn't need to parse the JSON when loading a model.
+
+The converted built-in models are checked in next to their JSON files, so
+this script needs to be re-run whenever one of those models changes (the
+ModelWeights unit test checks that they are up to date).
+
+Usage: convert_model_weights.py <input.json> <output.bin>
+"""
+
+import json
+import struct
+import sys
+
+MAGIC_NUMBER = 0x574E5942  # "BYNW"
+FORMAT_VERSION = 1
+TENSOR_ALIGNMENT = 16
+
+
+def is_number(x):
+    return isinstance(x, (int, float)) and not isinstance(x, bool)
+
+
+def get_tensor_shape(x):
+    """Returns the shape if x is a non-empty, rectangular, array of numbers, otherwise None"""
+    if not isinstance(x, list) or len(x) == 0:
+        return None
+
+    if is_number(x[0]):
+        return [len(x)] if all(is_number(el) for el in x) else None
+
+    inner_shape = get_tensor_shape(x[0])
+    if inner_shape is None:
+        return None
+
+    for el in x:
+        if get_tensor_shape(el) != inner_shape:
+            return None
+
+    return [len(x)] + inner_shape
+
+
+def flatten(x):
+    if is_number(x):
+        return [float(x)]
+    return [v for el in x for v in flatten(el)]
+
+
+def escape_pointer_token(token):
+    return token.replace('~', '~0').replace('/', '~1')
+
+
+def find_tensors(x, path, tensors):
+    """Moves the tensors out of the JSON (leaving null in their place), keyed by their JSON pointer"""
+    if isinstance(x, dict):
+        for key in x:
+            child_path = path + '/' + escape_pointer_token(key)
+            shape = get_tensor_shape(x[key])
+            if shape is not None:
+                tensors[child_path] = (shape, flatten(x[key]))
+                x[key] = None
+            else:
+                find_tensors(x[key], child_path, tensors)
+    elif isinstance(x, list):
+        for idx, el in enumerate(x):
+            child_path = path + '/' + str(idx)
+            shape = get_tensor_shape(el)
+            if shape is not None:
+                tensors[child_path] = (shape, flatten(el))
+                x[idx] = None
+            else:
+                find_tensors(el, child_path, tensors)
+
+
+def align(size):
+    return (size + TENSOR_ALIGNMENT - 1) & ~(TENSOR_ALIGNMENT - 1)
+
+
+def convert(model_json):
+    tensors = {}
+    find_tensors(model_json, '', tensors)
+    tensor_names = sorted(tensors.keys())
+
+    # formatted in the same way as nlohmann::json::dump(), so that the output matches ModelWeights::toBinary()
+    metadata = json.dumps(model_json, separators=(',', ':'), sort_keys=True, ensure_ascii=False).encode('utf-8')
+    header = struct.pack('<4I', MAGIC_NUMBER, FORMAT_VERSION, len(tensor_names), len(metadata))
+
+    table_size = sum(12 + len(name.encode('utf-8')) + 4 * len(tensors[name][0]) for name in tensor_names)
+    data_offset = align(len(header) + len(metadata) + table_size)
+
+    table = b''
+    data_offsets = []
+    for name in tensor_names:
+        shape, values = tensors[name]
+        encoded_name = name.encode('utf-8')
+        table += struct.pack('<I', len(encoded_name)) + encoded_name
+        table += struct.pack('<I', len(shape)) + struct.pack(f'<{len(shape)}I', *shape)
+        table += struct.pack('<I', data_offset)
+        data_offsets.append(data_offset)
+        data_offset = align(data_offset + 4 * len(values))
+
+    out = bytearray(header + metadata + table)
+    out.extend(b'\0' * (data_offset - len(out)))
+    for name, offset in zip(tensor_names, data_offsets):
+        values = tensors[name][1]
+        out[offset:offset + 4 * len(values)] = struct.pack(f'<{len(values)}f', *values)
+
+    return bytes(out)
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__)
+        sys.exit(1)
+
+    with open(sys.argv[1], 'r') as json_file:
+        model_json = json.load(json_file)
+
+    with open(sys.argv[2], 'wb') as bin_file:
+        bin_file.write(convert(model_json))
+
+
+if __name__ == '__main__':
+    main()
@@ -115,12 +115,13 @@ AudioProcessorEditor* BYOD::createEditor()
 
 void BYOD::getStateInformation (MemoryBlock& destData)
 {
-    copyXmlToBinary (*stateManager->saveState(), destData);
+    stateManager->saveBinaryState (destData);
 }
 
 void BYOD::setStateInformation (const void* data, int sizeInBytes)
 {
-    stateManager->loadState (getXmlFromBinary (data, sizeInBytes).get());
+    if (! stateManager->loadBinaryState (data, sizeInBytes))
+        stateManager->loadState (getXmlFromBinary (data, sizeInBytes).get()); // states saved before the binary format
 
     if (wrapperType == WrapperType::wrapperType_AudioUnitv3)
     {
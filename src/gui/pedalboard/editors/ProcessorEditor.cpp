@@ -75,6 +75,13 @@ ProcessorEditor::ProcessorEditor (BaseProcessor& baseProc,
     for (int i = 0; i < proc.getNumInputs(); ++i)
         toggleParamsEnabledOnInputConnectionChange (i, false);
 
+    cpuBadge.setJustificationType (Justification::centred);
+    cpuBadge.setColour (Label::backgroundColourId, Colours::black.withAlpha (0.6f));
+    cpuBadge.setColour (Label::textColourId, Colours::white);
+    addChildComponent (cpuBadge);
+    pluginSettings->addProperties<&ProcessorEditor::globalSettingChanged> ({ { cpuBadgesSettingID, false } }, *this);
+    globalSettingChanged (cpuBadgesSettingID);
+
     uiOptionsChangedCallback = proc.uiOptionsChanged.connect (
         [this]
         {
@@ -86,7 +93,45 @@ ProcessorEditor::ProcessorEditor (BaseProcessor& baseProc,
     baseProc.setEditor (this);
 }
 
-ProcessorEditor::~ProcessorEditor() = default;
+ProcessorEditor::~ProcessorEditor()
+{
+    pluginSettings->removePropertyListener (*this);
+}
+
+void ProcessorEditor::globalSettingChanged (SettingID settingID)
+{
+    if (settingID != cpuBadgesSettingID)
+        return;
+
+    const auto shouldShowBadge = pluginSettings->getProperty<bool> (cpuBadgesSettingID);
+    cpuBadge.setVisible (shouldShowBadge);
+    if (shouldShowBadge)
+    {
+        timerCallback();
+        startTimerHz (4);
+    }
+    else
+    {
+        stopTimer();
+    }
+
+    repaint();
+}
+
+void ProcessorEditor::timerCallback()
+{
+    const auto stats = proc.getCPUMeter().getStats();
+    const auto toPercentString = [] (float load)
+    { return String (load * 100.0f, 1) + "%"; };
+
+    // the badge shows the average load, and turns red as the worst-case blocks get close to the deadline
+    cpuBadge.setText (toPercentString (stats.averageLoad), dontSendNotification);
+    cpuBadge.setColour (Label::textColourId, Colours::white.interpolatedWith (Colours::red, jlimit (0.0f, 1.0f, stats.percentile99Load)));
+    cpuBadge.setTooltip ("CPU usage (proportion of the real-time budget)\n"
+                         "Average: " + toPercentString (stats.averageLoad) + "\n"
+                         "99th Percentile: " + toPercentString (stats.percentile99Load) + "\n"
+                         "Worst: " + toPercentString (stats.worstLoad));
+}
 
 void ProcessorEditor::addToBoard (BoardComponent* boardComp)
 {
@@ -183,7 +228,8 @@ void ProcessorEditor::paint (Graphics& g)
 
     g.setColour (contrastColour);
     g.setFont (Font ((float) fontHeight).boldened());
-    g.drawFittedText (proc.getName(), 5, 0, jmax (getWidth() - 50, 100), nameHeight, Justification::centredLeft, 1);
+    const auto nameWidth = cpuBadge.isVisible() ? cpuBadge.getX() - 10 : jmax (getWidth() - 50, 100);
+    g.drawFittedText (proc.getName(), 5, 0, nameWidth, nameHeight, Justification::centredLeft, 1);
 }
 
 void ProcessorEditor::resized()
@@ -197,15 +243,20 @@ void ProcessorEditor::resized()
     auto nameHeight = proportionOfHeight (0.167f);
     knobs.setBounds (knobsPad, nameHeight, width - 2 * knobsPad, height - (nameHeight + knobsPad));
 
+    const auto xButtonSize = proportionOfWidth (0.1f);
     bool isIOProcessor = typeid (proc) == typeid (InputProcessor) || typeid (proc) == typeid (OutputProcessor);
     if (! isIOProcessor)
     {
-        const auto xButtonSize = proportionOfWidth (0.1f);
         settingsButton.setBounds (Rectangle { width - 3 * xButtonSize, 0, xButtonSize, xButtonSize }.reduced (proportionOfWidth (0.01f)));
         powerButton.setBounds (width - 2 * xButtonSize, 0, xButtonSize, xButtonSize);
         xButton.setBounds (Rectangle { width - xButtonSize, 0, xButtonSize, xButtonSize }.reduced (proportionOfWidth (0.015f)));
     }
 
+    const auto badgeWidth = proportionOfWidth (0.16f);
+    const auto badgeRight = isIOProcessor ? width : width - 3 * xButtonSize;
+    cpuBadge.setFont (Font ((float) nameHeight * 0.5f));
+    cpuBadge.setBounds (Rectangle { badgeRight - badgeWidth, 0, badgeWidth, nameHeight }.reduced (2, nameHeight / 6));
+
     const int portDim = proportionOfHeight (0.17f);
     auto placePorts = [=] (int x, auto& ports)
     {
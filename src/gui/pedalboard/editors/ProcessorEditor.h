@@ -5,9 +5,12 @@
 #include "PowerButton.h"
 #include "processors/chain/ProcessorChain.h"
 
-class ProcessorEditor : public Component
+class ProcessorEditor : public Component,
+                        private Timer
 {
 public:
+    using SettingID = chowdsp::GlobalPluginSettings::SettingID;
+
     ProcessorEditor (BaseProcessor& baseProc, ProcessorChain& procs, chowdsp::HostContextProvider& hostContextProvider);
     ~ProcessorEditor() override;
 
@@ -29,7 +32,11 @@ public:
     Colour getColour() const noexcept { return procUI.backgroundColour; }
     void toggleParamsEnabledOnInputConnectionChange (int inputPortIndex, bool isConnected);
 
+    void globalSettingChanged (SettingID settingID);
+    static constexpr SettingID cpuBadgesSettingID = "module_cpu_badges";
+
 private:
+    void timerCallback() override;
     void processorSettingsCallback (PopupMenu& menu, PopupMenu::Options& options);
     Port* getPortPrivate (int portIndex, bool isInput) const;
 
@@ -58,6 +65,9 @@ private:
 
     DrawableButton settingsButton { "Settings", DrawableButton::ImageFitted };
 
+    Label cpuBadge;
+    chowdsp::SharedPluginSettings pluginSettings;
+
     chowdsp::ScopedCallback uiOptionsChangedCallback;
 
     chowdsp::SharedLNFAllocator lnfAllocator;
@@ -1,7 +1,9 @@
 #include "SettingsButton.h"
 #include "BYOD.h"
 #include "gui/pedalboard/BoardViewport.h"
+#include "gui/pedalboard/editors/ProcessorEditor.h"
 #include "processors/chain/ProcessorChainPortMagnitudesHelper.h"
+#include "processors/chain/ProcessorChainWorkerPool.h"
 #include "state/ParamForwardManager.h"
 
 namespace
@@ -63,6 +65,8 @@ void SettingsButton::showSettingsMenu()
 
     defaultZoomMenu (menu, 400);
     addPluginSettingMenuOption ("Show Port Tooltips", BoardViewport::portTooltipsSettingID, menu, 500);
+    addPluginSettingMenuOption ("Multi-Core Processing", ProcessorChainWorkerPool::multiCoreProcessingID, menu, 600);
+    addPluginSettingMenuOption ("Module CPU Meters", ProcessorEditor::cpuBadgesSettingID, menu, 700);
 
     menu.addSeparator();
     menu.addItem ("User Manual", []
@@ -0,0 +1,107 @@
+#include "PresetProfiler.h"
+#include "BYOD.h"
+
+PresetProfiler::PresetProfiler()
+{
+    this->commandOption = "--profile-preset";
+    this->argumentDescription = "--profile-preset --preset=[PRESET FILE|FACTORY PRESET NAME] --sample-rate=[48000] --block-size=[512] --seconds=[10]";
+    this->shortDescription = "Measures the CPU usage of each module in a preset";
+    this->longDescription = "";
+    this->command = [=] (const ArgumentList& args)
+    { profilePreset (args); };
+}
+
+namespace
+{
+template <typename T>
+T getNumericOption (const ArgumentList& args, StringRef option, T defaultValue)
+{
+    if (! args.containsOption (option))
+        return defaultValue;
+
+    return (T) args.getValueForOption (option).getDoubleValue();
+}
+
+void loadPresetForProfiling (BYOD& plugin, const String& presetName)
+{
+    const auto presetFile = File::getCurrentWorkingDirectory().getChildFile (presetName);
+    if (presetFile.existsAsFile())
+    {
+        plugin.getPresetManager().loadPreset (chowdsp::Preset { presetFile });
+        return;
+    }
+
+    for (int i = 0; i < plugin.getNumPrograms(); ++i)
+    {
+        if (plugin.getProgramName (i) == presetName)
+        {
+            plugin.setCurrentProgram (i);
+            return;
+        }
+    }
+
+    ConsoleApplication::fail ("Unable to find preset: " + presetName);
+}
+} // namespace
+
+void PresetProfiler::profilePreset (const ArgumentList& args)
+{
+    if (! args.containsOption ("--preset"))
+        ConsoleApplication::fail ("Please specify a preset to profile with --preset=[PRESET]");
+
+    const auto sampleRate = getNumericOption (args, "--sample-rate", 48000.0);
+    const auto blockSize = getNumericOption (args, "--block-size", 512);
+    const auto numSeconds = getNumericOption (args, "--seconds", 10.0);
+    if (sampleRate <= 0.0 || blockSize <= 0 || numSeconds <= 0.0)
+        ConsoleApplication::fail ("Sample rate, block size, and duration must all be positive!");
+
+    BYOD plugin;
+    plugin.prepareToPlay (sampleRate, blockSize);
+    loadPresetForProfiling (plugin, args.getValueForOption ("--preset"));
+    MessageManager::getInstance()->runDispatchLoopUntil (50); // pump dispatch loop so the preset changes propagate...
+
+    const auto* currentPreset = plugin.getPresetManager().getCurrentPreset();
+    std::cout << "Profiling preset: " << (currentPreset != nullptr ? currentPreset->getName() : String ("Unknown"))
+              << " (" << sampleRate << " Hz, " << blockSize << " samples)" << std::endl;
+
+    AudioBuffer<float> buffer (2, blockSize);
+    MidiBuffer midi;
+    Random rand;
+    const auto numBlocks = (int) std::ceil (numSeconds * sampleRate / (double) blockSize);
+    for (int i = 0; i < numBlocks; ++i)
+    {
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            for (int n = 0; n < blockSize; ++n)
+                buffer.setSample (ch, n, (rand.nextFloat() * 2.0f - 1.0f) * 0.5f);
+
+        plugin.processBlock (buffer, midi);
+    }
+
+    struct ModuleStats
+    {
+        String name;
+        ProcessorCPUMeter::Stats stats;
+    };
+
+    auto& procChain = plugin.getProcChain();
+    std::vector<ModuleStats> moduleStats;
+    moduleStats.push_back ({ procChain.getInputProcessor().getName(), procChain.getInputProcessor().getCPUMeter().getStats() });
+    for (auto* proc : procChain.getProcessors())
+        moduleStats.push_back ({ proc->getName(), proc->getCPUMeter().getStats() });
+    moduleStats.push_back ({ procChain.getOutputProcessor().getName(), procChain.getOutputProcessor().getCPUMeter().getStats() });
+
+    std::sort (moduleStats.begin(), moduleStats.end(), [] (const auto& a, const auto& b)
+               { return a.stats.percentile99Load > b.stats.percentile99Load; });
+
+    const auto toPercentString = [] (float load)
+    { return (String (load * 100.0f, 2) + "%").paddedLeft (' ', 10); };
+
+    std::cout << String ("Module").paddedRight (' ', 24) << "   Average" << "       99%" << "     Worst" << std::endl;
+    for (const auto& [name, stats] : moduleStats)
+    {
+        std::cout << name.paddedRight (' ', 24)
+                  << toPercentString (stats.averageLoad)
+                  << toPercentString (stats.percentile99Load)
+                  << toPercentString (stats.worstLoad) << std::endl;
+    }
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "../pch.h"
+
+class PresetProfiler : public ConsoleApplication::Command
+{
+public:
+    PresetProfiler();
+
+private:
+    static void profilePreset (const ArgumentList& args);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PresetProfiler)
+};
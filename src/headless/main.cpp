@@ -1,4 +1,5 @@
 #include "GuitarMLFilterDesigner.h"
+#include "PresetProfiler.h"
 #include "PresetResaver.h"
 #include "PresetSaveLoadTime.h"
 #include "ScreenshotGenerator.h"
@@ -30,6 +31,7 @@ int main (int argc, char* argv[])
     app.addCommand (ScreenshotGenerator());
     app.addCommand (PresetResaver());
     app.addCommand (PresetSaveLoadTime());
+    app.addCommand (PresetProfiler());
     app.addCommand (GuitarMLFilterDesigner());
     app.addCommand (UnitTests());
 
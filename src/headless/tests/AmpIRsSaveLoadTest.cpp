@@ -30,10 +30,8 @@ public:
         }
     }
 
-    void runTest() override
+    void saveLoadTest (bool referenceAssets)
     {
-        beginTest ("Save/Load Test");
-
         const auto testIRFile = []
         {
             auto rootDir = File::getSpecialLocation (File::currentExecutableFile);
@@ -43,6 +41,7 @@ public:
         }();
 
         std::unique_ptr<XmlElement> state;
+        std::vector<StateAssets::Asset> assets;
         AudioBuffer<float> refSignal { 1, (int) sampleRate };
 
         {
@@ -51,7 +50,18 @@ public:
             irs.prepare (sampleRate, bufferSize);
             MessageManager::getInstance()->runDispatchLoopUntil (50);
             process (refSignal, irs);
-            state = irs.toXML();
+
+            if (referenceAssets)
+            {
+                StateAssets::ScopedAssetCollector assetCollector { assets };
+                state = irs.toXML();
+                expectEquals ((int) assets.size(), 1, "IR data should be stored as an asset!");
+                expect (! state->hasAttribute ("ir_custom_data"), "IR data should not be stored in the XML!");
+            }
+            else
+            {
+                state = irs.toXML();
+            }
         }
 
         using namespace chowdsp::version_literals;
@@ -70,6 +80,15 @@ public:
         for (int i = 1000; i < (int) sampleRate; ++i)
             expectWithinAbsoluteError (testData[i], refData[i], 0.75f);
     }
+
+    void runTest() override
+    {
+        beginTest ("Save/Load Test");
+        saveLoadTest (false);
+
+        beginTest ("Save/Load With Asset References Test");
+        saveLoadTest (true);
+    }
 };
 
 static AmpIRsSaveLoadTest ampIRsSaveLoadTest;
@@ -36,6 +36,7 @@ public:
                 sine.setFrequency (20.0f);
 
                 juce::AudioBuffer<float> buffer { 1, blockSize };
+                juce::AudioBuffer<float> inputPortBuffer { 1, blockSize };
 
                 InputProcessor input;
                 for (int portIdx = 0; portIdx < proc->getNumInputs(); ++portIdx)
@@ -50,10 +51,12 @@ public:
                     sine.processBlock (buffer);
                     buffer.applyGain (4.0f);
 
-                    for (int portIdx = 0; portIdx < proc->getNumInputs(); ++portIdx)
-                        proc->getInputBufferNonConst (portIdx).makeCopyOf (buffer, true);
+                    inputPortBuffer.makeCopyOf (buffer, true);
+                    std::vector<const AudioBuffer<float>*> inputPortBuffers ((size_t) proc->getNumInputs(), &inputPortBuffer);
 
+                    proc->inputBuffers = inputPortBuffers.data();
                     proc->processAudioBlock (buffer);
+                    proc->inputBuffers = nullptr;
 
                     for (int portIdx = 0; portIdx < proc->getNumOutputs(); ++portIdx)
                     {
@@ -0,0 +1,110 @@
+#include "UnitTests.h"
+#include "processors/drive/neural_utils/BatchedGRU.h"
+
+namespace
+{
+constexpr int numTestSamples = 8192;
+constexpr float tolerance = 1.0e-4f;
+
+constexpr int numModels = 5;
+constexpr int numChannels = 2;
+constexpr int hiddenSize = 8;
+
+const std::array<const char*, numModels> centaurModelFiles { "centaur_0.json", "centaur_25.json", "centaur_50.json", "centaur_75.json", "centaur_100.json" };
+
+using ReferenceModel = RTNeural::ModelT<float, 1, 1, RTNeural::GRULayerT<float, 1, hiddenSize, RTNeural::SampleRateCorrectionMode::NoInterp>, RTNeural::DenseT<float, hiddenSize, 1>>;
+using TestModels = BatchedGRU<numModels * numChannels, hiddenSize>;
+} // namespace
+
+/**
+ * Checks that the batched GRU (as used by the Centaur gain stage) matches
+ * the RTNeural GRU models that the gain stage used to run, for each of the
+ * Centaur models, with the models laid out in lanes the same way as in GainStageML.
+ */
+class BatchedGRUTest : public UnitTest
+{
+public:
+    BatchedGRUTest() : UnitTest ("Batched GRU Test")
+    {
+    }
+
+    static chowdsp::json loadCentaurModelJson (int modelIdx)
+    {
+        auto rootDir = File::getSpecialLocation (File::currentExecutableFile);
+        while (rootDir.getFileName() != "BYOD")
+            rootDir = rootDir.getParentDirectory();
+        return chowdsp::JSONUtils::fromFile (rootDir.getChildFile ("res/guitar_ml_models/centaur").getChildFile (centaurModelFiles[(size_t) modelIdx]));
+    }
+
+    static int getLane (int modelIdx, int channel) { return modelIdx * numChannels + channel; }
+
+    void equivalenceTest (int delaySamples)
+    {
+        std::array<std::unique_ptr<ReferenceModel>, numModels> referenceModels;
+        auto testModels = std::make_unique<TestModels>();
+        for (int modelIdx = 0; modelIdx < numModels; ++modelIdx)
+        {
+            const auto modelJson = loadCentaurModelJson (modelIdx);
+            referenceModels[(size_t) modelIdx] = std::make_unique<ReferenceModel>();
+            referenceModels[(size_t) modelIdx]->parseJson (modelJson);
+            referenceModels[(size_t) modelIdx]->get<0>().prepare (delaySamples);
+
+            const auto modelWeights = ModelWeights::fromJSON (modelJson);
+            for (int ch = 0; ch < numChannels; ++ch)
+                testModels->loadLaneWeights (getLane (modelIdx, ch), *modelWeights);
+        }
+        testModels->prepare (delaySamples);
+
+        AudioBuffer<float> input (numChannels, numTestSamples);
+        for (int ch = 0; ch < numChannels; ++ch)
+            for (int n = 0; n < numTestSamples; ++n)
+                input.setSample (ch, n, 0.5f * (rand.nextFloat() * 2.0f - 1.0f));
+
+        AudioBuffer<float> testOutput (numModels * numChannels, numTestSamples);
+        std::array<const float*, (size_t) numModels * numChannels> laneInputs {};
+        std::array<float*, (size_t) numModels * numChannels> laneOutputs {};
+        for (int modelIdx = 0; modelIdx < numModels; ++modelIdx)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                laneInputs[(size_t) getLane (modelIdx, ch)] = input.getReadPointer (ch);
+                laneOutputs[(size_t) getLane (modelIdx, ch)] = testOutput.getWritePointer (getLane (modelIdx, ch));
+            }
+        }
+        testModels->process (laneInputs, laneOutputs, numTestSamples);
+
+        for (int modelIdx = 0; modelIdx < numModels; ++modelIdx)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                auto& referenceModel = *referenceModels[(size_t) modelIdx];
+                referenceModel.reset();
+
+                auto maxError = 0.0f;
+                for (int n = 0; n < numTestSamples; ++n)
+                {
+                    const auto expected = referenceModel.forward (input.getReadPointer (ch) + n);
+                    maxError = jmax (maxError, std::abs (testOutput.getSample (getLane (modelIdx, ch), n) - expected));
+                }
+
+                expectLessOrEqual (maxError, tolerance, "Batched GRU output does not match RTNeural for model: " + String (centaurModelFiles[(size_t) modelIdx]) + ", channel: " + String (ch));
+            }
+        }
+    }
+
+    void runTest() override
+    {
+        rand = getRandom();
+
+        beginTest ("RTNeural Equivalence Test");
+        equivalenceTest (1);
+
+        beginTest ("RTNeural Equivalence Test (delayed state)");
+        equivalenceTest (2);
+    }
+
+private:
+    Random rand;
+};
+
+static BatchedGRUTest batchedGRUTest;
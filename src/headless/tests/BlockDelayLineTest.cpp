@@ -0,0 +1,142 @@
+#include "UnitTests.h"
+#include "processors/BlockDelayLine.h"
+
+namespace
+{
+constexpr int maxDelaySamples = 4096;
+constexpr int numTestSamples = 8192;
+constexpr int maxBlockSize = 32;
+constexpr float tolerance = 1.0e-4f;
+
+using ReferenceDelayLine = chowdsp::DelayLine<float, chowdsp::DelayLineInterpolationTypes::Lagrange5th>;
+} // namespace
+
+class BlockDelayLineTest : public UnitTest
+{
+public:
+    BlockDelayLineTest() : UnitTest ("Block Delay Line Test")
+    {
+    }
+
+    AudioBuffer<float> createTestBuffer (int numChannels)
+    {
+        AudioBuffer<float> buffer (numChannels, numTestSamples);
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            for (int n = 0; n < numTestSamples; ++n)
+                buffer.setSample (ch, n, rand.nextFloat() * 2.0f - 1.0f);
+        }
+
+        return buffer;
+    }
+
+    /** Processes the buffer through chowdsp's delay line, one sample at a time */
+    static void processReference (AudioBuffer<float>& buffer, const float* delaySamples)
+    {
+        ReferenceDelayLine delay { maxDelaySamples };
+        delay.prepare ({ 48000.0, (uint32) numTestSamples, (uint32) buffer.getNumChannels() });
+
+        for (int n = 0; n < buffer.getNumSamples(); ++n)
+        {
+            delay.setDelay (delaySamples[n]);
+            for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            {
+                const auto x = buffer.getSample (ch, n);
+                buffer.setSample (ch, n, delay.popSample (ch));
+                delay.pushSample (ch, x);
+            }
+        }
+    }
+
+    /** Processes the buffer through the block delay line, in blocks that are as long as the delay allows */
+    static void processBlocks (AudioBuffer<float>& buffer, const float* delaySamples, bool isConstant)
+    {
+        BlockDelayLine delay;
+        delay.prepare (buffer.getNumChannels(), maxDelaySamples);
+
+        std::vector<float> output ((size_t) maxBlockSize);
+        for (int startSample = 0; startSample < buffer.getNumSamples();)
+        {
+            auto blockSize = jmin (maxBlockSize, buffer.getNumSamples() - startSample);
+            const auto minDelay = FloatVectorOperations::findMinimum (delaySamples + startSample, blockSize);
+            blockSize = jlimit (1, blockSize, BlockDelayLine::getMaxBlockSize (minDelay));
+
+            for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            {
+                if (isConstant)
+                    delay.read (ch, output.data(), blockSize, delaySamples[startSample]);
+                else
+                    delay.read (ch, output.data(), blockSize, delaySamples + startSample);
+
+                auto* x = buffer.getWritePointer (ch, startSample);
+                delay.write (ch, x, blockSize);
+                FloatVectorOperations::copy (x, output.data(), blockSize);
+            }
+
+            delay.advance (blockSize);
+            startSample += blockSize;
+        }
+    }
+
+    void checkDelay (const std::vector<float>& delaySamples, bool isConstant)
+    {
+        for (int numChannels : { 1, 2 })
+        {
+            auto refBuffer = createTestBuffer (numChannels);
+            AudioBuffer<float> testBuffer;
+            testBuffer.makeCopyOf (refBuffer);
+
+            processReference (refBuffer, delaySamples.data());
+            processBlocks (testBuffer, delaySamples.data(), isConstant);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                for (int n = 0; n < numTestSamples; ++n)
+                {
+                    expectWithinAbsoluteError (testBuffer.getSample (ch, n),
+                                               refBuffer.getSample (ch, n),
+                                               tolerance,
+                                               "Block delay line output is incorrect at sample " + String (n));
+                }
+            }
+        }
+    }
+
+    void constantDelayTest (float delay)
+    {
+        checkDelay (std::vector<float> ((size_t) numTestSamples, delay), true);
+    }
+
+    void smoothedDelayTest (float startDelay, float endDelay)
+    {
+        SmoothedValue<float, ValueSmoothingTypes::Linear> delaySmooth;
+        delaySmooth.reset (numTestSamples / 2);
+        delaySmooth.setCurrentAndTargetValue (startDelay);
+        delaySmooth.setTargetValue (endDelay);
+
+        std::vector<float> delaySamples ((size_t) numTestSamples);
+        for (auto& delay : delaySamples)
+            delay = delaySmooth.getNextValue();
+
+        checkDelay (delaySamples, false);
+    }
+
+    void runTest() override
+    {
+        rand = getRandom();
+
+        beginTest ("Constant Delay Test");
+        for (auto delay : { 3.0f, 3.7f, 10.25f, 47.5f, 960.0f, 2048.33f })
+            constantDelayTest (delay);
+
+        beginTest ("Smoothed Delay Test");
+        smoothedDelayTest (4.5f, 300.0f);
+        smoothedDelayTest (2000.0f, 12.25f);
+        smoothedDelayTest (960.0f, 961.0f);
+    }
+
+private:
+    Random rand;
+};
+
+static BlockDelayLineTest blockDelayLineTest;
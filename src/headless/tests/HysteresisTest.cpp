@@ -0,0 +1,78 @@
+#include "UnitTests.h"
+#include "processors/drive/hysteresis/HysteresisProcessing.h"
+
+namespace
+{
+constexpr int numTestSamples = 16384;
+constexpr float accuracyTolerance = 1.0e-3f;
+} // namespace
+
+class HysteresisTest : public UnitTest
+{
+public:
+    HysteresisTest() : UnitTest ("Hysteresis Test")
+    {
+    }
+
+    template <typename SampleType>
+    std::vector<SampleType> process (const AudioBuffer<float>& input, double sampleRate, float drive, float width, float sat)
+    {
+        HysteresisProcessing<SampleType> proc;
+        proc.reset();
+        proc.setSampleRate (sampleRate);
+        proc.setParameters (drive, width, sat);
+
+        std::vector<SampleType> left (input.getReadPointer (0), input.getReadPointer (0) + numTestSamples);
+        std::vector<SampleType> right (input.getReadPointer (1), input.getReadPointer (1) + numTestSamples);
+        proc.processBlock (left.data(), right.data(), numTestSamples);
+
+        left.insert (left.end(), right.begin(), right.end());
+        return left;
+    }
+
+    void accuracyTest (double sampleRate, float drive, float width, float sat)
+    {
+        AudioBuffer<float> input (2, numTestSamples);
+        for (int n = 0; n < numTestSamples; ++n)
+        {
+            const auto sine = std::sin (MathConstants<float>::twoPi * 100.0f * (float) n / (float) sampleRate);
+            input.setSample (0, n, 1.8f * sine + 0.2f * (rand.nextFloat() * 2.0f - 1.0f));
+            input.setSample (1, n, 0.1f * (rand.nextFloat() * 2.0f - 1.0f));
+        }
+
+        const auto reference = process<double> (input, sampleRate, drive, width, sat);
+        const auto output = process<float> (input, sampleRate, drive, width, sat);
+
+        float maxError = 0.0f;
+        for (size_t n = 0; n < reference.size(); ++n)
+        {
+            expect (! std::isnan (output[n]), "NAN found in output!");
+            maxError = jmax (maxError, std::abs (output[n] - (float) reference[n]));
+        }
+
+        expectLessThan (maxError, accuracyTolerance, "Single precision output does not match double precision output!");
+    }
+
+    void runTest() override
+    {
+        rand = getRandom();
+
+        for (auto sampleRate : { 48000.0, 192000.0 })
+        {
+            beginTest ("Float/Double Accuracy Test @ " + String (sampleRate / 1000.0) + " kHz");
+            for (auto drive : { 0.1f, 0.5f, 1.0f })
+            {
+                for (auto width : { 0.0f, 0.5f, 1.0f })
+                {
+                    for (auto sat : { 0.0f, 0.5f, 1.0f })
+                        accuracyTest (sampleRate, drive, width, sat);
+                }
+            }
+        }
+    }
+
+private:
+    Random rand;
+};
+
+static HysteresisTest hysteresisTest;
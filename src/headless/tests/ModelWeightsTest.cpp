@@ -0,0 +1,214 @@
+#include "UnitTests.h"
+#include "processors/drive/neural_utils/model_loaders.h"
+
+namespace
+{
+constexpr int numTestSamples = 4096;
+constexpr float tolerance = 1.0e-6f;
+
+struct BuiltInModel
+{
+    const char* jsonPath;
+    const char* binaryDataName;
+};
+
+const std::vector<BuiltInModel> builtInModels {
+    { "BluesJrAmp_VolKnob.json", "BluesJrAmp_VolKnob_bin" },
+    { "MesaRecMini_ModernChannel_GainKnob.json", "MesaRecMini_ModernChannel_GainKnob_bin" },
+    { "TS9_DriveKnob.json", "TS9_DriveKnob_bin" },
+    { "metal_face_model.json", "metal_face_model_bin" },
+    { "bass_face_model_88_2k.json", "bass_face_model_88_2k_bin" },
+    { "bass_face_model_96k.json", "bass_face_model_96k_bin" },
+    { "fuzz_15.json", "fuzz_15_bin" },
+    { "fuzz_2.json", "fuzz_2_bin" },
+    { "fuzz_15_88.json", "fuzz_15_88_bin" },
+    { "fuzz_2_88.json", "fuzz_2_88_bin" },
+    { "centaur/centaur_0.json", "centaur_0_bin" },
+    { "centaur/centaur_25.json", "centaur_25_bin" },
+    { "centaur/centaur_50.json", "centaur_50_bin" },
+    { "centaur/centaur_75.json", "centaur_75_bin" },
+    { "centaur/centaur_100.json", "centaur_100_bin" },
+};
+
+template <int inputSize, int hiddenSize>
+using LSTMModel = RTNeural::ModelT<float, inputSize, 1, RTNeural::LSTMLayerT<float, inputSize, hiddenSize>, RTNeural::DenseT<float, hiddenSize, 1>>;
+} // namespace
+
+/**
+ * Checks that the built-in models in the binary weights format are the same as
+ * the models in their original JSON format, and that they still load the same
+ * way as they did when the models were loaded straight from the JSON.
+ */
+class ModelWeightsTest : public UnitTest
+{
+public:
+    ModelWeightsTest() : UnitTest ("Model Weights Test")
+    {
+    }
+
+    static File getModelJsonFile (const String& jsonPath)
+    {
+        auto rootDir = File::getSpecialLocation (File::currentExecutableFile);
+        while (rootDir.getFileName() != "BYOD")
+            rootDir = rootDir.getParentDirectory();
+        return rootDir.getChildFile ("res/guitar_ml_models").getChildFile (jsonPath);
+    }
+
+    static std::shared_ptr<const ModelWeights> getBinaryDataWeights (const char* binaryDataName)
+    {
+        int dataSize = 0;
+        const auto* data = BinaryData::getNamedResource (binaryDataName, dataSize);
+        return ModelWeights::fromBinary (data, (size_t) dataSize);
+    }
+
+    /** Checks that the JSON converts to the same data as the converted model in BinaryData */
+    void binaryConversionTest (const BuiltInModel& model)
+    {
+        int dataSize = 0;
+        const auto* data = BinaryData::getNamedResource (model.binaryDataName, dataSize);
+        expect (data != nullptr, "Model is missing from BinaryData: " + String (model.binaryDataName));
+
+        const auto modelJson = chowdsp::JSONUtils::fromFile (getModelJsonFile (model.jsonPath));
+        const auto convertedData = ModelWeights::fromJSON (modelJson)->toBinary();
+        expect (convertedData.size() == (size_t) dataSize && std::memcmp (convertedData.data(), data, convertedData.size()) == 0,
+                "Converted model does not match BinaryData (the model may need to be re-converted): " + String (model.jsonPath));
+    }
+
+    template <typename ModelType>
+    std::vector<float> processModel (ModelType& model, int numInputs)
+    {
+        Random modelRand { 0x1234 };
+        model.reset();
+
+        std::vector<float> output ((size_t) numTestSamples);
+        alignas (RTNEURAL_DEFAULT_ALIGNMENT) float input[16] {};
+        for (auto& y : output)
+        {
+            for (int i = 0; i < numInputs; ++i)
+                input[i] = 0.5f * (modelRand.nextFloat() * 2.0f - 1.0f);
+            y = model.forward (input);
+        }
+
+        return output;
+    }
+
+    void expectOutputsMatch (const std::vector<float>& actual, const std::vector<float>& expected, const String& message)
+    {
+        auto maxError = 0.0f;
+        for (size_t n = 0; n < expected.size(); ++n)
+            maxError = jmax (maxError, std::abs (actual[n] - expected[n]));
+
+        expectLessOrEqual (maxError, tolerance, message);
+    }
+
+    /** Compares our LSTM loader (from the binary weights) against the RTNeural loader (from the JSON) */
+    template <int inputSize, int hiddenSize>
+    void lstmLoaderTest (const BuiltInModel& model)
+    {
+        const auto modelJson = chowdsp::JSONUtils::fromFile (getModelJsonFile (model.jsonPath));
+        LSTMModel<inputSize, hiddenSize> referenceModel;
+        RTNeural::torch_helpers::loadLSTM<float> (modelJson.at ("state_dict"), "rec.", referenceModel.template get<0>());
+        RTNeural::torch_helpers::loadDense<float> (modelJson.at ("state_dict"), "lin.", referenceModel.template get<1>());
+
+        LSTMModel<inputSize, hiddenSize> testModel;
+        model_loaders::loadLSTMModel<inputSize, hiddenSize> (testModel, *getBinaryDataWeights (model.binaryDataName));
+
+        expectOutputsMatch (processModel (testModel, inputSize),
+                            processModel (referenceModel, inputSize),
+                            "Model output does not match the JSON model: " + String (model.jsonPath));
+    }
+
+    /**
+     * Custom GuitarML models are imported from JSON, and then saved in the binary
+     * plugin state (as binary weights) or the XML plugin state (as JSON), so the
+     * model should survive each of those steps unchanged.
+     */
+    void customModelImportTest (const BuiltInModel& model)
+    {
+        const auto importedWeights = ModelWeights::fromJSON (chowdsp::JSONUtils::fromFile (getModelJsonFile (model.jsonPath)));
+
+        const auto binaryStateData = importedWeights->toBinary();
+        const auto binaryStateWeights = ModelWeights::fromBinary (binaryStateData.data(), binaryStateData.size());
+        const auto xmlStateWeights = ModelWeights::fromJSON (chowdsp::json::parse (importedWeights->toJSON().dump()));
+
+        expect (binaryStateWeights->getMetadata() == importedWeights->getMetadata(), "Binary state changed the model metadata!");
+        expect (xmlStateWeights->getMetadata() == importedWeights->getMetadata(), "XML state changed the model metadata!");
+        expect (binaryStateWeights->getContentHash() == importedWeights->getContentHash(), "Binary state changed the model hash!");
+        expect (xmlStateWeights->getContentHash() == importedWeights->getContentHash(), "XML state changed the model hash!");
+
+        LSTMModel<2, 40> referenceModel;
+        model_loaders::loadLSTMModel<2, 40> (referenceModel, *getBinaryDataWeights (model.binaryDataName));
+        const auto referenceOutput = processModel (referenceModel, 2);
+
+        for (const auto* weights : { importedWeights.get(), binaryStateWeights.get(), xmlStateWeights.get() })
+        {
+            LSTMModel<2, 40> testModel;
+            model_loaders::loadLSTMModel<2, 40> (testModel, *weights);
+            expectOutputsMatch (processModel (testModel, 2), referenceOutput, "Custom model output does not match the built-in model: " + String (model.jsonPath));
+        }
+    }
+
+    /** A crafted file (e.g. in a preset) whose tensor shape overflows the tensor size should be rejected, rather than read out of bounds. */
+    void overflowingShapeTest()
+    {
+        std::vector<char> data;
+        const auto writeUInt32 = [&data] (uint32 value)
+        {
+            value = ByteOrder::swapIfBigEndian (value);
+            data.insert (data.end(), reinterpret_cast<const char*> (&value), reinterpret_cast<const char*> (&value) + sizeof (uint32));
+        };
+
+        const std::string metadata = "{}";
+        const std::string tensorName = "/x";
+        writeUInt32 (ModelWeights::magicNumber);
+        writeUInt32 (ModelWeights::formatVersion);
+        writeUInt32 (1);
+        writeUInt32 ((uint32) metadata.size());
+        data.insert (data.end(), metadata.begin(), metadata.end());
+        writeUInt32 ((uint32) tensorName.size());
+        data.insert (data.end(), tensorName.begin(), tensorName.end());
+
+        // 2^31 * 2^31 * 4 elements wraps around to zero in 64 bits
+        writeUInt32 (3);
+        writeUInt32 (0x80000000);
+        writeUInt32 (0x80000000);
+        writeUInt32 (4);
+        writeUInt32 (64);
+        data.resize (128, 0);
+
+        auto isRejected = false;
+        try
+        {
+            ModelWeights::fromBinary (data.data(), data.size());
+        }
+        catch (const std::exception&)
+        {
+            isRejected = true;
+        }
+        expect (isRejected, "Model weights with an overflowing tensor shape were not rejected!");
+    }
+
+    void runTest() override
+    {
+        beginTest ("Binary Conversion Test");
+        for (const auto& model : builtInModels)
+            binaryConversionTest (model);
+
+        beginTest ("LSTM Loader Test");
+        lstmLoaderTest<2, 40> (builtInModels[0]);
+        lstmLoaderTest<2, 40> (builtInModels[1]);
+        lstmLoaderTest<2, 40> (builtInModels[2]);
+        lstmLoaderTest<1, 28> (builtInModels[3]);
+        for (size_t i = 4; i < 10; ++i)
+            lstmLoaderTest<2, 24> (builtInModels[i]);
+
+        beginTest ("Custom Model Import Test");
+        for (size_t i = 0; i < 3; ++i)
+            customModelImportTest (builtInModels[i]);
+
+        beginTest ("Overflowing Shape Test");
+        overflowingShapeTest();
+    }
+};
+
+static ModelWeightsTest modelWeightsTest;
@@ -0,0 +1,120 @@
+#include "UnitTests.h"
+#include "processors/other/cry_baby/CryBabyNDK.h"
+
+namespace
+{
+constexpr double matrixTolerance = 1.0e-4; // relative error of each interpolated NDK matrix
+constexpr double outputToleranceDB = -80.0; // largest output error, relative to the peak output level
+constexpr int subBlockSize = 32;
+} // namespace
+
+/**
+ * Checks that the Crying Child NDK model gives (almost) the same results when
+ * the wah pot matrices come from the pre-computed pot table, as when they are
+ * computed exactly for each pot position.
+ */
+class NDKPotTableTest : public UnitTest
+{
+public:
+    NDKPotTableTest() : UnitTest ("NDK Pot Table Test")
+    {
+    }
+
+    static auto createModels (double sampleRate)
+    {
+        auto exactModel = std::make_unique<CryBabyNDK>();
+        exactModel->use_pot_table = false;
+        exactModel->reset (sampleRate);
+
+        auto tableModel = std::make_unique<CryBabyNDK>();
+        tableModel->use_pot_table = true;
+        tableModel->reset (sampleRate);
+
+        return std::make_pair (std::move (exactModel), std::move (tableModel));
+    }
+
+    template <typename MatrixType>
+    void checkMatrix (const MatrixType& actual, const MatrixType& expected, double position, const String& name)
+    {
+        const auto error = (actual - expected).norm() / expected.norm();
+        expectLessThan (error, matrixTolerance, name + " is not accurate enough at pot position " + String (position));
+    }
+
+    void matrixTest (double sampleRate)
+    {
+        auto [exactModel, tableModel] = createModels (sampleRate);
+        expect (tableModel->pot_table.is_ready(), "Pot table was not computed!");
+
+        // the midpoints between the table entries should have the largest interpolation errors
+        constexpr auto tableSize = decltype (CryBabyNDK::pot_table)::table_size;
+        for (size_t i = 0; i < tableSize - 1; ++i)
+        {
+            for (auto position : { (double) i / double (tableSize - 1), ((double) i + 0.5) / double (tableSize - 1) })
+            {
+                exactModel->update_wah_position (position);
+                tableModel->update_wah_position (position);
+
+                checkMatrix (tableModel->A_mat, exactModel->A_mat, position, "A");
+                checkMatrix (tableModel->B_mat_var, exactModel->B_mat_var, position, "B");
+                checkMatrix (tableModel->B_u_fix, exactModel->B_u_fix, position, "B (fixed voltages)");
+                checkMatrix (tableModel->C_mat, exactModel->C_mat, position, "C");
+                checkMatrix (tableModel->D_mat, exactModel->D_mat, position, "D");
+                checkMatrix (tableModel->E_mat_var, exactModel->E_mat_var, position, "E");
+                checkMatrix (tableModel->E_u_fix, exactModel->E_u_fix, position, "E (fixed voltages)");
+                checkMatrix (tableModel->F_mat, exactModel->F_mat, position, "F");
+                checkMatrix (tableModel->G_mat, exactModel->G_mat, position, "G");
+                checkMatrix (tableModel->H_mat_var, exactModel->H_mat_var, position, "H");
+                checkMatrix (tableModel->H_u_fix, exactModel->H_u_fix, position, "H (fixed voltages)");
+                checkMatrix (tableModel->K_mat, exactModel->K_mat, position, "K");
+            }
+        }
+    }
+
+    /** Processes a sine wave, with the wah pot sweeping back and forth, like it does when driven by the level input */
+    static std::vector<float> processSweep (CryBabyNDK& model, double sampleRate)
+    {
+        std::vector<float> output ((size_t) (0.1 * sampleRate));
+        for (size_t n = 0; n < output.size(); ++n)
+            output[n] = 0.5f * (float) std::sin (MathConstants<double>::twoPi * 220.0 * (double) n / sampleRate);
+
+        for (size_t n = 0; n < output.size(); n += subBlockSize)
+        {
+            const auto subBlockLength = jmin ((size_t) subBlockSize, output.size() - n);
+            model.update_wah_position (0.5 + 0.5 * std::sin (MathConstants<double>::twoPi * 5.0 * (double) n / sampleRate));
+            model.process ({ output.data() + n, subBlockLength }, 0);
+        }
+
+        return output;
+    }
+
+    void outputTest (double sampleRate)
+    {
+        auto [exactModel, tableModel] = createModels (sampleRate);
+        const auto exactOutput = processSweep (*exactModel, sampleRate);
+        const auto tableOutput = processSweep (*tableModel, sampleRate);
+
+        auto maxError = 0.0f;
+        auto peakLevel = 0.0f;
+        for (size_t n = 0; n < exactOutput.size(); ++n)
+        {
+            maxError = jmax (maxError, std::abs (tableOutput[n] - exactOutput[n]));
+            peakLevel = jmax (peakLevel, std::abs (exactOutput[n]));
+        }
+
+        expectLessThan (Decibels::gainToDecibels ((double) maxError / (double) peakLevel, -200.0), outputToleranceDB, "Output with the pot table is not accurate enough!");
+    }
+
+    void runTest() override
+    {
+        for (auto sampleRate : { 44100.0, 88200.0, 192000.0 })
+        {
+            beginTest ("Matrix Interpolation Test @ " + String (sampleRate) + " Hz");
+            matrixTest (sampleRate);
+
+            beginTest ("Output Test @ " + String (sampleRate) + " Hz");
+            outputTest (sampleRate);
+        }
+    }
+};
+
+static NDKPotTableTest ndkPotTableTest;
@@ -0,0 +1,104 @@
+#include "UnitTests.h"
+#include "processors/chain/ProcessorChainActionHelper.h"
+
+namespace
+{
+constexpr double sampleRate = 48000.0;
+constexpr int blockSize = 2048;
+constexpr int numBlocks = 8;
+} // namespace
+
+/**
+ * Mixes a branch that runs at the base sample rate with an inverted branch that
+ * runs at the oversampled rate. If the plan lines up the two branches properly,
+ * they should cancel out.
+ */
+class ParallelBranchTest : public UnitTest
+{
+public:
+    ParallelBranchTest() : UnitTest ("Parallel Branch Test")
+    {
+    }
+
+    static void fillTestSignal (AudioBuffer<float>& buffer, int startSample)
+    {
+        for (int n = 0; n < buffer.getNumSamples(); ++n)
+        {
+            const auto time = (double) (startSample + n) / sampleRate;
+            auto x = 0.0;
+            for (auto freq : { 100.0, 1000.0, 5000.0, 12000.0 })
+                x += 0.2 * std::sin (MathConstants<double>::twoPi * freq * time);
+
+            for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+                buffer.setSample (ch, n, (float) x);
+        }
+    }
+
+    void nullTest (float osFactorParamValue, int osFactor)
+    {
+        BYOD plugin;
+        auto* undoManager = plugin.getVTS().undoManager;
+        auto& chain = plugin.getProcChain();
+        auto& actionHelper = chain.getActionHelper();
+
+        plugin.getVTS().getParameter ("os_factor")->setValueNotifyingHost (osFactorParamValue);
+        plugin.prepareToPlay (sampleRate, blockSize);
+        MessageManager::getInstance()->runDispatchLoopUntil (100);
+        const auto latencyWithoutBranches = plugin.getLatencySamples();
+
+        actionHelper.addProcessor (ProcessorStore::getStoreMap().at ("Graphic EQ").factory (undoManager));
+        actionHelper.addProcessor (ProcessorStore::getStoreMap().at ("Clean Gain").factory (undoManager));
+        actionHelper.addProcessor (ProcessorStore::getStoreMap().at ("Mixer").factory (undoManager));
+
+        auto* input = &chain.getInputProcessor();
+        auto* baseRateProc = chain.getProcessors()[0];
+        auto* invertProc = chain.getProcessors()[1];
+        auto* mixer = chain.getProcessors()[2];
+        auto* output = &chain.getOutputProcessor();
+        expect (! baseRateProc->needsOversampling() && invertProc->needsOversampling(), "Branches should run at different sample rates!");
+
+        invertProc->getVTS().getParameter ("invert")->setValueNotifyingHost (1.0f);
+
+        actionHelper.removeConnection ({ input, 0, output, 0 });
+        actionHelper.addConnection ({ input, 0, baseRateProc, 0 });
+        actionHelper.addConnection ({ input, 0, invertProc, 0 });
+        actionHelper.addConnection ({ baseRateProc, 0, mixer, 0 });
+        actionHelper.addConnection ({ invertProc, 0, mixer, 1 });
+        actionHelper.addConnection ({ mixer, 0, output, 0 });
+        MessageManager::getInstance()->runDispatchLoopUntil (100);
+
+        MidiBuffer midi;
+        AudioBuffer<float> buffer (2, blockSize);
+        auto inputLevel = 0.0f, outputLevel = 0.0f;
+        for (int i = 0; i < numBlocks; ++i)
+        {
+            fillTestSignal (buffer, i * blockSize);
+            inputLevel = buffer.getRMSLevel (0, 0, blockSize);
+
+            chain.processAudio (buffer, midi);
+            outputLevel = buffer.getRMSLevel (0, 0, blockSize);
+        }
+
+        expectLessThan (Decibels::gainToDecibels (outputLevel / inputLevel), -40.0f, "Parallel branches are not lined up!");
+
+        MessageManager::getInstance()->runDispatchLoopUntil (100);
+        if (osFactor > 1)
+            expectGreaterThan (plugin.getLatencySamples(), latencyWithoutBranches, "Resampling latency is not being reported!");
+        else
+            expectEquals (plugin.getLatencySamples(), latencyWithoutBranches, "No latency should be added without oversampling!");
+    }
+
+    void runTest() override
+    {
+        beginTest ("1x Oversampling Test");
+        nullTest (0.0f, 1);
+
+        beginTest ("2x Oversampling Test");
+        nullTest (0.25f, 2);
+
+        beginTest ("4x Oversampling Test");
+        nullTest (0.5f, 4);
+    }
+};
+
+static ParallelBranchTest parallelBranchTest;
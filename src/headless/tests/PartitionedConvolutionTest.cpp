@@ -0,0 +1,197 @@
+#include "UnitTests.h"
+#include "processors/tone/ir_utils/PartitionedConvolution.h"
+
+namespace
+{
+constexpr double sampleRate = 48000.0;
+constexpr int maxBlockSize = 512;
+constexpr int irLength = 9000; // long enough to use all the partition sizes
+constexpr int numTestSamples = 24000;
+constexpr float tolerance = 1.0e-4f;
+} // namespace
+
+class PartitionedConvolutionTest : public UnitTest
+{
+public:
+    PartitionedConvolutionTest() : UnitTest ("Partitioned Convolution Test")
+    {
+    }
+
+    PartitionedConvolution::IRPtr createTestIR (int numChannels)
+    {
+        auto ir = std::make_shared<SharedAssetCache::IR>();
+        ir->sampleRate = sampleRate;
+        ir->buffer.setSize (numChannels, irLength);
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            for (int n = 0; n < irLength; ++n)
+                ir->buffer.setSample (ch, n, (rand.nextFloat() * 2.0f - 1.0f) * std::exp (-4.0f * (float) n / (float) irLength));
+
+            // make sure the IR doesn't get trimmed
+            ir->buffer.setSample (ch, 0, 1.0f);
+            ir->buffer.setSample (ch, irLength - 1, 0.5f);
+        }
+
+        return ir;
+    }
+
+    AudioBuffer<float> createTestBuffer (int numChannels)
+    {
+        AudioBuffer<float> buffer (numChannels, numTestSamples);
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            for (int n = 0; n < numTestSamples; ++n)
+                buffer.setSample (ch, n, rand.nextFloat() * 2.0f - 1.0f);
+        }
+
+        return buffer;
+    }
+
+    /** The IR is normalised when it's loaded, so the reference needs the same normalisation */
+    static float getNormalisationGain (const SharedAssetCache::IR& ir)
+    {
+        auto maxSumSquared = 0.0f;
+        for (int ch = 0; ch < ir.buffer.getNumChannels(); ++ch)
+        {
+            const auto* data = ir.buffer.getReadPointer (ch);
+            maxSumSquared = jmax (maxSumSquared, std::inner_product (data, data + irLength, data, 0.0f));
+        }
+        return 0.125f / std::sqrt (maxSumSquared);
+    }
+
+    static float getReferenceSample (const AudioBuffer<float>& input, const SharedAssetCache::IR& ir, int channel, int sampleIndex)
+    {
+        const auto* x = input.getReadPointer (channel);
+        const auto* h = ir.buffer.getReadPointer (jmin (channel, ir.buffer.getNumChannels() - 1));
+
+        auto y = 0.0;
+        for (int k = 0; k <= jmin (sampleIndex, irLength - 1); ++k)
+            y += (double) h[k] * (double) x[sampleIndex - k];
+        return (float) y * getNormalisationGain (ir);
+    }
+
+    /** Processes the input with a random block size, and returns the sample index of each block */
+    Array<int> process (PartitionedConvolution& convolution, AudioBuffer<float>& buffer, int startSample, int numSamples)
+    {
+        Array<int> blockStarts;
+        for (int sample = startSample; sample < startSample + numSamples;)
+        {
+            const auto blockSize = jmin (rand.nextInt ({ 1, maxBlockSize + 1 }), startSample + numSamples - sample);
+            AudioBuffer<float> block { buffer.getArrayOfWritePointers(), buffer.getNumChannels(), sample, blockSize };
+            convolution.process (block);
+            blockStarts.add (sample);
+            sample += blockSize;
+        }
+        return blockStarts;
+    }
+
+    void checkOutput (const AudioBuffer<float>& input, const AudioBuffer<float>& output, const SharedAssetCache::IR& ir, int startSample)
+    {
+        for (int ch = 0; ch < output.getNumChannels(); ++ch)
+        {
+            // the reference is quite slow, so we don't check every sample
+            for (int n = startSample; n < numTestSamples; n += 7)
+                expectWithinAbsoluteError (output.getSample (ch, n), getReferenceSample (input, ir, ch, n), tolerance, "Output is incorrect at sample " + String (n));
+        }
+    }
+
+    void directConvolutionTest (int numChannels, int numIRChannels)
+    {
+        const auto ir = createTestIR (numIRChannels);
+        const auto input = createTestBuffer (numChannels);
+
+        PartitionedConvolution convolution;
+        convolution.loadIR (ir, "test_ir_" + String (rand.nextInt64()));
+        convolution.prepare (sampleRate, maxBlockSize);
+
+        AudioBuffer<float> output { input };
+        process (convolution, output, 0, numTestSamples);
+        checkOutput (input, output, *ir, 0);
+    }
+
+    void irChangeTest()
+    {
+        const auto firstIR = createTestIR (2);
+        const auto secondIR = createTestIR (2);
+        const auto input = createTestBuffer (2);
+
+        PartitionedConvolution convolution;
+        convolution.loadIR (firstIR, "test_ir_" + String (rand.nextInt64()));
+        convolution.prepare (sampleRate, maxBlockSize);
+
+        AudioBuffer<float> output { input };
+        process (convolution, output, 0, numTestSamples / 4);
+
+        // the new IR is prepared in the background, and then picked up at the start of the next block
+        convolution.loadIR (secondIR, "test_ir_" + String (rand.nextInt64()));
+        Thread::sleep (500);
+        const auto swapSample = process (convolution, output, numTestSamples / 4, numTestSamples - numTestSamples / 4).getFirst();
+
+        // once the crossfade is over, and the new engine has seen enough input, the output should match the new IR
+        checkOutput (input, output, *secondIR, swapSample + jmax (irLength, (int) (0.05 * sampleRate)));
+    }
+
+    void truncationTest()
+    {
+        SharedAssetCache::IR ir;
+        ir.sampleRate = sampleRate;
+        ir.buffer.setSize (1, (int) sampleRate);
+        for (int n = 0; n < ir.buffer.getNumSamples(); ++n)
+            ir.buffer.setSample (0, n, (rand.nextFloat() * 2.0f - 1.0f) * std::exp (-(float) n / 1000.0f));
+
+        // the energy decays by 60 dB after ~7000 samples
+        const auto prepared = ir_preprocessing::prepareIR (ir, sampleRate, {});
+        expectLessThan (prepared.getNumSamples(), 10000, "IR tail was not truncated!");
+        expectGreaterThan (prepared.getNumSamples(), 5000, "IR tail was truncated too early!");
+        expectLessThan (std::abs (prepared.getSample (0, prepared.getNumSamples() - 1)), 1.0e-4f, "IR tail was not faded out!");
+
+        const auto resampled = ir_preprocessing::prepareIR (ir, 2.0 * sampleRate, {});
+        expectWithinAbsoluteError ((float) resampled.getNumSamples() / (float) prepared.getNumSamples(), 2.0f, 0.1f, "IR was not resampled!");
+    }
+
+    void minimumPhaseTest()
+    {
+        // this IR has a zero outside the unit circle, so the minimum phase version is time-reversed
+        SharedAssetCache::IR ir;
+        ir.sampleRate = sampleRate;
+        ir.buffer.setSize (1, 2);
+        ir.buffer.setSample (0, 0, 0.5f);
+        ir.buffer.setSample (0, 1, 1.0f);
+
+        ir_preprocessing::Options options;
+        options.minimumPhase = true;
+        const auto prepared = ir_preprocessing::prepareIR (ir, sampleRate, options);
+
+        const auto gain = 0.125f / std::sqrt (1.25f);
+        expectWithinAbsoluteError (prepared.getSample (0, 0), 1.0f * gain, 1.0e-3f, "Minimum phase IR is incorrect!");
+        expectWithinAbsoluteError (prepared.getSample (0, 1), 0.5f * gain, 1.0e-3f, "Minimum phase IR is incorrect!");
+    }
+
+    void runTest() override
+    {
+        rand = getRandom();
+
+        beginTest ("Direct Convolution Equivalence Test (Mono)");
+        directConvolutionTest (1, 1);
+
+        beginTest ("Direct Convolution Equivalence Test (Stereo)");
+        directConvolutionTest (2, 2);
+
+        beginTest ("Direct Convolution Equivalence Test (Mono IR, Stereo Input)");
+        directConvolutionTest (2, 1);
+
+        beginTest ("IR Change Test");
+        irChangeTest();
+
+        beginTest ("IR Truncation Test");
+        truncationTest();
+
+        beginTest ("Minimum Phase Test");
+        minimumPhaseTest();
+    }
+
+private:
+    Random rand;
+};
+
+static PartitionedConvolutionTest partitionedConvolutionTest;
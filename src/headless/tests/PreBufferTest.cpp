@@ -39,21 +39,28 @@ public:
             this,
             [this] (BaseProcessor* proc)
             {
-                proc->prepareProcessing (testSampleRate, testBlockSize);
-
-                MidiBuffer midi;
-                AudioBuffer<float> buffer (1, testBlockSize);
-                buffer.clear();
-                proc->midiBuffer = &midi;
-                proc->processAudioBlock (buffer);
-
                 const auto steadyStateMax = [] (const auto& name)
                 {
                     if (name == "Tweed")
                         return 1.0e-3f;
                     return 1.0e-4f;
                 }(proc->getName());
-                testBuffer (buffer.getReadPointer (0), steadyStateMax);
+
+                // the second time around, any modules that use steady-state
+                // snapshots will be restored from the snapshot taken the first time
+                for (int i = 0; i < 2; ++i)
+                {
+                    proc->prepareProcessing (testSampleRate, testBlockSize);
+
+                    MidiBuffer midi;
+                    AudioBuffer<float> buffer (1, testBlockSize);
+                    buffer.clear();
+                    proc->midiBuffer = &midi;
+                    proc->processAudioBlock (buffer);
+                    proc->midiBuffer = nullptr;
+
+                    testBuffer (buffer.getReadPointer (0), steadyStateMax);
+                }
             },
             StringArray { "Muff Drive", "Muff Clipper", "Trumble Drive", "Swinger Pre" });
     }
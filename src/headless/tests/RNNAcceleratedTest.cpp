@@ -0,0 +1,148 @@
+#include "UnitTests.h"
+#include "processors/drive/neural_utils/RNNAcceleratedDispatch.h"
+
+namespace
+{
+constexpr int numTestSamples = 8192;
+constexpr float isaTolerance = 5.0e-4f;
+constexpr float stereoTolerance = 1.0e-3f;
+
+using MetalFaceModels = rnn_dispatch::Models<true, 1, 28, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::NoInterp>;
+using MetalFaceMonoModels = rnn_dispatch::Models<false, 1, 28, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::NoInterp>;
+using GuitarMLModels = rnn_dispatch::Models<true, 2, 40, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::LinInterp>;
+} // namespace
+
+class RNNAcceleratedTest : public UnitTest
+{
+public:
+    RNNAcceleratedTest() : UnitTest ("RNN Accelerated Test")
+    {
+    }
+
+    AudioBuffer<float> createTestBuffer (int numChannels)
+    {
+        AudioBuffer<float> buffer (numChannels, numTestSamples);
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            for (int n = 0; n < numTestSamples; ++n)
+                buffer.setSample (ch, n, 0.5f * (rand.nextFloat() * 2.0f - 1.0f));
+        }
+        return buffer;
+    }
+
+    void expectBuffersMatch (const AudioBuffer<float>& actual, const AudioBuffer<float>& expected, float tolerance, const String& message)
+    {
+        float maxError = 0.0f;
+        for (int ch = 0; ch < expected.getNumChannels(); ++ch)
+        {
+            for (int n = 0; n < expected.getNumSamples(); ++n)
+                maxError = jmax (maxError, std::abs (actual.getSample (ch, n) - expected.getSample (ch, n)));
+        }
+
+        expectLessThan (maxError, tolerance, message);
+    }
+
+    template <typename Models, typename ProcessFunc>
+    AudioBuffer<float> processWithInstructionSet (rnn_dispatch::InstructionSet isa, const ModelWeights& modelWeights, const AudioBuffer<float>& input, ProcessFunc&& processFunc)
+    {
+        auto model = std::make_unique<typename Models::Variant>();
+        Models::emplace (*model, isa);
+        model->visit ([&modelWeights] (auto& m)
+                      { m.initialise (modelWeights); });
+
+        auto output = input;
+        model->visit ([&output, &processFunc] (auto& m)
+                      { processFunc (m, output); });
+        return output;
+    }
+
+    template <typename Models, typename ProcessFunc>
+    void instructionSetTest (const ModelWeights& modelWeights, ProcessFunc&& processFunc)
+    {
+        const auto input = createTestBuffer (2);
+        const auto reference = processWithInstructionSet<Models> (rnn_dispatch::InstructionSet::Default, modelWeights, input, processFunc);
+
+        for (auto isa : { rnn_dispatch::InstructionSet::AVX, rnn_dispatch::InstructionSet::AVX2, rnn_dispatch::InstructionSet::AVX512 })
+        {
+            if (! rnn_dispatch::isSupported (isa))
+            {
+                logMessage ("Skipping instruction set: " + rnn_dispatch::getName (isa));
+                continue;
+            }
+
+            const auto output = processWithInstructionSet<Models> (isa, modelWeights, input, processFunc);
+            expectBuffersMatch (output, reference, isaTolerance, rnn_dispatch::getName (isa) + " output does not match " + rnn_dispatch::getName (rnn_dispatch::InstructionSet::Default) + " output!");
+        }
+    }
+
+    void stereoMatchesMonoTest (const ModelWeights& modelWeights)
+    {
+        const auto input = createTestBuffer (2);
+
+        const auto stereoOutput = processWithInstructionSet<MetalFaceModels> (rnn_dispatch::getBestInstructionSet(),
+                                                                              modelWeights,
+                                                                              input,
+                                                                              [] (auto& model, AudioBuffer<float>& buffer)
+                                                                              {
+                                                                                  model.prepare (1);
+                                                                                  model.process ({ buffer.getWritePointer (0), (size_t) numTestSamples },
+                                                                                                 { buffer.getWritePointer (1), (size_t) numTestSamples });
+                                                                              });
+
+        AudioBuffer<float> monoOutput (2, numTestSamples);
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            AudioBuffer<float> channelInput (1, numTestSamples);
+            channelInput.copyFrom (0, 0, input, ch, 0, numTestSamples);
+
+            const auto channelOutput = processWithInstructionSet<MetalFaceMonoModels> (rnn_dispatch::getBestInstructionSet(),
+                                                                                       modelWeights,
+                                                                                       channelInput,
+                                                                                       [] (auto& model, AudioBuffer<float>& buffer)
+                                                                                       {
+                                                                                           model.prepare (1);
+                                                                                           model.process ({ buffer.getWritePointer (0), (size_t) numTestSamples });
+                                                                                       });
+            monoOutput.copyFrom (ch, 0, channelOutput, 0, 0, numTestSamples);
+        }
+
+        expectBuffersMatch (stereoOutput, monoOutput, stereoTolerance, "Stereo model output does not match mono model output!");
+    }
+
+    void runTest() override
+    {
+        rand = getRandom();
+
+        const auto metalFaceWeights = ModelWeights::fromBinary (BinaryData::metal_face_model_bin, (size_t) BinaryData::metal_face_model_binSize);
+        const auto guitarMLWeights = ModelWeights::fromBinary (BinaryData::BluesJrAmp_VolKnob_bin, (size_t) BinaryData::BluesJrAmp_VolKnob_binSize);
+
+        beginTest ("Instruction Set Equivalence Test (Metal Face)");
+        instructionSetTest<MetalFaceModels> (*metalFaceWeights,
+                                             [] (auto& model, AudioBuffer<float>& buffer)
+                                             {
+                                                 model.prepare (2);
+                                                 model.process ({ buffer.getWritePointer (0), (size_t) numTestSamples },
+                                                                { buffer.getWritePointer (1), (size_t) numTestSamples });
+                                             });
+
+        beginTest ("Instruction Set Equivalence Test (GuitarML)");
+        const auto conditionBuffer = createTestBuffer (1);
+        instructionSetTest<GuitarMLModels> (*guitarMLWeights,
+                                            [&conditionBuffer] (auto& model, AudioBuffer<float>& buffer)
+                                            {
+                                                model.prepare (2.5f);
+                                                model.process_conditioned ({ buffer.getWritePointer (0), (size_t) numTestSamples },
+                                                                           { buffer.getWritePointer (1), (size_t) numTestSamples },
+                                                                           { conditionBuffer.getReadPointer (0), (size_t) numTestSamples },
+                                                                           true);
+                                            });
+
+        beginTest ("Stereo/Mono Equivalence Test");
+        stereoMatchesMonoTest (*metalFaceWeights);
+    }
+
+private:
+    Random rand;
+};
+
+static RNNAcceleratedTest rnnAcceleratedTest;
@@ -0,0 +1,74 @@
+#include "UnitTests.h"
+
+namespace
+{
+constexpr double testSampleRate = 48000.0;
+constexpr int testBlockSize = 1024;
+constexpr double maxTestTailSeconds = 30.0;
+} // namespace
+
+class SleepTest : public UnitTest
+{
+public:
+    SleepTest() : UnitTest ("Sleep Test")
+    {
+    }
+
+    void processNoise (BaseProcessor* proc, AudioBuffer<float>& buffer)
+    {
+        buffer.setSize (1, testBlockSize);
+        for (int n = 0; n < testBlockSize; ++n)
+            buffer.setSample (0, n, rand.nextFloat() * 2.0f - 1.0f);
+
+        proc->processAudioBlock (buffer);
+    }
+
+    void processSilence (BaseProcessor* proc, AudioBuffer<float>& buffer)
+    {
+        buffer.setSize (1, testBlockSize);
+        buffer.clear();
+        proc->processAudioBlock (buffer);
+    }
+
+    static float getMagnitude (BaseProcessor* proc, AudioBuffer<float>& buffer)
+    {
+        const auto* outBuffer = proc->getOutputBuffer() != nullptr ? proc->getOutputBuffer() : &buffer;
+        return outBuffer->getMagnitude (0, outBuffer->getNumSamples());
+    }
+
+    void runTest() override
+    {
+        rand = getRandom();
+        runTestForAllProcessors (this,
+                                 [&] (BaseProcessor* proc)
+                                 {
+                                     if (proc->getNumInputs() != 1 || proc->getNumOutputs() != 1)
+                                         return;
+
+                                     proc->prepareProcessing (testSampleRate, testBlockSize);
+                                     const auto tailSeconds = proc->getTailLengthSeconds();
+                                     if (! std::isfinite (tailSeconds) || tailSeconds > maxTestTailSeconds)
+                                         return;
+
+                                     AudioBuffer<float> buffer;
+                                     for (int i = 0; i < 10; ++i)
+                                         processNoise (proc, buffer);
+
+                                     // after the tail (plus a few extra seconds to let any filters settle), the processor should be asleep
+                                     const auto numSilentBlocks = (int) std::ceil ((tailSeconds + 5.0) * testSampleRate / (double) testBlockSize);
+                                     for (int i = 0; i < numSilentBlocks; ++i)
+                                         processSilence (proc, buffer);
+
+                                     expectEquals (getMagnitude (proc, buffer), 0.0f, "Processor output is not silent after its tail!");
+
+                                     // and once the input comes back, the processor should wake up again
+                                     processNoise (proc, buffer);
+                                     expectGreaterThan (getMagnitude (proc, buffer), 1.0e-6f, "Processor did not wake up!");
+                                 });
+    }
+
+private:
+    Random rand;
+};
+
+static SleepTest sleepTest;
@@ -5,8 +5,10 @@
  */
 
 // C++/STL headers here...
+#include <bit>
 #include <future>
 #include <random>
+#include <thread>
 #include <unordered_map>
 
 #include <magic_enum.hpp> // Needs to be included before JUCE
@@ -35,21 +35,26 @@ BaseProcessor::BaseProcessor (const String& name,
     outputBuffers.fill (nullptr);
     outputConnections.resize ((size_t) numOutputs);
 
-    inputBuffers.resize (numInputs);
-    inputsConnected.resize (0);
+    jassert (numInputs <= ConnectedPortSet::maxNumPorts);
     portMagnitudes.resize ((size_t) numInputs);
 }
 
 BaseProcessor::~BaseProcessor() = default;
 
-void BaseProcessor::prepareProcessing (double sampleRate, int numSamples)
+void BaseProcessor::prepareProcessing (double sampleRate, int numSamples, int chainOSFactor)
 {
+    chainOversamplingFactor = chainOSFactor;
     prepare (sampleRate, numSamples);
 
-    for (auto& b : inputBuffers)
+    sleepState = { sampleRate };
+    cpuMeter.prepare (sampleRate);
+
+    // Input ports read from buffers owned by the processing chain, so we only need a silent
+    // buffer for multi-input processors to read from if a port hasn't received any audio.
+    if (numInputs > 1)
     {
-        b.setSize (2, numSamples);
-        b.clear();
+        silentInputBuffer.setSize (2, numSamples);
+        silentInputBuffer.clear();
     }
 
     for (auto& mag : portMagnitudes)
@@ -60,15 +65,45 @@ void BaseProcessor::prepareProcessing (double sampleRate, int numSamples)
     }
 }
 
+std::shared_ptr<const void> BaseProcessor::getSteadyStateSnapshot (const String& key) const
+{
+    const ScopedLock sl (steadyStateCache->lock);
+    const auto snapshotIter = steadyStateCache->snapshots.find (key);
+    if (snapshotIter == steadyStateCache->snapshots.end())
+        return {};
+
+    return snapshotIter->second;
+}
+
+void BaseProcessor::addSteadyStateSnapshot (const String& key, std::shared_ptr<const void> snapshot)
+{
+    const ScopedLock sl (steadyStateCache->lock);
+    steadyStateCache->snapshots[key] = std::move (snapshot);
+}
+
+double BaseProcessor::getInternalResamplingRatio (double sampleRate, double targetSampleRate) const noexcept
+{
+    auto ratio = 1.0;
+    while (sampleRate * ratio < targetSampleRate)
+        ratio *= 2.0;
+
+    const auto minRatio = 1.0 / (double) chainOversamplingFactor;
+    while (ratio * 0.5 >= minRatio && sampleRate * ratio * 0.5 >= targetSampleRate)
+        ratio *= 0.5;
+
+    return ratio;
+}
+
 void BaseProcessor::freeInternalMemory()
 {
     releaseMemory();
-    for (auto& b : inputBuffers)
-        b.setSize (0, 0);
+    silentInputBuffer.setSize (0, 0);
 }
 
 void BaseProcessor::processAudioBlock (AudioBuffer<float>& buffer)
 {
+    ProcessorCPUMeter::ScopedTimer cpuTimer { cpuMeter, buffer.getNumSamples() };
+
     auto updateBufferMag = [&] (const AudioBuffer<float>& inBuffer, int inputIndex)
     {
         const auto inBufferNumChannels = inBuffer.getNumChannels();
@@ -96,7 +131,10 @@ void BaseProcessor::processAudioBlock (AudioBuffer<float>& buffer)
         else if (numInputs > 1)
         {
             for (int i = 0; i < numInputs; ++i)
-                updateBufferMag (getInputBuffer (i), i);
+            {
+                if (inputsConnected.contains (i))
+                    updateBufferMag (getInputBuffer (i), i);
+            }
         }
     }
 
@@ -110,9 +148,59 @@ void BaseProcessor::processAudioBlock (AudioBuffer<float>& buffer)
     }
 
     if (isBypassed())
+    {
+        sleepState = { sleepState.sampleRate };
         processAudioBypassed (buffer);
-    else
-        processAudio (buffer);
+        return;
+    }
+
+    const auto numSamples = buffer.getNumSamples();
+    const auto inputIsSilent = canSleep() && isBufferSilent (buffer);
+    if (inputIsSilent)
+    {
+        sleepState.numSilentSamples += numSamples;
+        if (sleepState.isAsleep)
+        {
+            buffer.setSize (sleepState.numOutputChannels, numSamples, false, false, true);
+            buffer.clear();
+            outputBuffers.getReference (0) = &buffer;
+            return;
+        }
+    }
+    else if (sleepState.numSilentSamples > 0)
+    {
+        if (sleepState.isAsleep) // the processor may not set its own output buffer
+            outputBuffers.getReference (0) = nullptr;
+
+        sleepState = { sleepState.sampleRate };
+    }
+
+    processAudio (buffer);
+
+    // once the tail has finished, we can go to sleep as soon as the output is silent as well
+    if (inputIsSilent && (double) sleepState.numSilentSamples > getTailLengthSeconds() * sleepState.sampleRate)
+    {
+        const auto* outBuffer = outputBuffers[0] != nullptr ? outputBuffers[0] : &buffer;
+        sleepState.isAsleep = isBufferSilent (*outBuffer);
+        sleepState.numOutputChannels = outBuffer->getNumChannels();
+    }
+}
+
+bool BaseProcessor::canSleep() const
+{
+    return numInputs == 1 && numOutputs == 1 && std::isfinite (getTailLengthSeconds());
+}
+
+bool BaseProcessor::isBufferSilent (const AudioBuffer<float>& buffer) noexcept
+{
+    const auto silenceThresholdGain = Decibels::decibelsToGain (silenceThresholdDB);
+    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+    {
+        if (buffer.getMagnitude (ch, 0, buffer.getNumSamples()) >= silenceThresholdGain)
+            return false;
+    }
+
+    return true;
 }
 
 float BaseProcessor::getInputLevelDB (int portIndex) const noexcept
@@ -213,7 +301,8 @@ void BaseProcessor::addConnection (ConnectionInfo&& info)
 
     // make sure the end processor actually has an input port available that we can connect to!
     jassert (info.endProc->inputsConnected.size() + 1 <= info.endProc->numInputs);
-    info.endProc->inputsConnected.addUsingDefaultSort (info.endPort);
+
+    info.endProc->inputsConnected.add (info.endPort);
     info.endProc->inputConnectionChanged (info.endPort, true);
 }
 
@@ -227,8 +316,7 @@ void BaseProcessor::removeConnection (const ConnectionInfo& info)
         if (connections[cIdx].endProc == info.endProc && connections[cIdx].endPort == info.endPort)
         {
             connections.remove (cIdx);
-            info.endProc->inputsConnected.removeFirstMatchingValue (info.endPort);
-            info.endProc->inputBuffers[info.endPort].clear();
+            info.endProc->inputsConnected.remove (info.endPort);
             info.endProc->inputConnectionChanged (info.endPort, false);
             break;
         }
@@ -379,7 +467,7 @@ juce::Point<int> BaseProcessor::getPosition (Rectangle<int> parentBounds)
     return (editorPosition * juce::Point { (float) parentBounds.getWidth(), (float) parentBounds.getHeight() }).toInt();
 }
 
-bool BaseProcessor::isOutputModulationPortConnected()
+bool BaseProcessor::isOutputModulationPortConnected() const
 {
     if (getProcessorType() != Modulation)
         return false;
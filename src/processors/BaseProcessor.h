@@ -1,6 +1,7 @@
 #pragma once
 
 #include "JuceProcWrapper.h"
+#include "ProcessorCPUMeter.h"
 
 enum ProcessorType
 {
@@ -47,6 +48,36 @@ struct ConnectionInfo
     int endPort;
 };
 
+/**
+ * The set of input ports on a processor that currently have a connection.
+ * Connections are changed on the message thread, but the set can safely be
+ * read from the audio thread.
+ */
+class ConnectedPortSet
+{
+public:
+    ConnectedPortSet() = default;
+
+    bool contains (int portIndex) const noexcept { return (mask.load() & getPortBit (portIndex)) != 0; }
+    int size() const noexcept { return std::popcount (mask.load()); }
+
+    void add (int portIndex) noexcept { mask.fetch_or (getPortBit (portIndex)); }
+    void remove (int portIndex) noexcept { mask.fetch_and (~getPortBit (portIndex)); }
+
+    static constexpr int maxNumPorts = 32;
+
+private:
+    static uint32_t getPortBit (int portIndex) noexcept
+    {
+        jassert (isPositiveAndBelow (portIndex, maxNumPorts));
+        return (uint32_t) 1 << portIndex;
+    }
+
+    std::atomic<uint32_t> mask { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE (ConnectedPortSet)
+};
+
 namespace base_processor_detail
 {
 using PortTypesVector = chowdsp::SmallVector<PortType, 4>;
@@ -105,12 +136,45 @@ public:
     virtual ProcessorType getProcessorType() const = 0;
     const String getName() const override { return JuceProcWrapper::getName(); }
 
+    /**
+     * Linear modules (filters, convolution, delays, etc.) don't generate any new harmonics,
+     * so they don't benefit from running at the oversampled rate. Those modules should
+     * override this method to return false, and the processor chain will run them at the
+     * base sample rate, resampling the signal as needed on the way in and out.
+     *
+     * Standalone modulation sources should always be processed at the oversampled rate.
+     */
+    virtual bool needsOversampling() const { return true; }
+
+    /**
+     * Returns how long the module keeps producing output after its input goes silent.
+     *
+     * Modules with a finite tail length are put to sleep once their input has been silent
+     * for longer than the tail, and their output has gone silent as well. While a module is
+     * asleep, it outputs silence without being processed, until its input comes back.
+     *
+     * Memoryless modules (or modules with only a very short memory, like most drives) can
+     * return zero, while delays and reverbs should return the time it takes for their output
+     * to decay below silenceThresholdDB. By default, modules are assumed to have an infinite
+     * tail, so they are never put to sleep. Multi-input or multi-output modules never sleep.
+     */
+    double getTailLengthSeconds() const override { return std::numeric_limits<double>::infinity(); }
+
+    /** Signals that stay below this level are considered silent. */
+    static constexpr float silenceThresholdDB = -90.0f;
+
+    /** Returns true if all the channels in the buffer are below the silence threshold. */
+    static bool isBufferSilent (const AudioBuffer<float>& buffer) noexcept;
+
     // audio processing methods
     bool isBypassed() const { return ! static_cast<bool> (onOffParam->load()); }
-    void prepareProcessing (double sampleRate, int numSamples);
+    void prepareProcessing (double sampleRate, int numSamples, int chainOversamplingFactor = 1);
     void freeInternalMemory();
     void processAudioBlock (AudioBuffer<float>& buffer);
 
+    /** Returns the meter that keeps track of how long the processor takes to process each block. */
+    const ProcessorCPUMeter& getCPUMeter() const noexcept { return cpuMeter; }
+
     // methods for working with port input levels
     float getInputLevelDB (int portIndex) const noexcept;
     void resetPortMagnitudes (bool shouldPortMagsBeOn);
@@ -159,18 +223,20 @@ public:
     /** Returns the netlist circuit quantities, or nullptr if the processor has no circuit quantities. */
     auto* getNetlistCircuitQuantities() { return netlistCircuitQuantities.get(); }
 
-    const AudioBuffer<float>& getInputBuffer (int idx = 0) const { return inputBuffers.getReference (idx); }
-    AudioBuffer<float>& getInputBufferNonConst (int idx = 0) { return inputBuffers.getReference (idx); } // Most derived classes should never use this!
+    const AudioBuffer<float>& getInputBuffer (int idx = 0) const
+    {
+        jassert (idx < numInputs);
+        if (inputBuffers == nullptr || inputBuffers[idx] == nullptr)
+            return silentInputBuffer;
+        return *inputBuffers[idx];
+    }
     AudioBuffer<float>* getOutputBuffer (int idx = 0) { return outputBuffers[idx]; }
+
     const ConnectionInfo& getOutputConnection (int portIdx, int connectionIdx) const { return outputConnections[(size_t) portIdx].getReference (connectionIdx); }
 
     int getNumOutputConnections (int portIdx) const { return outputConnections[(size_t) portIdx].size(); }
     int getNumInputConnections() const { return inputsConnected.size(); }
 
-    int incrementNumInputsReady() { return numInputsReady++; }
-    int getNumInputsReady() const { return numInputsReady; }
-    void clearNumInputsReady() { numInputsReady = 0; }
-
     void addConnection (ConnectionInfo&& info);
     void removeConnection (const ConnectionInfo& info);
     virtual void inputConnectionChanged (int /*portIndex*/, bool /*wasConnected*/) {}
@@ -186,7 +252,7 @@ public:
 
     const auto& getParameters() const { return AudioProcessor::getParameters(); }
 
-    bool isOutputModulationPortConnected();
+    bool isOutputModulationPortConnected() const;
     const std::vector<String>* getParametersToDisableWhenInputIsConnected (int portIndex) const noexcept;
     const std::vector<String>* getParametersToEnableWhenInputIsConnected (int portIndex) const noexcept;
 
@@ -197,6 +263,14 @@ public:
      */
     const MidiBuffer* midiBuffer = nullptr;
 
+    /**
+     * Buffers for each input port, owned by the processor chain's execution plan (see getInputBuffer()).
+     * The buffers are read-only, since they may be shared with other processors, and a null buffer
+     * means that the port hasn't received any audio. Like the MIDI buffer, this is only non-null
+     * while the processor chain is processing the processor.
+     */
+    const AudioBuffer<float>* const* inputBuffers = nullptr;
+
     /** Returns a tooltip string for a given port. */
     virtual String getTooltipForPort (int portIndex, bool isInput);
 
@@ -227,6 +301,48 @@ protected:
      */
     void enableWhenInputConnected (const std::initializer_list<String>& paramIDs, int inputPortIndex);
 
+    /** Returns the factor by which the processor chain is oversampling this processor. */
+    int getChainOversamplingFactor() const noexcept { return chainOversamplingFactor; }
+
+    /**
+     * Modules that resample internally can use this to choose their internal resampling ratio.
+     * Returns the power-of-two ratio that takes the sample rate up to at least the target sample rate.
+     * If the processor chain is already oversampling by more than the module needs, the ratio will be
+     * less than one (but never below the chain's base sample rate), so that the module can downsample,
+     * rather than stacking another stage of oversampling on top of the chain's.
+     */
+    double getInternalResamplingRatio (double sampleRate, double targetSampleRate) const noexcept;
+
+    /**
+     * Modules that need to process some silence after being prepared, so that their state
+     * can settle (e.g. neural networks, or circuit models with large capacitors), can call
+     * this at the end of prepare(), rather than pre-buffering every time.
+     *
+     * The first time that a module is prepared with a given sample rate and key, preBuffer()
+     * is called, and then a "steady-state snapshot" of the given state objects is cached for
+     * the whole process. After that, any module of the same type that is prepared with the
+     * same sample rate and key will have its state objects restored from the snapshot instead.
+     *
+     * The key should describe anything else that the settled state depends on (e.g. which
+     * model the module has loaded). The state objects must be copy-assignable, and should
+     * not contain any settings that depend on anything other than the sample rate and key.
+     */
+    template <typename PreBufferFunc, typename... StateTypes>
+    void prepareSteadyState (double sampleRate, const String& key, PreBufferFunc&& preBuffer, StateTypes&... stateObjects)
+    {
+        using Snapshot = std::tuple<StateTypes...>;
+        const auto snapshotKey = getName() + "|" + key + "|" + String (sampleRate) + "|" + String (chainOversamplingFactor);
+
+        if (const auto snapshot = getSteadyStateSnapshot (snapshotKey))
+        {
+            std::tie (stateObjects...) = *static_cast<const Snapshot*> (snapshot.get());
+            return;
+        }
+
+        preBuffer();
+        addSteadyStateSnapshot (snapshotKey, std::make_shared<const Snapshot> (stateObjects...));
+    }
+
     /** 
      * All modulation signals should be in the range of [-1,1],
      * they can then be modified as needed by the individual module.
@@ -236,7 +352,7 @@ protected:
     ProcessorUIOptions uiOptions;
 
     Array<AudioBuffer<float>*> outputBuffers;
-    Array<int> inputsConnected;
+    ConnectedPortSet inputsConnected;
 
     chowdsp::SharedLNFAllocator lnfAllocator;
     Component::SafePointer<ProcessorEditor> editor {};
@@ -244,13 +360,6 @@ protected:
     std::unique_ptr<Component> netlistWindow {};
     std::unique_ptr<netlist::CircuitQuantityList> netlistCircuitQuantities {};
 
-    /**
-     * If your processor uses convolution, you can use this shared
-     * messaging queue to avoid creating a new background thread
-     * for each instance.
-     */
-    auto& getSharedConvolutionMessageQueue() { return convolutionMessageQueue.get(); }
-
     enum class BasicInputPort
     {
         AudioInput,
@@ -271,21 +380,24 @@ private:
                    UndoManager* um);
 
     std::atomic<float>* onOffParam = nullptr;
+    int chainOversamplingFactor = 1;
 
     const int numInputs {};
     const int numOutputs {};
 
     std::vector<Array<ConnectionInfo>> outputConnections;
-    Array<AudioBuffer<float>> inputBuffers;
-    int numInputsReady = 0;
+    AudioBuffer<float> silentInputBuffer;
 
     juce::Point<float> editorPosition;
 
-    struct ConvolutionMessageQueue : public dsp::ConvolutionMessageQueue
+    struct SteadyStateCache
     {
-        ConvolutionMessageQueue() : dsp::ConvolutionMessageQueue (2048) {}
+        CriticalSection lock;
+        std::map<String, std::shared_ptr<const void>> snapshots;
     };
-    SharedResourcePointer<ConvolutionMessageQueue> convolutionMessageQueue;
+    SharedResourcePointer<SteadyStateCache> steadyStateCache;
+    std::shared_ptr<const void> getSteadyStateSnapshot (const String& key) const;
+    void addSteadyStateSnapshot (const String& key, std::shared_ptr<const void> snapshot);
 
     struct PortMagnitude
     {
@@ -299,6 +411,19 @@ private:
     bool portMagnitudesOn = false;
     std::vector<PortMagnitude> portMagnitudes;
 
+    struct SleepState
+    {
+        double sampleRate = 48000.0;
+        int64_t numSilentSamples = 0;
+        int numOutputChannels = 1;
+        bool isAsleep = false;
+    };
+
+    SleepState sleepState;
+    bool canSleep() const;
+
+    ProcessorCPUMeter cpuMeter;
+
     StringArray popupMenuParameterIDs;
     OwnedArray<ParameterAttachment> popupMenuParameterAttachments;
 
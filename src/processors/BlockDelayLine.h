@@ -0,0 +1,244 @@
+#pragma once
+
+#include <pch.h>
+
+/**
+ * A multi-channel delay line with 5th-order Lagrange interpolation (the same
+ * interpolation as chowdsp::DelayLineInterpolationTypes::Lagrange5th), which
+ * can be read and written a block at a time.
+ *
+ * A block can be read in one go as long as none of the samples being read are
+ * written during that block, so the block must be shorter than the delay (see
+ * getMaxBlockSize()). When the delay time is constant, the interpolation
+ * coefficients only need to be computed once, and the block is read as a
+ * weighted sum of six contiguous slices of the delay buffer. When the delay
+ * time is changing, the coefficients are computed for several samples at once.
+ *
+ * For delays that are too short to be processed in blocks, processLanes() reads
+ * and writes one sample at a time, with each channel of the delay line in its
+ * own SIMD lane, so that all of the channels are interpolated at once.
+ */
+class BlockDelayLine
+{
+public:
+    using Vec = xsimd::batch<float>;
+    static constexpr int vecSize = (int) Vec::size;
+
+    BlockDelayLine() = default;
+
+    /** Allocates the delay line */
+    void prepare (int numChannels, int maxDelaySamples)
+    {
+        maxDelay = (float) maxDelaySamples;
+        bufferSize = maxDelaySamples + numInterpolationPoints + 2;
+
+        buffers.resize ((size_t) numChannels);
+        for (auto& buffer : buffers)
+            buffer.assign (2 * (size_t) bufferSize, 0.0f);
+
+        writeIndex = 0;
+    }
+
+    /** Clears the delay line */
+    void reset()
+    {
+        for (auto& buffer : buffers)
+            std::fill (buffer.begin(), buffer.end(), 0.0f);
+
+        writeIndex = 0;
+    }
+
+    /** Frees the memory used by the delay line */
+    void free()
+    {
+        buffers.clear();
+        writeIndex = 0;
+    }
+
+    /**
+     * Returns the largest number of samples that can be read, and then written,
+     * as a single block, when the delay is at least minDelaySamples. If this is
+     * zero, the delay line should be processed one sample at a time, which (like
+     * chowdsp::DelayLine) reads the sample before the next one is written.
+     */
+    [[nodiscard]] static int getMaxBlockSize (float minDelaySamples) noexcept
+    {
+        int delayInt;
+        float delayFrac;
+        splitDelay (minDelaySamples, delayInt, delayFrac);
+        return delayInt;
+    }
+
+    /** Reads a block from the delay line, with a constant delay time. Call advance() once all the channels have been written. */
+    void read (int channel, float* output, int numSamples, float delaySamples) const noexcept
+    {
+        int delayInt;
+        float delayFrac;
+        splitDelay (jlimit (0.0f, maxDelay, delaySamples), delayInt, delayFrac);
+        jassert (numSamples <= jmax (1, delayInt)); // the samples being read must already have been written!
+
+        float coefs[numInterpolationPoints];
+        getInterpolationCoefficients (delayFrac, coefs);
+
+        const auto* delayData = buffers[(size_t) channel].data() + writeIndex + bufferSize - delayInt;
+        FloatVectorOperations::multiply (output, delayData, coefs[0], numSamples);
+        for (int k = 1; k < numInterpolationPoints; ++k)
+            FloatVectorOperations::addWithMultiply (output, delayData - k, coefs[k], numSamples);
+    }
+
+    /** Reads a block from the delay line, with a different delay time for each sample. Call advance() once all the channels have been written. */
+    void read (int channel, float* output, int numSamples, const float* delaySamples) const noexcept
+    {
+        const auto* delayData = buffers[(size_t) channel].data() + writeIndex + bufferSize;
+
+        alignas (Vec::arch_type::alignment()) float delayInts[vecSize] {};
+        alignas (Vec::arch_type::alignment()) float points[numInterpolationPoints][vecSize] {};
+        alignas (Vec::arch_type::alignment()) float outData[vecSize] {};
+        for (int start = 0; start < numSamples; start += vecSize)
+        {
+            const auto numLanes = jmin (vecSize, numSamples - start);
+            std::copy (delaySamples + start, delaySamples + start + numLanes, delayInts);
+
+            Vec delayInt, delayFrac;
+            splitDelay (clampDelay (xsimd::load_aligned (delayInts)), delayInt, delayFrac);
+            delayInt.store_aligned (delayInts);
+
+            for (int lane = 0; lane < numLanes; ++lane)
+            {
+                const auto* laneData = delayData + start + lane - (int) delayInts[lane];
+                jassert (start + lane < jmax (1, (int) delayInts[lane])); // the samples being read must already have been written!
+
+                for (int k = 0; k < numInterpolationPoints; ++k)
+                    points[k][lane] = laneData[-k];
+            }
+
+            interpolate (points, delayFrac).store_aligned (outData);
+            std::copy (outData, outData + numLanes, output + start);
+        }
+    }
+
+    /** Writes a block to the delay line. Call advance() once all the channels have been written. */
+    void write (int channel, const float* input, int numSamples) noexcept
+    {
+        jassert (numSamples <= bufferSize);
+
+        auto* data = buffers[(size_t) channel].data();
+        const auto numBeforeWrap = jmin (numSamples, bufferSize - writeIndex);
+        for (auto* dest : { data + writeIndex, data + writeIndex + bufferSize })
+            std::copy (input, input + numBeforeWrap, dest);
+
+        for (auto* dest : { data, data + bufferSize })
+            std::copy (input + numBeforeWrap, input + numSamples, dest);
+    }
+
+    /** Moves the write position forward, after a block has been read and written. */
+    void advance (int numSamples) noexcept
+    {
+        writeIndex = (writeIndex + numSamples) % bufferSize;
+    }
+
+    /**
+     * Writes one sample to each channel of the delay line, and then reads one
+     * sample from each channel with its own delay time. A delay of zero returns
+     * the input sample. Lanes past the number of channels are ignored.
+     */
+    inline Vec processLanes (const Vec& input, const Vec& delaySamples) noexcept
+    {
+        const auto numLanes = jmin (vecSize, (int) buffers.size());
+
+        alignas (Vec::arch_type::alignment()) float laneData[vecSize];
+        input.store_aligned (laneData);
+        for (int lane = 0; lane < numLanes; ++lane)
+        {
+            auto* data = buffers[(size_t) lane].data();
+            data[writeIndex] = laneData[lane];
+            data[writeIndex + bufferSize] = laneData[lane];
+        }
+
+        Vec delayInt, delayFrac;
+        splitDelay (clampDelay (delaySamples), delayInt, delayFrac);
+        delayInt.store_aligned (laneData);
+
+        alignas (Vec::arch_type::alignment()) float points[numInterpolationPoints][vecSize] {};
+        for (int lane = 0; lane < numLanes; ++lane)
+        {
+            const auto* laneDelayData = buffers[(size_t) lane].data() + writeIndex + bufferSize - (int) laneData[lane];
+            for (int k = 0; k < numInterpolationPoints; ++k)
+                points[k][lane] = laneDelayData[-k];
+        }
+
+        writeIndex = writeIndex + 1 == bufferSize ? 0 : writeIndex + 1;
+        return interpolate (points, delayFrac);
+    }
+
+private:
+    static constexpr int numInterpolationPoints = 6;
+
+    inline Vec clampDelay (const Vec& delaySamples) const noexcept
+    {
+        return xsimd::min (xsimd::max (delaySamples, Vec (0.0f)), Vec (maxDelay));
+    }
+
+    /**
+     * Splits the delay into integer and fractional parts. Like chowdsp's Lagrange
+     * interpolator, the interpolation points are centred around the delay time
+     * when possible.
+     */
+    template <typename T>
+    static void splitDelay (T delaySamples, T& delayInt, T& delayFrac) noexcept
+    {
+        delayInt = xsimd::floor (delaySamples);
+        delayFrac = delaySamples - delayInt;
+
+        const auto offset = xsimd::select (delayInt >= T (2.0f), T (2.0f), T (0.0f));
+        delayInt -= offset;
+        delayFrac += offset;
+    }
+
+    static void splitDelay (float delaySamples, int& delayInt, float& delayFrac) noexcept
+    {
+        delayInt = (int) delaySamples;
+        delayFrac = delaySamples - (float) delayInt;
+
+        if (delayInt >= 2)
+        {
+            delayInt -= 2;
+            delayFrac += 2.0f;
+        }
+    }
+
+    template <typename T>
+    static void getInterpolationCoefficients (T delayFrac, T (&coefs)[numInterpolationPoints]) noexcept
+    {
+        const auto d1 = delayFrac - 1.0f;
+        const auto d2 = delayFrac - 2.0f;
+        const auto d3 = delayFrac - 3.0f;
+        const auto d4 = delayFrac - 4.0f;
+        const auto d5 = delayFrac - 5.0f;
+
+        coefs[0] = -d1 * d2 * d3 * d4 * d5 * (1.0f / 120.0f);
+        coefs[1] = delayFrac * d2 * d3 * d4 * d5 * (1.0f / 24.0f);
+        coefs[2] = -delayFrac * d1 * d3 * d4 * d5 * (1.0f / 12.0f);
+        coefs[3] = delayFrac * d1 * d2 * d4 * d5 * (1.0f / 12.0f);
+        coefs[4] = -delayFrac * d1 * d2 * d3 * d5 * (1.0f / 24.0f);
+        coefs[5] = delayFrac * d1 * d2 * d3 * d4 * (1.0f / 120.0f);
+    }
+
+    static Vec interpolate (const float (&points)[numInterpolationPoints][vecSize], const Vec& delayFrac) noexcept
+    {
+        Vec coefs[numInterpolationPoints];
+        getInterpolationCoefficients (delayFrac, coefs);
+
+        auto y = xsimd::load_aligned (points[0]) * coefs[0];
+        for (int k = 1; k < numInterpolationPoints; ++k)
+            y = xsimd::fma (xsimd::load_aligned (points[k]), coefs[k], y);
+        return y;
+    }
+
+    std::vector<std::vector<float>> buffers;
+    int bufferSize = 0;
+    int writeIndex = 0;
+    float maxDelay = 0.0f;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BlockDelayLine)
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <pch.h>
+
+/**
+ * Resamples a module's audio to and from the sample rate that the module
+ * uses for its internal processing, either by upsampling (ratio > 1), or by
+ * downsampling (ratio < 1) if the processor chain is already oversampling
+ * by more than the module needs.
+ *
+ * The resampling ratio should be a power of two, as returned by
+ * BaseProcessor::getInternalResamplingRatio().
+ */
+template <typename FilterType>
+class InternalResampler
+{
+public:
+    InternalResampler() = default;
+
+    void prepare (double sampleRate, int samplesPerBlock, double resampleRatio, int numChannels = 2)
+    {
+        ratio = resampleRatio;
+        factor = ratio >= 1.0 ? (int) ratio : roundToInt (1.0 / ratio);
+        jassert (isPowerOfTwo (factor));
+
+        if (ratio > 1.0)
+        {
+            upsampler.prepare ({ sampleRate, (uint32) samplesPerBlock, (uint32) numChannels }, factor);
+            downsampler.prepare ({ sampleRate * factor, (uint32) (samplesPerBlock * factor), (uint32) numChannels }, factor);
+        }
+        else if (ratio < 1.0)
+        {
+            downsampler.prepare ({ sampleRate, (uint32) samplesPerBlock, (uint32) numChannels }, factor);
+            upsampler.prepare ({ sampleRate / factor, (uint32) (samplesPerBlock / factor), (uint32) numChannels }, factor);
+        }
+
+        internalBuffer.setSize (numChannels, jmax (1, (int) std::ceil (samplesPerBlock * ratio)));
+    }
+
+    /** Returns the ratio between the internal sample rate and the module's sample rate. */
+    [[nodiscard]] double getRatio() const noexcept { return ratio; }
+
+    /** Returns a buffer containing the audio at the internal sample rate. */
+    AudioBuffer<float>& processIn (AudioBuffer<float>& buffer)
+    {
+        if (ratio == 1.0)
+            return buffer;
+
+        const auto numChannels = buffer.getNumChannels();
+        const auto numSamples = buffer.getNumSamples();
+        jassert (ratio > 1.0 || numSamples % factor == 0);
+
+        internalBuffer.setSize (numChannels, ratio > 1.0 ? numSamples * factor : numSamples / factor, false, false, true);
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            if (ratio > 1.0)
+                upsampler.process (buffer.getReadPointer (ch), internalBuffer.getWritePointer (ch), ch, numSamples);
+            else
+                downsampler.process (buffer.getReadPointer (ch), internalBuffer.getWritePointer (ch), ch, numSamples);
+        }
+
+        return internalBuffer;
+    }
+
+    /** Resamples the internal buffer back to the module's sample rate. */
+    void processOut (const AudioBuffer<float>& internal, AudioBuffer<float>& buffer)
+    {
+        if (ratio == 1.0)
+        {
+            jassert (&internal == &buffer);
+            return;
+        }
+
+        const auto numChannels = internal.getNumChannels();
+        const auto numInternalSamples = internal.getNumSamples();
+        buffer.setSize (numChannels, ratio > 1.0 ? numInternalSamples / factor : numInternalSamples * factor, false, false, true);
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            if (ratio > 1.0)
+                downsampler.process (internal.getReadPointer (ch), buffer.getWritePointer (ch), ch, numInternalSamples);
+            else
+                upsampler.process (internal.getReadPointer (ch), buffer.getWritePointer (ch), ch, numInternalSamples);
+        }
+    }
+
+private:
+    chowdsp::Upsampler<float, FilterType, false> upsampler;
+    chowdsp::Downsampler<float, FilterType, false> downsampler;
+    AudioBuffer<float> internalBuffer;
+
+    double ratio = 1.0;
+    int factor = 1;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (InternalResampler)
+};
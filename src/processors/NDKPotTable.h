@@ -0,0 +1,102 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+#include <modules/Eigen/Eigen/Dense>
+
+/**
+ * A table of NDK matrices, computed over a dense grid of positions for one of
+ * the circuit's pots. Interpolating between the pre-computed matrices is much
+ * cheaper than re-computing them for every sub-block as the pot moves.
+ *
+ * The table is computed using the same formulas as the model's update_pots()
+ * method. The matrices for the constant voltage sources are stored without
+ * the source voltages applied, so that the model can still change its supply
+ * voltage after the table has been computed.
+ */
+template <int num_pots, int num_states, int num_nl_ports, int num_outputs, int num_voltages_variable, int num_voltages_constant>
+class NDKPotTable
+{
+public:
+    using T = double;
+    static constexpr int num_voltages = num_voltages_variable + num_voltages_constant;
+    static constexpr size_t table_size = 257;
+
+    /** Returns true if the table has been computed. */
+    [[nodiscard]] bool is_ready() const noexcept { return ! entries.empty(); }
+
+    /** Clears the table. */
+    void clear() { entries.clear(); }
+
+    /**
+     * Computes the table from the model's intermediate NDK matrices.
+     *
+     * get_pot_values (position) should return the values of the
+     * model's variable resistors for a pot position in the range [0, 1].
+     */
+    template <typename ModelType, typename GetPotValuesFunc>
+    void compute (const ModelType& model, GetPotValuesFunc&& get_pot_values)
+    {
+        entries.resize (table_size);
+        for (size_t i = 0; i < table_size; ++i)
+        {
+            const auto pot_values = get_pot_values ((T) i / (T) (table_size - 1));
+            const Eigen::Vector<T, num_pots> Rv_diag = Eigen::Map<const Eigen::Vector<T, num_pots>> (pot_values.data());
+            const Eigen::Matrix<T, num_pots, num_pots> Rv_Q_inv = (Eigen::Matrix<T, num_pots, num_pots> (Rv_diag.asDiagonal()) + model.Q).inverse();
+
+            auto& entry = entries[i];
+            entry.A = model.A0_mat - (model.two_Z_Gx * (model.Ux * (Rv_Q_inv * model.Ux.transpose())));
+            entry.B = model.B0_mat - (model.two_Z_Gx * (model.Ux * (Rv_Q_inv * model.Uu.transpose())));
+            entry.C = model.C0_mat - (model.two_Z_Gx * (model.Ux * (Rv_Q_inv * model.Un.transpose())));
+            entry.D = model.D0_mat - (model.Uo * (Rv_Q_inv * model.Ux.transpose()));
+            entry.E = model.E0_mat - (model.Uo * (Rv_Q_inv * model.Uu.transpose()));
+            entry.F = model.F0_mat - (model.Uo * (Rv_Q_inv * model.Un.transpose()));
+            entry.G = model.G0_mat - (model.Un * (Rv_Q_inv * model.Ux.transpose()));
+            entry.H = model.H0_mat - (model.Un * (Rv_Q_inv * model.Uu.transpose()));
+            entry.K = model.K0_mat - (model.Un * (Rv_Q_inv * model.Un.transpose()));
+        }
+    }
+
+    /** Sets the model's NDK matrices for a pot position in the range [0, 1], by interpolating the table. */
+    template <typename ModelType>
+    void apply (ModelType& model, T position, const Eigen::Vector<T, num_voltages_constant>& u_fix) const noexcept
+    {
+        const auto table_position = std::clamp (position, (T) 0, (T) 1) * (T) (table_size - 1);
+        const auto index = std::min ((size_t) table_position, table_size - 2);
+        const auto frac = table_position - (T) index;
+
+        const auto& e0 = entries[index];
+        const auto& e1 = entries[index + 1];
+        const auto interp = [frac] (const auto& m0, const auto& m1)
+        { return m0 + frac * (m1 - m0); };
+
+        model.A_mat = interp (e0.A, e1.A);
+        model.B_mat_var = interp (e0.B.template leftCols<num_voltages_variable>(), e1.B.template leftCols<num_voltages_variable>());
+        model.B_u_fix = interp (e0.B.template rightCols<num_voltages_constant>(), e1.B.template rightCols<num_voltages_constant>()) * u_fix;
+        model.C_mat = interp (e0.C, e1.C);
+        model.D_mat = interp (e0.D, e1.D);
+        model.E_mat_var = interp (e0.E.template leftCols<num_voltages_variable>(), e1.E.template leftCols<num_voltages_variable>());
+        model.E_u_fix = interp (e0.E.template rightCols<num_voltages_constant>(), e1.E.template rightCols<num_voltages_constant>()) * u_fix;
+        model.F_mat = interp (e0.F, e1.F);
+        model.G_mat = interp (e0.G, e1.G);
+        model.H_mat_var = interp (e0.H.template leftCols<num_voltages_variable>(), e1.H.template leftCols<num_voltages_variable>());
+        model.H_u_fix = interp (e0.H.template rightCols<num_voltages_constant>(), e1.H.template rightCols<num_voltages_constant>()) * u_fix;
+        model.K_mat = interp (e0.K, e1.K);
+    }
+
+private:
+    struct Entry
+    {
+        Eigen::Matrix<T, num_states, num_states> A;
+        Eigen::Matrix<T, num_states, num_voltages> B;
+        Eigen::Matrix<T, num_states, num_nl_ports> C;
+        Eigen::Matrix<T, num_outputs, num_states> D;
+        Eigen::Matrix<T, num_outputs, num_voltages> E;
+        Eigen::Matrix<T, num_outputs, num_nl_ports> F;
+        Eigen::Matrix<T, num_nl_ports, num_states> G;
+        Eigen::Matrix<T, num_nl_ports, num_voltages> H;
+        Eigen::Matrix<T, num_nl_ports, num_nl_ports> K;
+    };
+
+    std::vector<Entry> entries;
+};
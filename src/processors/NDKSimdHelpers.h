@@ -0,0 +1,243 @@
+#pragma once
+
+#include <pch.h>
+
+/**
+ * Helpers for running the NDK circuit models on both channels
+ * of a stereo signal at once, with each channel in its own SIMD lane.
+ */
+namespace ndk_simd
+{
+using Batch = xsimd::batch<double>;
+using BatchBool = xsimd::batch_bool<double>;
+
+template <size_t Rows, size_t Cols>
+using BatchMatrix = std::array<std::array<Batch, Cols>, Rows>;
+
+/** Broadcasts each element of an Eigen matrix across the SIMD lanes. */
+template <typename MatrixType>
+auto broadcast (const MatrixType& mat) noexcept
+{
+    BatchMatrix<(size_t) MatrixType::RowsAtCompileTime, (size_t) MatrixType::ColsAtCompileTime> result;
+    for (size_t row = 0; row < result.size(); ++row)
+        for (size_t col = 0; col < result[row].size(); ++col)
+            result[row][col] = Batch (mat ((Eigen::Index) row, (Eigen::Index) col));
+    return result;
+}
+
+/** Loads one value per channel into the SIMD lanes. Any extra lanes duplicate the right channel. */
+inline Batch loadStereo (double left, double right) noexcept
+{
+    alignas (Batch::arch_type::alignment()) std::array<double, Batch::size> data;
+    data.fill (right);
+    data[0] = left;
+    return xsimd::load_aligned (data.data());
+}
+
+/** Returns the values from the left and right channel SIMD lanes. */
+inline std::pair<double, double> storeStereo (const Batch& x) noexcept
+{
+    alignas (Batch::arch_type::alignment()) std::array<double, Batch::size> data;
+    x.store_aligned (data.data());
+    return { data[0], data[1] };
+}
+
+/**
+ * Solves the 4x4 linear system m * x = b in each SIMD lane, using the
+ * closed-form inverse of the matrix (computed from its 2x2 minors).
+ */
+inline std::array<Batch, 4> solve4x4 (const BatchMatrix<4, 4>& m, const std::array<Batch, 4>& b) noexcept
+{
+    const auto& [m00, m01, m02, m03] = m[0];
+    const auto& [m10, m11, m12, m13] = m[1];
+    const auto& [m20, m21, m22, m23] = m[2];
+    const auto& [m30, m31, m32, m33] = m[3];
+
+    const auto s0 = m00 * m11 - m10 * m01;
+    const auto s1 = m00 * m12 - m10 * m02;
+    const auto s2 = m00 * m13 - m10 * m03;
+    const auto s3 = m01 * m12 - m11 * m02;
+    const auto s4 = m01 * m13 - m11 * m03;
+    const auto s5 = m02 * m13 - m12 * m03;
+
+    const auto c5 = m22 * m33 - m32 * m23;
+    const auto c4 = m21 * m33 - m31 * m23;
+    const auto c3 = m21 * m32 - m31 * m22;
+    const auto c2 = m20 * m33 - m30 * m23;
+    const auto c1 = m20 * m32 - m30 * m22;
+    const auto c0 = m20 * m31 - m30 * m21;
+
+    const auto inv_det = Batch (1.0) / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+    // rows of the adjugate matrix, multiplied by b
+    const auto x0 = (m11 * c5 - m12 * c4 + m13 * c3) * b[0]
+                    + (-m01 * c5 + m02 * c4 - m03 * c3) * b[1]
+                    + (m31 * s5 - m32 * s4 + m33 * s3) * b[2]
+                    + (-m21 * s5 + m22 * s4 - m23 * s3) * b[3];
+    const auto x1 = (-m10 * c5 + m12 * c2 - m13 * c1) * b[0]
+                    + (m00 * c5 - m02 * c2 + m03 * c1) * b[1]
+                    + (-m30 * s5 + m32 * s2 - m33 * s1) * b[2]
+                    + (m20 * s5 - m22 * s2 + m23 * s1) * b[3];
+    const auto x2 = (m10 * c4 - m11 * c2 + m13 * c0) * b[0]
+                    + (-m00 * c4 + m01 * c2 - m03 * c0) * b[1]
+                    + (m30 * s4 - m31 * s2 + m33 * s0) * b[2]
+                    + (-m20 * s4 + m21 * s2 - m23 * s0) * b[3];
+    const auto x3 = (-m10 * c3 + m11 * c1 - m12 * c0) * b[0]
+                    + (m00 * c3 - m01 * c1 + m02 * c0) * b[1]
+                    + (-m30 * s3 + m31 * s1 - m32 * s0) * b[2]
+                    + (m20 * s3 - m21 * s1 + m22 * s0) * b[3];
+
+    return { x0 * inv_det, x1 * inv_det, x2 * inv_det, x3 * inv_det };
+}
+
+/** Ebers-Moll parameters for one of the BJTs in an NDK model. */
+struct BJTParams
+{
+    double Is;
+    double BetaF;
+    double BetaR;
+    double Vt;
+};
+
+/**
+ * Processes both channels of a stereo signal through an NDK model with two BJTs
+ * (nonlinear ports 0-1 and 2-3), using the same Newton-Raphson solver as the
+ * model's single-channel process() method. Each channel stops updating once it
+ * has converged, same as the single-channel solver.
+ */
+template <int maxIterations, typename ModelType>
+void processStereoTwoBJTs (ModelType& model, const std::array<BJTParams, 2>& bjts, std::span<float> left_channel_data, std::span<float> right_channel_data) noexcept
+{
+    using T = typename ModelType::T;
+    static constexpr auto num_states = (size_t) ModelType::num_states;
+    static constexpr auto num_nl_ports = (size_t) ModelType::num_nl_ports;
+    static_assert (num_nl_ports == 4 && ModelType::num_voltages_variable == 1 && ModelType::num_outputs == 1);
+    jassert (left_channel_data.size() == right_channel_data.size());
+
+    const auto A = broadcast (model.A_mat);
+    const auto B_var = broadcast (model.B_mat_var);
+    const auto B_fix = broadcast (model.B_u_fix);
+    const auto C = broadcast (model.C_mat);
+    const auto D = broadcast (model.D_mat);
+    const auto E_var = broadcast (model.E_mat_var);
+    const auto E_fix = broadcast (model.E_u_fix);
+    const auto F = broadcast (model.F_mat);
+    const auto G = broadcast (model.G_mat);
+    const auto H_var = broadcast (model.H_mat_var);
+    const auto H_fix = broadcast (model.H_u_fix);
+    const auto K = broadcast (model.K_mat);
+
+    std::array<Batch, num_states> x;
+    for (size_t i = 0; i < num_states; ++i)
+        x[i] = loadStereo (model.x_n[0]((Eigen::Index) i), model.x_n[1]((Eigen::Index) i));
+
+    std::array<Batch, num_nl_ports> v;
+    for (size_t i = 0; i < num_nl_ports; ++i)
+        v[i] = loadStereo (model.v_n[0]((Eigen::Index) i), model.v_n[1]((Eigen::Index) i));
+
+    std::array<Batch, num_nl_ports> p_n;
+    std::array<Batch, num_nl_ports> i_n;
+    std::array<Batch, num_nl_ports> F_min;
+    BatchMatrix<num_nl_ports, num_nl_ports> A_solve;
+    BatchMatrix<num_nl_ports, 2> Jac; // the 2x2 Jacobian block for each BJT, stacked vertically
+    std::array<Batch, num_states> x_next;
+
+    for (size_t n = 0; n < left_channel_data.size(); ++n)
+    {
+        const auto u_n = loadStereo ((T) left_channel_data[n], (T) right_channel_data[n]);
+        for (size_t i = 0; i < num_nl_ports; ++i)
+        {
+            p_n[i] = H_var[i][0] * u_n + H_fix[i][0];
+            for (size_t j = 0; j < num_states; ++j)
+                p_n[i] += G[i][j] * x[j];
+        }
+
+        // BJT q uses ports 2q (base-emitter) and 2q + 1 (base-collector)
+        std::array<Batch, 2> exp_vbc_vbe;
+        std::array<Batch, 2> exp_mvbe;
+        const auto calc_currents = [&]
+        {
+            for (size_t q = 0; q < 2; ++q)
+            {
+                const auto& [Is, BetaF, BetaR, Vt] = bjts[q];
+                const auto AlphaF = (1.0 + BetaF) / BetaF;
+                exp_vbc_vbe[q] = xsimd::exp ((v[2 * q + 1] - v[2 * q]) / Vt);
+                exp_mvbe[q] = xsimd::exp (-v[2 * q] / Vt);
+                i_n[2 * q] = Is * ((exp_vbc_vbe[q] - (T) 1) / BetaF + (exp_mvbe[q] - (T) 1) / BetaR);
+                i_n[2 * q + 1] = -Is * (-(exp_mvbe[q] - (T) 1) + AlphaF * (exp_vbc_vbe[q] - (T) 1));
+            }
+        };
+
+        const auto calc_solve_matrix = [&]
+        {
+            // the Jacobian is block-diagonal, so we can compute K * Jac - I directly
+            for (size_t q = 0; q < 2; ++q)
+            {
+                const auto& [Is, BetaF, BetaR, Vt] = bjts[q];
+                const auto AlphaF = (1.0 + BetaF) / BetaF;
+                Jac[2 * q][0] = (Is / Vt) * (-exp_vbc_vbe[q] / BetaF - exp_mvbe[q] / BetaR);
+                Jac[2 * q][1] = (Is / Vt) * (exp_vbc_vbe[q] / BetaF);
+                Jac[2 * q + 1][0] = (Is / Vt) * (-exp_mvbe[q] + AlphaF * exp_vbc_vbe[q]);
+                Jac[2 * q + 1][1] = (Is / Vt) * (-AlphaF * exp_vbc_vbe[q]);
+            }
+
+            for (size_t i = 0; i < num_nl_ports; ++i)
+            {
+                A_solve[i][0] = K[i][0] * Jac[0][0] + K[i][1] * Jac[1][0];
+                A_solve[i][1] = K[i][0] * Jac[0][1] + K[i][1] * Jac[1][1];
+                A_solve[i][2] = K[i][2] * Jac[2][0] + K[i][3] * Jac[3][0];
+                A_solve[i][3] = K[i][2] * Jac[2][1] + K[i][3] * Jac[3][1];
+                A_solve[i][i] -= Batch ((T) 1);
+            }
+        };
+
+        auto active = BatchBool (true);
+        for (int nIters = 0; nIters < maxIterations; ++nIters)
+        {
+            calc_currents();
+            calc_solve_matrix();
+
+            for (size_t i = 0; i < num_nl_ports; ++i)
+                F_min[i] = p_n[i] + K[i][0] * i_n[0] + K[i][1] * i_n[1] + K[i][2] * i_n[2] + K[i][3] * i_n[3] - v[i];
+            const auto delta_v = solve4x4 (A_solve, F_min);
+
+            auto delta = Batch ((T) 0);
+            for (size_t i = 0; i < num_nl_ports; ++i)
+            {
+                v[i] = xsimd::select (active, v[i] - delta_v[i], v[i]);
+                delta += xsimd::abs (delta_v[i]);
+            }
+
+            active = active & (delta > Batch (1.0e-2));
+            if (xsimd::none (active))
+                break;
+        }
+        calc_currents();
+
+        auto y_n = E_var[0][0] * u_n + E_fix[0][0];
+        for (size_t j = 0; j < num_states; ++j)
+            y_n += D[0][j] * x[j];
+        for (size_t j = 0; j < num_nl_ports; ++j)
+            y_n += F[0][j] * i_n[j];
+
+        const auto [y_left, y_right] = storeStereo (y_n);
+        left_channel_data[n] = (float) y_left;
+        right_channel_data[n] = (float) y_right;
+
+        for (size_t i = 0; i < num_states; ++i)
+        {
+            x_next[i] = B_var[i][0] * u_n + B_fix[i][0];
+            for (size_t j = 0; j < num_states; ++j)
+                x_next[i] += A[i][j] * x[j];
+            for (size_t j = 0; j < num_nl_ports; ++j)
+                x_next[i] += C[i][j] * i_n[j];
+        }
+        x = x_next;
+    }
+
+    for (size_t i = 0; i < num_states; ++i)
+        std::tie (model.x_n[0]((Eigen::Index) i), model.x_n[1]((Eigen::Index) i)) = storeStereo (x[i]);
+    for (size_t i = 0; i < num_nl_ports; ++i)
+        std::tie (model.v_n[0]((Eigen::Index) i), model.v_n[1]((Eigen::Index) i)) = storeStereo (v[i]);
+}
+} // namespace ndk_simd
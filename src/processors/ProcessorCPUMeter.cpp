@@ -0,0 +1,41 @@
+#include "ProcessorCPUMeter.h"
+
+void ProcessorCPUMeter::prepare (double sampleRate)
+{
+    samplesPerTick = sampleRate / (double) Time::getHighResolutionTicksPerSecond();
+    numBlocksRecorded.store (0, std::memory_order_release);
+}
+
+void ProcessorCPUMeter::addBlock (int64 elapsedTicks, int numSamples) noexcept
+{
+    if (numSamples <= 0)
+        return;
+
+    // A processor is only ever processed by one thread at a time, so we're the only writer here.
+    const auto blockIndex = numBlocksRecorded.load (std::memory_order_relaxed);
+    const auto load = (double) elapsedTicks * samplesPerTick / (double) numSamples;
+    loadHistory[(size_t) (blockIndex % historySize)].store ((float) load, std::memory_order_relaxed);
+    numBlocksRecorded.store (blockIndex + 1, std::memory_order_release);
+}
+
+ProcessorCPUMeter::Stats ProcessorCPUMeter::getStats() const
+{
+    const auto numBlocks = (size_t) jmin ((uint64_t) historySize, numBlocksRecorded.load (std::memory_order_acquire));
+    if (numBlocks == 0)
+        return {};
+
+    std::array<float, historySize> loads;
+    for (size_t i = 0; i < numBlocks; ++i)
+        loads[i] = loadHistory[i].load (std::memory_order_relaxed);
+
+    Stats stats;
+    stats.numBlocks = (int) numBlocks;
+    stats.averageLoad = std::accumulate (loads.begin(), loads.begin() + (std::ptrdiff_t) numBlocks, 0.0f) / (float) numBlocks;
+
+    const auto percentileIter = loads.begin() + (std::ptrdiff_t) ((numBlocks * 99) / 100);
+    std::nth_element (loads.begin(), percentileIter, loads.begin() + (std::ptrdiff_t) numBlocks);
+    stats.percentile99Load = *percentileIter;
+    stats.worstLoad = *std::max_element (percentileIter, loads.begin() + (std::ptrdiff_t) numBlocks);
+
+    return stats;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <pch.h>
+
+/**
+ * Keeps track of how much of the real-time budget a processor is using.
+ *
+ * The audio thread records the time taken to process each block (as a proportion
+ * of the block's duration) into a ring buffer of atomics, so that the editor (or
+ * the headless profiler) can read back statistics over the most recent blocks,
+ * without ever blocking the audio thread.
+ */
+class ProcessorCPUMeter
+{
+public:
+    ProcessorCPUMeter() = default;
+
+    /** Prepares the meter, and clears the recorded history */
+    void prepare (double sampleRate);
+
+    /** Times a block of audio processing for the lifetime of the timer */
+    struct ScopedTimer
+    {
+        ScopedTimer (ProcessorCPUMeter& cpuMeter, int numSamplesInBlock) noexcept
+            : meter (cpuMeter),
+              numSamples (numSamplesInBlock),
+              startTicks (Time::getHighResolutionTicks())
+        {
+        }
+
+        ~ScopedTimer() { meter.addBlock (Time::getHighResolutionTicks() - startTicks, numSamples); }
+
+        ProcessorCPUMeter& meter;
+        const int numSamples;
+        const int64 startTicks;
+
+        JUCE_DECLARE_NON_COPYABLE (ScopedTimer)
+    };
+
+    /** Statistics over the most recent blocks, as a proportion of the real-time budget */
+    struct Stats
+    {
+        int numBlocks = 0;
+        float averageLoad = 0.0f;
+        float percentile99Load = 0.0f; // 99% of blocks are processed at or below this load
+        float worstLoad = 0.0f;
+    };
+
+    /** Returns the statistics over the most recently processed blocks (may be called from any thread) */
+    [[nodiscard]] Stats getStats() const;
+
+    static constexpr size_t historySize = 1024;
+
+private:
+    void addBlock (int64 elapsedTicks, int numSamples) noexcept;
+
+    std::array<std::atomic<float>, historySize> loadHistory {};
+    std::atomic<uint64_t> numBlocksRecorded { 0 };
+    double samplesPerTick = 48000.0 / (double) Time::getHighResolutionTicksPerSecond();
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ProcessorCPUMeter)
+};
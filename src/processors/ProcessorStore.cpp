@@ -188,6 +188,17 @@ void ProcessorStore::duplicateProcessor (BaseProcessor& procToDuplicate)
     addProcessorCallback (std::move (newProc));
 }
 
+BaseProcessor::Ptr ProcessorStore::createProcessorCopy (BaseProcessor& procToCopy)
+{
+    const auto storeIter = store.find (procToCopy.getName());
+    if (storeIter == store.end())
+        return {};
+
+    auto procCopy = storeIter->second.factory (nullptr);
+    procCopy->fromXML (procToCopy.toXML().get(), chowdsp::Version { std::string_view { JucePlugin_VersionString } }, false);
+    return procCopy;
+}
+
 bool ProcessorStore::isModuleAvailable (const String& procName) const noexcept
 {
 #if BYOD_ENABLE_ADD_ON_MODULES
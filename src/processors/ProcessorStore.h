@@ -34,6 +34,9 @@ public:
     BaseProcessor::Ptr createProcByName (const String& name);
     void duplicateProcessor (BaseProcessor& procToDuplicate);
 
+    /** Creates a copy of the processor (with the same state) for internal use. Changes to the copy are not undoable. */
+    static BaseProcessor::Ptr createProcessorCopy (BaseProcessor& procToCopy);
+
     void createProcList (PopupMenu& menu, int& menuID) const;
     void createProcReplaceList (PopupMenu& menu, int& menuID, BaseProcessor* procToReplace) const;
     void createProcFromCableClickList (PopupMenu& menu, int& menuID, ConnectionInfo* connectionInfo) const;
@@ -0,0 +1,72 @@
+#include "SharedAssetCache.h"
+
+SharedAssetCache& SharedAssetCache::getInstance()
+{
+    static SharedAssetCache cache;
+    return cache;
+}
+
+std::shared_ptr<const void> SharedAssetCache::find (const String& key)
+{
+    const ScopedLock sl (lock);
+    if (const auto assetIter = assets.find (key); assetIter != assets.end())
+        return assetIter->second.lock();
+
+    return {};
+}
+
+std::shared_ptr<const void> SharedAssetCache::insert (const String& key, std::shared_ptr<const void> asset)
+{
+    const ScopedLock sl (lock);
+
+    // another thread might have created the same asset in the meantime
+    auto& cachedAsset = assets[key];
+    if (auto existingAsset = cachedAsset.lock())
+        return existingAsset;
+
+    // clean up any assets that are no longer being used
+    for (auto iter = assets.begin(); iter != assets.end();)
+        iter = (iter->first != key && iter->second.expired()) ? assets.erase (iter) : std::next (iter);
+
+    cachedAsset = asset;
+    return asset;
+}
+
+SharedAssetCache::AssetPtr<SharedAssetCache::IR> SharedAssetCache::getIR (const String& key, const void* fileData, size_t fileDataSize)
+{
+    return getOrCreate<IR> (key,
+                            [fileData, fileDataSize]() -> AssetPtr<IR>
+                            {
+                                AudioFormatManager formatManager;
+                                formatManager.registerBasicFormats();
+
+                                std::unique_ptr<AudioFormatReader> reader (formatManager.createReaderFor (std::make_unique<MemoryInputStream> (fileData, fileDataSize, false)));
+                                if (reader == nullptr)
+                                    return {};
+
+                                auto ir = std::make_shared<IR>();
+                                ir->sampleRate = reader->sampleRate;
+                                ir->buffer.setSize (jlimit (1, 2, (int) reader->numChannels), (int) reader->lengthInSamples);
+                                if (! reader->read (ir->buffer.getArrayOfWritePointers(), ir->buffer.getNumChannels(), 0, ir->buffer.getNumSamples()))
+                                    return {};
+
+                                return ir;
+                            });
+}
+
+SharedAssetCache::AssetPtr<ModelWeights> SharedAssetCache::getModelWeights (const String& key, const void* weightsData, size_t weightsDataSize)
+{
+    return getOrCreate<ModelWeights> (key,
+                                      [weightsData, weightsDataSize]
+                                      { return ModelWeights::fromBinary (weightsData, weightsDataSize); });
+}
+
+String SharedAssetCache::getBinaryDataKey (const void* binaryData)
+{
+    return "binary:" + String::toHexString ((pointer_sized_int) binaryData);
+}
+
+String SharedAssetCache::getContentKey (uint64_t contentHash)
+{
+    return "content:" + String::toHexString ((int64) contentHash);
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <pch.h>
+
+#include "drive/neural_utils/ModelWeights.h"
+
+/**
+ * A process-wide cache for the decoded assets used by the processors (IRs, neural
+ * network weights, etc.), so that the plugin instances can share them, rather than
+ * each instance decoding and storing its own copy.
+ *
+ * The cache only holds weak references, so an asset is freed once the last
+ * processor using it lets go of it. Processors should hold on to the assets they
+ * are using, so that new instances can pick them up from the cache.
+ */
+class SharedAssetCache
+{
+public:
+    template <typename T>
+    using AssetPtr = std::shared_ptr<const T>;
+
+    /** A decoded impulse response */
+    struct IR
+    {
+        AudioBuffer<float> buffer;
+        double sampleRate = 48000.0;
+    };
+
+    static SharedAssetCache& getInstance();
+
+    /**
+     * Returns the asset of type T with the given key, or creates it with the given
+     * function if it's not in the cache. If the function returns nullptr, then
+     * nothing is cached.
+     */
+    template <typename T, typename CreateFunc>
+    AssetPtr<T> getOrCreate (const String& key, CreateFunc&& createAsset)
+    {
+        const auto assetKey = String { typeid (T).name() } + "|" + key;
+        if (auto existingAsset = find (assetKey))
+            return std::static_pointer_cast<const T> (existingAsset);
+
+        // create the asset outside the lock, since decoding might take a while
+        AssetPtr<T> newAsset = createAsset();
+        if (newAsset == nullptr)
+            return {};
+
+        return std::static_pointer_cast<const T> (insert (assetKey, newAsset));
+    }
+
+    /** Returns a decoded IR from audio file data (e.g. a WAV file), or nullptr if the data can't be decoded. */
+    AssetPtr<IR> getIR (const String& key, const void* fileData, size_t fileDataSize);
+
+    /**
+     * Returns neural network weights from the binary model weights format (see ModelWeights). The weights
+     * point straight into the given data, so it must stay alive (e.g. BinaryData). Throws an exception if the
+     * data is not valid.
+     */
+    AssetPtr<ModelWeights> getModelWeights (const String& key, const void* weightsData, size_t weightsDataSize);
+
+    /** Returns a cache key for data stored in BinaryData (which lives at a fixed address for the whole process). */
+    static String getBinaryDataKey (const void* binaryData);
+
+    /** Returns a cache key for data with a given content hash (see StateAssets::computeHash()). */
+    static String getContentKey (uint64_t contentHash);
+
+private:
+    SharedAssetCache() = default;
+
+    std::shared_ptr<const void> find (const String& key);
+    std::shared_ptr<const void> insert (const String& key, std::shared_ptr<const void> asset);
+
+    CriticalSection lock;
+    std::unordered_map<String, std::weak_ptr<const void>> assets;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SharedAssetCache)
+};
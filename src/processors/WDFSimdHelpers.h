@@ -0,0 +1,43 @@
+#pragma once
+
+#include <pch.h>
+
+/**
+ * Helpers for running a single wave digital filter on all the
+ * channels of a buffer at once, with each channel in its own SIMD lane.
+ */
+namespace wdf_simd
+{
+using Batch = xsimd::batch<float>;
+
+/**
+ * Calls processSample (sampleIndex, x) for each sample in the buffer, where x has the sample
+ * from each channel in its own lane, and writes the returned samples back to the buffer.
+ * Any extra lanes duplicate the last channel.
+ */
+template <typename T = Batch, typename ProcessFunc>
+void processChannels (AudioBuffer<float>& buffer, ProcessFunc&& processSample) noexcept
+{
+    static constexpr auto numLanes = (int) T::size;
+    const auto numChannels = buffer.getNumChannels();
+    jassert (numChannels <= numLanes); // not enough lanes for all the channels!
+
+    auto* const* channelData = buffer.getArrayOfWritePointers();
+    const float* laneChannelData[numLanes];
+    for (int lane = 0; lane < numLanes; ++lane)
+        laneChannelData[lane] = channelData[jmin (lane, numChannels - 1)];
+
+    alignas (T::arch_type::alignment()) float laneData[numLanes];
+    for (int n = 0; n < buffer.getNumSamples(); ++n)
+    {
+        for (int lane = 0; lane < numLanes; ++lane)
+            laneData[lane] = laneChannelData[lane][n];
+
+        const T y = processSample (n, xsimd::load_aligned (laneData));
+        y.store_aligned (laneData);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            channelData[ch][n] = laneData[ch];
+    }
+}
+} // namespace wdf_simd
@@ -4,7 +4,8 @@
 using namespace GlobalParamTags;
 
 ChainIOProcessor::ChainIOProcessor (AudioProcessorValueTreeState& vts, std::function<void (int)>&& latencyChangedCallback) : latencyChangedCallbackFunc (std::move (latencyChangedCallback)),
-                                                                                                                             oversampling (vts, true)
+                                                                                                                             oversampling (vts, true),
+                                                                                                                             requestedOversampling (vts, true)
 {
     using namespace ParameterHelpers;
     monoModeParam = vts.getRawParameterValue (monoModeTag);
@@ -38,6 +39,8 @@ void ChainIOProcessor::createParameters (Parameters& params)
 void ChainIOProcessor::prepare (double sampleRate, int samplesPerBlock)
 {
     oversampling.prepareToPlay (sampleRate, samplesPerBlock, 2);
+    requestedOversampling.prepareToPlay (sampleRate, 1, 1);
+    requestedOSFactor.store (requestedOversampling.getOSFactor());
 
     dsp::ProcessSpec spec { sampleRate, (uint32) samplesPerBlock, 2 };
     inGain.setGainDecibels (inGainParam->getCurrentValue());
@@ -50,11 +53,16 @@ void ChainIOProcessor::prepare (double sampleRate, int samplesPerBlock)
 
     ioBuffer.setSize (2, samplesPerBlock);
     dryWetMixer.prepare (spec);
-    latencyChangedCallbackFunc ((int) oversampling.getLatencySamples());
+    latencyChangedCallbackFunc (getLatencySamples());
 
     isPrepared = true;
 }
 
+int ChainIOProcessor::getLatencySamples() const
+{
+    return (int) oversampling.getLatencySamples() + chainLatency.load();
+}
+
 int ChainIOProcessor::getOversamplingFactor() const
 {
     if (! isPrepared)
@@ -63,6 +71,14 @@ int ChainIOProcessor::getOversamplingFactor() const
     return oversampling.getOSFactor();
 }
 
+int ChainIOProcessor::getRequestedOversamplingFactor() const
+{
+    if (! isPrepared)
+        return 1;
+
+    return requestedOSFactor.load();
+}
+
 bool ChainIOProcessor::processChannelInputs (const AudioBuffer<float>& buffer)
 {
     const auto numChannels = buffer.getNumChannels();
@@ -107,13 +123,19 @@ bool ChainIOProcessor::processChannelInputs (const AudioBuffer<float>& buffer)
     return useStereo;
 }
 
-dsp::AudioBlock<float> ChainIOProcessor::processAudioInput (const AudioBuffer<float>& buffer, bool& sampleRateChanged)
+dsp::AudioBlock<float> ChainIOProcessor::processAudioInput (const AudioBuffer<float>& buffer, int chainOversamplingFactor)
 {
-    if (oversampling.updateOSFactor())
+    if (requestedOversampling.updateOSFactor())
+        requestedOSFactor.store (requestedOversampling.getOSFactor());
+
+    // If only the oversampling mode has changed, we can switch over straight away,
+    // otherwise we keep running at the old rate until the chain is ready.
+    const auto newOSFactor = requestedOSFactor.load();
+    const auto canUpdateOSFactor = newOSFactor == chainOversamplingFactor || newOSFactor == oversampling.getOSFactor();
+    if (canUpdateOSFactor && oversampling.updateOSFactor())
     {
-        sampleRateChanged = true;
         mainThreadAction->call ([this]
-                                { latencyChangedCallbackFunc ((int) oversampling.getLatencySamples()); },
+                                { latencyChangedCallbackFunc (getLatencySamples()); },
                                 true);
     }
 
@@ -142,8 +164,15 @@ void ChainIOProcessor::processChannelOutputs (AudioBuffer<float>& buffer, int nu
         buffer.copyFrom (ch, 0, ioBuffer, ch % numChannelsProcessed, 0, buffer.getNumSamples());
 }
 
-void ChainIOProcessor::processAudioOutput (const AudioBuffer<float>& processedBuffer, AudioBuffer<float>& outputBuffer)
+void ChainIOProcessor::processAudioOutput (const AudioBuffer<float>& processedBuffer, AudioBuffer<float>& outputBuffer, int chainLatencySamples)
 {
+    if (chainLatency.exchange (chainLatencySamples) != chainLatencySamples)
+    {
+        mainThreadAction->call ([this]
+                                { latencyChangedCallbackFunc (getLatencySamples()); },
+                                true);
+    }
+
     const auto numProcessedChannels = processedBuffer.getNumChannels();
     auto&& processedBlock = dsp::AudioBlock<const float> { processedBuffer };
     for (size_t ch = 0; ch < 2; ++ch)
@@ -152,8 +181,7 @@ void ChainIOProcessor::processAudioOutput (const AudioBuffer<float>& processedBu
     auto&& outputBlock = dsp::AudioBlock<float> { ioBuffer };
     oversampling.processSamplesDown (outputBlock);
 
-    const auto latencySamples = (int) oversampling.getLatencySamples();
-    dryWetMixer.processBlock (ioBuffer, latencySamples);
+    dryWetMixer.processBlock (ioBuffer, getLatencySamples());
 
     outGain.setGainDecibels (outGainParam->getCurrentValue());
     outGain.process (dsp::ProcessContextReplacing<float> { outputBlock });
@@ -19,19 +19,35 @@ public:
     void prepare (double sampleRate, int samplesPerBlock);
 
     int getOversamplingFactor() const;
-    dsp::AudioBlock<float> processAudioInput (const AudioBuffer<float>& buffer, bool& sampleRateChanged);
-    void processAudioOutput (const AudioBuffer<float>& processedBuffer, AudioBuffer<float>& outputBuffer);
+
+    /** Returns the oversampling factor that the parameters are asking for (which may not be in use yet). */
+    int getRequestedOversamplingFactor() const;
+
+    /**
+     * Processes the chain input. A change in the oversampling factor is only
+     * applied once the processor chain has been prepared for the new factor.
+     */
+    dsp::AudioBlock<float> processAudioInput (const AudioBuffer<float>& buffer, int chainOversamplingFactor);
+
+    /** Processes the chain output. chainLatencySamples is the latency of the processor chain itself, at the base sample rate. */
+    void processAudioOutput (const AudioBuffer<float>& processedBuffer, AudioBuffer<float>& outputBuffer, int chainLatencySamples);
 
     auto& getOversampling() { return oversampling; }
 
 private:
     bool processChannelInputs (const AudioBuffer<float>& buffer);
+    int getLatencySamples() const;
     void processChannelOutputs (AudioBuffer<float>& buffer, int numChannelsProcessed) const;
 
     const std::function<void (int)> latencyChangedCallbackFunc;
 
     chowdsp::VariableOversampling<float> oversampling;
 
+    // Only used to keep track of the oversampling parameters, never for processing audio.
+    chowdsp::VariableOversampling<float> requestedOversampling;
+    std::atomic<int> requestedOSFactor { 1 };
+    std::atomic<int> chainLatency { 0 };
+
     std::atomic<float>* monoModeParam = nullptr;
     AudioBuffer<float> ioBuffer;
     dsp::AudioBlock<float> processBlock;
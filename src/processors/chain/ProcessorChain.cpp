@@ -1,7 +1,10 @@
 #include "ProcessorChain.h"
 #include "ProcessorChainActionHelper.h"
+#include "ProcessorChainPlanSwapHelper.h"
 #include "ProcessorChainPortMagnitudesHelper.h"
+#include "ProcessorChainPrepareHelper.h"
 #include "ProcessorChainStateHelper.h"
+#include "ProcessorChainWorkerPool.h"
 #include "processors/chain/ChainIOProcessor.h"
 
 namespace
@@ -46,8 +49,11 @@ ProcessorChain::ProcessorChain (ProcessorStore& store,
     actionHelper = std::make_unique<ProcessorChainActionHelper> (*this);
     stateHelper = std::make_unique<ProcessorChainStateHelper> (*this, mainThreadAction);
     portMagsHelper = std::make_unique<ProcessorChainPortMagnitudesHelper> (*this);
+    workerPool = std::make_unique<ProcessorChainWorkerPool>();
+    prepareHelper = std::make_unique<ProcessorChainPrepareHelper> (*this);
 
     procs.ensureStorageAllocated (100);
+    planSwapHelper = std::make_unique<ProcessorChainPlanSwapHelper> (*this);
 }
 
 ProcessorChain::~ProcessorChain() = default;
@@ -57,20 +63,33 @@ void ProcessorChain::createParameters (Parameters& params)
     ChainIOProcessor::createParameters (params);
 }
 
-void ProcessorChain::initializeProcessors()
+void ProcessorChain::prepareProcessor (BaseProcessor& proc) const
+{
+    prepareProcessor (proc, procsOversamplingFactor.load());
+}
+
+void ProcessorChain::prepareProcessor (BaseProcessor& proc, int osFactor) const
+{
+    // processors that don't need oversampling are run at the base sample rate
+    const auto procOSFactor = proc.needsOversampling() ? osFactor : 1;
+    proc.prepareProcessing (mySampleRate * procOSFactor, mySamplesPerBlock * procOSFactor, procOSFactor);
+}
+
+void ProcessorChain::initializeProcessors (ProcessorChainExecutionPlan& plan)
 {
     const auto osFactor = ioProcessor.getOversamplingFactor();
-    const double osSampleRate = mySampleRate * osFactor;
-    const int osSamplesPerBlock = mySamplesPerBlock * osFactor;
 
-    inputProcessor.prepareProcessing (osSampleRate, osSamplesPerBlock);
-    outputProcessor.prepareProcessing (osSampleRate, osSamplesPerBlock);
+    auto procsToPrepare = plan.getProcessors();
+    procsToPrepare.push_back (&plan.getInputProcessor());
+    procsToPrepare.push_back (&plan.getOutputProcessor());
+    prepareHelper->prepareProcessors (procsToPrepare, osFactor);
 
-    for (int i = procs.size() - 1; i >= 0; --i)
-    {
-        if (auto* proc = procs[i])
-            proc->prepareProcessing (osSampleRate, osSamplesPerBlock);
-    }
+    // the plan might be for a shadow copy of the chain, rather than the chain itself
+    if (&plan.getInputProcessor() == &inputProcessor)
+        procsOversamplingFactor.store (osFactor);
+
+    plan.prepare (mySampleRate, mySamplesPerBlock, osFactor);
+    planSwapHelper->prepare (mySampleRate);
 }
 
 void ProcessorChain::prepare (double sampleRate, int samplesPerBlock)
@@ -85,103 +104,27 @@ void ProcessorChain::prepare (double sampleRate, int samplesPerBlock)
     internalMidiBuffer.clear();
     internalMidiBuffer.ensureSize (256);
 
-    SpinLock::ScopedLockType scopedProcessingLock (processingLock);
-    initializeProcessors();
-}
-
-void ProcessorChain::runProcessor (BaseProcessor* proc, AudioBuffer<float>& buffer, bool& outProcessed)
-{
-    TRACE_DSP();
-
-    int nextNumProcs = 0;
-    const int numOutputs = proc->getNumOutputs();
-    for (int i = 0; i < numOutputs; ++i)
-    {
-        const int numOutProcs = proc->getNumOutputConnections (i);
-        for (int j = 0; j < numOutProcs; ++j)
-            nextNumProcs += 1;
-    }
-
-    if (proc == &outputProcessor) // we've reached the output processor, so we're done!
-    {
-        proc->processAudioBlock (buffer);
-        outProcessed = true;
-        return;
-    }
-
-    if (numOutputs == 0) // this processor has no outputs, so after we process, we're done!
-    {
-        proc->processAudioBlock (buffer);
-        return;
-    }
-
-    if (nextNumProcs == 0) // the output of this processor is connected to nothing, so let's not waste our processing...
-    {
-        if (proc == &inputProcessor)
-            inputProcessor.resetLevels();
-
-        return;
-    }
-
-    proc->processAudioBlock (buffer);
-
-    auto processBuffer = [&] (BaseProcessor* nextProc, int inputIndex, AudioBuffer<float>& nextBuffer)
-    {
-        int nextNumInputs = nextProc->getNumInputs();
-        if (nextNumProcs == 1 && nextNumInputs == 1)
-        {
-            runProcessor (nextProc, nextBuffer, outProcessed);
-        }
-        else if (nextNumProcs > 1 && nextNumInputs == 1)
-        {
-            auto& copyNextBuffer = nextProc->getInputBufferNonConst();
-            copyNextBuffer.makeCopyOf (nextBuffer, true);
-            runProcessor (nextProc, copyNextBuffer, outProcessed);
-        }
-        else
-        {
-            auto& copyNextBuffer = nextProc->getInputBufferNonConst (inputIndex);
-            copyNextBuffer.makeCopyOf (nextBuffer, true);
-
-            nextProc->incrementNumInputsReady();
-            if (nextProc->getNumInputsReady() < nextProc->getNumInputConnections())
-                return; // not all the inputs are ready yet...
-
-            runProcessor (nextProc, copyNextBuffer, outProcessed);
-        }
-    };
-
-    for (int i = 0; i < numOutputs; ++i)
-    {
-        auto* outBuffer = proc->getOutputBuffer (i);
-        if (outBuffer == nullptr)
-            outBuffer = &buffer;
-
-        const int numOutProcs = proc->getNumOutputConnections (i);
-        for (int j = numOutProcs - 1; j >= 0; --j)
-        {
-            const auto& connectionInfo = proc->getOutputConnection (i, j);
-            processBuffer (connectionInfo.endProc, connectionInfo.endPort, *outBuffer);
-
-            nextNumProcs -= 1;
-        }
-    }
+    prepareHelper->cancelOversamplingFactorChange();
+    planSwapHelper->reset();
+    initializeProcessors (planSwapHelper->getLatestPlan());
 }
 
 void ProcessorChain::processAudio (AudioBuffer<float>& buffer, const MidiBuffer& hostMidiBuffer)
 {
-    SpinLock::ScopedTryLockType tryProcessingLock (processingLock);
-    if (! tryProcessingLock.isLocked())
-        return;
-
     // process input (oversampling, input gain, etc)
-    bool sampleRateChange = false;
-    auto osBlock = ioProcessor.processAudioInput (buffer, sampleRateChange);
-    if (sampleRateChange)
-        initializeProcessors();
+    auto osBlock = ioProcessor.processAudioInput (buffer, planSwapHelper->getActiveOversamplingFactor());
+
+    // if the graph has changed, we'll swap to the new plan at the end of this block
+    auto& executionPlan = planSwapHelper->getPlanForBlock (ioProcessor.getRequestedOversamplingFactor());
+
+    // Oversampling factor changes are prepared in the background (see ProcessorChainPrepareHelper), but if
+    // the factor changed again just as the audio thread was switching over, the plan may not match the chain
+    // input. We never prepare processors on the audio thread, so the chain stays muted until the message
+    // thread has published a plan for the current factor.
+    const auto planMatchesOSFactor = executionPlan.getOversamplingFactor() == ioProcessor.getOversamplingFactor();
 
     // prepare port magnitudes
-    portMagsHelper->preparePortMagnitudes();
+    portMagsHelper->preparePortMagnitudes (executionPlan.getProcessors());
 
     const auto osNumSamples = (int) osBlock.getNumSamples();
     const auto inputNumChannels = (int) osBlock.getNumChannels();
@@ -195,43 +138,32 @@ void ProcessorChain::processAudio (AudioBuffer<float>& buffer, const MidiBuffer&
             inputBuffer.copyFrom (ch, 0, osBlock.getChannelPointer ((size_t) ch), osNumSamples);
     }
 
-    bool outProcessed = false;
-    const auto& processMidiBuffer = getMidiBufferToUse (hostMidiBuffer, internalMidiBuffer, ioProcessor.getOversamplingFactor());
-
-    for (auto* processor : procs)
-    {
-        // set up MIDI buffer
-        processor->midiBuffer = &processMidiBuffer;
-
-        // process standalone modulation ports
-        auto noInputsConnected = processor->getNumInputConnections() == 0;
-        auto modOutputConnected = processor->isOutputModulationPortConnected();
-        if (noInputsConnected && modOutputConnected)
-            runProcessor (processor, inputBuffer, outProcessed);
-    }
-
     // run processing chain
-    runProcessor (&inputProcessor, inputBuffer, outProcessed);
-
-    for (auto* processor : procs)
-    {
-        processor->midiBuffer = nullptr;
-        processor->clearNumInputsReady();
-    }
+    const auto& processMidiBuffer = getMidiBufferToUse (hostMidiBuffer, internalMidiBuffer, ioProcessor.getOversamplingFactor());
+    if (! executionPlan.isInputConnected())
+        executionPlan.getInputProcessor().resetLevels();
+    const auto outProcessed = planMatchesOSFactor && workerPool->process (executionPlan, inputBuffer, processMidiBuffer, hostMidiBuffer);
 
     if (! outProcessed)
     {
-        outputProcessor.resetLevels();
+        planSwapHelper->finishBlock (nullptr, osNumSamples);
+
+        executionPlan.getOutputProcessor().resetLevels();
         inputBuffer.clear();
-        ioProcessor.processAudioOutput (inputBuffer, buffer);
+        ioProcessor.processAudioOutput (inputBuffer, buffer, executionPlan.getLatencySamples());
     }
     else
     {
         // do output processing (downsampling, output gain)
-        if (auto* outBuffer = outputProcessor.getOutputBuffer())
-            ioProcessor.processAudioOutput (*outBuffer, buffer);
+        if (auto* outBuffer = executionPlan.getOutputProcessor().getOutputBuffer())
+        {
+            planSwapHelper->finishBlock (outBuffer, osNumSamples);
+            ioProcessor.processAudioOutput (*outBuffer, buffer, executionPlan.getLatencySamples());
+        }
         else
+        {
             jassertfalse; // output buffer is null after output was processed?
+        }
     }
 }
 
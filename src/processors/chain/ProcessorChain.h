@@ -2,13 +2,17 @@
 
 #include "../ProcessorStore.h"
 #include "ChainIOProcessor.h"
+#include "ProcessorChainExecutionPlan.h"
 
 #include "../utility/InputProcessor.h"
 #include "../utility/OutputProcessor.h"
 
 class ProcessorChainActionHelper;
+class ProcessorChainPlanSwapHelper;
 class ProcessorChainPortMagnitudesHelper;
+class ProcessorChainPrepareHelper;
 class ProcessorChainStateHelper;
+class ProcessorChainWorkerPool;
 class ParamForwardManager;
 class ProcessorChain : private AudioProcessorValueTreeState::Listener
 {
@@ -42,16 +46,17 @@ public:
     chowdsp::Broadcaster<void (const ConnectionInfo&)> connectionRemovedBroadcaster;
 
 private:
-    void initializeProcessors();
-    void runProcessor (BaseProcessor* proc, AudioBuffer<float>& buffer, bool& outProcessed);
+    void initializeProcessors (ProcessorChainExecutionPlan& plan);
+    void prepareProcessor (BaseProcessor& proc) const;
+    void prepareProcessor (BaseProcessor& proc, int osFactor) const;
     void parameterChanged (const juce::String& parameterID, float newValue) override;
 
     double mySampleRate = 48000.0;
     int mySamplesPerBlock = 512;
 
     OwnedArray<BaseProcessor> procs;
+    std::atomic<int> procsOversamplingFactor { 1 }; // the oversampling factor that the processors in the chain are prepared for
     ProcessorStore& procStore;
-    SpinLock processingLock;
     UndoManager* um;
 
     InputProcessor inputProcessor;
@@ -74,6 +79,14 @@ private:
     friend class ProcessorChainPortMagnitudesHelper;
     std::unique_ptr<ProcessorChainPortMagnitudesHelper> portMagsHelper;
 
+    friend class ProcessorChainPlanSwapHelper;
+    std::unique_ptr<ProcessorChainPlanSwapHelper> planSwapHelper;
+
+    std::unique_ptr<ProcessorChainWorkerPool> workerPool;
+
+    friend class ProcessorChainPrepareHelper;
+    std::unique_ptr<ProcessorChainPrepareHelper> prepareHelper;
+
     chowdsp::DeferredAction mainThreadAction;
     std::unique_ptr<ParamForwardManager>& paramForwardManager;
 
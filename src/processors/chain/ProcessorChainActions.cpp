@@ -1,5 +1,7 @@
 #include "ProcessorChainActions.h"
 #include "ProcessorChainActionHelper.h"
+#include "ProcessorChainPlanSwapHelper.h"
+#include "ProcessorChainPrepareHelper.h"
 
 namespace ProcessorChainHelpers
 {
@@ -23,16 +25,14 @@ class ProcChainActions
 public:
     static void addProcessor (ProcessorChain& chain, BaseProcessor::Ptr newProc)
     {
+        chain.prepareHelper->finishOversamplingFactorChange();
+
         Logger::writeToLog (String ("Creating processor: ") + newProc->getName());
 
-        auto osFactor = chain.ioProcessor.getOversamplingFactor();
-        newProc->prepareProcessing (osFactor * chain.mySampleRate, osFactor * chain.mySamplesPerBlock);
+        chain.prepareProcessor (*newProc);
 
-        BaseProcessor* newProcPtr = nullptr;
-        {
-            SpinLock::ScopedLockType scopedProcessingLock { chain.processingLock };
-            newProcPtr = chain.procs.add (std::move (newProc));
-        }
+        auto* newProcPtr = chain.procs.add (std::move (newProc));
+        chain.planSwapHelper->publishPlan();
 
         for (auto* param : newProcPtr->getParameters())
         {
@@ -45,6 +45,8 @@ public:
 
     static void removeProcessor (ProcessorChain& chain, BaseProcessor* procToRemove, BaseProcessor::Ptr& saveProc)
     {
+        chain.prepareHelper->finishOversamplingFactorChange();
+
         Logger::writeToLog (String ("Removing processor: ") + procToRemove->getName());
 
         ProcessorChainHelpers::removeOutputConnectionsFromProcessor (chain, procToRemove, chain.um);
@@ -57,36 +59,34 @@ public:
                 procToRemove->getVTS().removeParameterListener (paramCast->paramID, &chain);
         }
 
-        {
-            SpinLock::ScopedLockType scopedProcessingLock { chain.processingLock };
-            saveProc.reset (chain.procs.removeAndReturn (chain.procs.indexOf (procToRemove)));
-        }
-        saveProc->freeInternalMemory();
+        saveProc.reset (chain.procs.removeAndReturn (chain.procs.indexOf (procToRemove)));
+        chain.planSwapHelper->publishPlan();
+        chain.planSwapHelper->releaseProcessorMemory (saveProc.get());
     }
 
     static void addConnection (ProcessorChain& chain, const ConnectionInfo& info)
     {
+        chain.prepareHelper->finishOversamplingFactorChange();
+
         Logger::writeToLog (String ("Adding connection from ") + info.startProc->getName() + ", port #"
                             + String (info.startPort) + " to " + info.endProc->getName() + " port #"
                             + String (info.endPort));
 
-        {
-            SpinLock::ScopedLockType scopedProcessingLock { chain.processingLock };
-            info.startProc->addConnection (ConnectionInfo (info));
-        }
+        info.startProc->addConnection (ConnectionInfo (info));
+        chain.planSwapHelper->publishPlan();
         chain.connectionAddedBroadcaster (info);
     }
 
     static void removeConnection (ProcessorChain& chain, const ConnectionInfo& info)
     {
+        chain.prepareHelper->finishOversamplingFactorChange();
+
         Logger::writeToLog (String ("Removing connection from ") + info.startProc->getName() + ", port #"
                             + String (info.startPort) + " to " + info.endProc->getName() + " port #"
                             + String (info.endPort));
 
-        {
-            SpinLock::ScopedLockType scopedProcessingLock { chain.processingLock };
-            info.startProc->removeConnection (info);
-        }
+        info.startProc->removeConnection (info);
+        chain.planSwapHelper->publishPlan();
         chain.connectionRemovedBroadcaster (info);
     }
 
@@ -117,6 +117,13 @@ AddOrRemoveProcessor::AddOrRemoveProcessor (ProcessorChain& procChain, BaseProce
 {
 }
 
+AddOrRemoveProcessor::~AddOrRemoveProcessor()
+{
+    // the audio thread may still be using this processor, so let the chain delete it when it's safe
+    if (actionProc != nullptr)
+        chain.planSwapHelper->retireProcessor (std::move (actionProc));
+}
+
 template <typename PointerType>
 bool waitForPointerCheck (const PointerType& pointer, int waitCycles = 6)
 {
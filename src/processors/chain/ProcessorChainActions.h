@@ -12,6 +12,7 @@ class AddOrRemoveProcessor : public UndoableAction
 public:
     AddOrRemoveProcessor (ProcessorChain& procChain, BaseProcessor::Ptr newProc);
     AddOrRemoveProcessor (ProcessorChain& procChain, BaseProcessor* procToRemove);
+    ~AddOrRemoveProcessor() override;
 
     bool perform() override;
     bool undo() override;
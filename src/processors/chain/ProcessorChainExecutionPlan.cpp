@@ -0,0 +1,616 @@
+#include "ProcessorChainExecutionPlan.h"
+
+namespace
+{
+/** Multi-input processors must wait for all their connected inputs, single-input processors can run as soon as their input is ready. */
+int getNumInputsRequired (const BaseProcessor* proc)
+{
+    return proc->getNumInputs() > 1 ? proc->getNumInputConnections() : 1;
+}
+
+int getNumOutputConnections (const BaseProcessor* proc)
+{
+    int numConnections = 0;
+    for (int portIdx = 0; portIdx < proc->getNumOutputs(); ++portIdx)
+        numConnections += proc->getNumOutputConnections (portIdx);
+    return numConnections;
+}
+
+/** Copies into a buffer that has already been allocated, so that the audio thread doesn't need to allocate. */
+void copyIntoBuffer (const AudioBuffer<float>& source, AudioBuffer<float>& dest)
+{
+    const auto numChannels = source.getNumChannels();
+    const auto numSamples = source.getNumSamples();
+    jassert (numChannels <= dest.getNumChannels() && numSamples <= dest.getNumSamples()); // buffer was not pre-allocated?
+
+    dest.setSize (numChannels, numSamples, false, false, true);
+    for (int ch = 0; ch < numChannels; ++ch)
+        dest.copyFrom (ch, 0, source, ch, 0, numSamples);
+}
+} // namespace
+
+/**
+ * Resamples buffers going between the oversampled and base rate sections of the graph.
+ *
+ * The anti-aliasing filter is a linear-phase FIR, so every resampler delays the signal
+ * by the same whole number of base rate samples, at all frequencies. That way the plan
+ * can line up parallel branches that cross between the two sample rates a different
+ * number of times (see CompensationDelay).
+ */
+struct ProcessorChainExecutionPlan::DomainResampler
+{
+    explicit DomainResampler (bool shouldUpsample) : isUpsampling (shouldUpsample) {}
+
+    static constexpr int latencyBaseSamples = 16;
+
+    void prepare (int baseSamplesPerBlock, int oversamplingFactor)
+    {
+        ratio = oversamplingFactor;
+        if (ratio == 1)
+            return;
+
+        // Kaiser-windowed sinc at the oversampled rate, with the cutoff just below the base rate Nyquist frequency.
+        // The filter is symmetric, so its delay is half of its order.
+        const auto filterOrder = 2 * latencyBaseSamples * ratio;
+        const auto coefs = dsp::FilterDesign<float>::designFIRLowpassWindowMethod (0.425f, (double) ratio, (size_t) filterOrder, dsp::WindowingFunction<float>::kaiser, 8.0f);
+        const auto* coefsData = coefs->getRawCoefficients();
+        firCoefs.assign (coefsData, coefsData + filterOrder + 1);
+
+        // unity gain at DC (upsampling by inserting zeros also divides the gain by the ratio)
+        const auto dcGain = std::accumulate (firCoefs.begin(), firCoefs.end(), 0.0f);
+        for (auto& coef : firCoefs)
+            coef *= (isUpsampling ? (float) ratio : 1.0f) / dcGain;
+
+        historySize = isUpsampling ? 2 * latencyBaseSamples : filterOrder;
+        const auto maxNumSamplesIn = isUpsampling ? baseSamplesPerBlock : baseSamplesPerBlock * ratio;
+        for (auto& channelData : inputData)
+            channelData.assign ((size_t) (historySize + maxNumSamplesIn), 0.0f);
+    }
+
+    void process (const AudioBuffer<float>& inBuffer, AudioBuffer<float>& outBuffer)
+    {
+        if (ratio == 1)
+        {
+            copyIntoBuffer (inBuffer, outBuffer);
+            return;
+        }
+
+        const auto numChannels = inBuffer.getNumChannels();
+        const auto numSamplesIn = inBuffer.getNumSamples();
+        const auto numSamplesOut = isUpsampling ? numSamplesIn * ratio : numSamplesIn / ratio;
+        jassert (numChannels <= (int) inputData.size() && historySize + numSamplesIn <= (int) inputData[0].size());
+        outBuffer.setSize (numChannels, numSamplesOut, false, false, true);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            // the previous input samples, followed by this block
+            auto* x = inputData[(size_t) ch].data();
+            std::copy (inBuffer.getReadPointer (ch), inBuffer.getReadPointer (ch) + numSamplesIn, x + historySize);
+
+            auto* y = outBuffer.getWritePointer (ch);
+            if (isUpsampling)
+                upsample (x + historySize, y, numSamplesIn);
+            else
+                downsample (x + historySize, y, numSamplesOut);
+
+            std::copy (x + numSamplesIn, x + numSamplesIn + historySize, x);
+        }
+    }
+
+    /** Each output sample only needs every ratio-th filter coefficient, since the other inputs would be zero. */
+    void upsample (const float* x, float* y, int numSamplesIn) const noexcept
+    {
+        const auto numCoefs = (int) firCoefs.size();
+        for (int n = 0; n < numSamplesIn; ++n)
+        {
+            for (int phase = 0; phase < ratio; ++phase)
+            {
+                auto sum = 0.0f;
+                for (int k = phase, j = 0; k < numCoefs; k += ratio, ++j)
+                    sum += firCoefs[(size_t) k] * x[n - j];
+                y[n * ratio + phase] = sum;
+            }
+        }
+    }
+
+    /** Only every ratio-th output sample is kept, so we only need to filter those. */
+    void downsample (const float* x, float* y, int numSamplesOut) const noexcept
+    {
+        const auto numCoefs = (int) firCoefs.size();
+        for (int m = 0; m < numSamplesOut; ++m)
+        {
+            const auto* xm = x + m * ratio;
+            auto sum = 0.0f;
+            for (int k = 0; k < numCoefs; ++k)
+                sum += firCoefs[(size_t) k] * xm[-k];
+            y[m] = sum;
+        }
+    }
+
+    const bool isUpsampling;
+    int ratio = 1;
+    int historySize = 0;
+    std::vector<float> firCoefs;
+    std::array<std::vector<float>, 2> inputData;
+};
+
+/**
+ * Delays the buffer on a route to a multi-input step, by the latency of the resamplers that
+ * the step's other inputs went through, so that all the inputs line up with each other.
+ */
+struct ProcessorChainExecutionPlan::CompensationDelay
+{
+    CompensationDelay (int numResamplersToMatch, bool isAtBaseRate) : numResamplers (numResamplersToMatch),
+                                                                      atBaseRate (isAtBaseRate)
+    {
+    }
+
+    void prepare (double baseSampleRate, int baseSamplesPerBlock, int oversamplingFactor, int resamplerLatencySamples)
+    {
+        const auto rateFactor = atBaseRate ? 1 : oversamplingFactor;
+        delaySamples = numResamplers * resamplerLatencySamples * rateFactor;
+
+        delay.setMaximumDelayInSamples (delaySamples + 1);
+        delay.prepare ({ baseSampleRate * rateFactor, (uint32) (baseSamplesPerBlock * rateFactor), 2 });
+        delay.setDelay ((float) delaySamples);
+    }
+
+    void process (AudioBuffer<float>& buffer)
+    {
+        if (delaySamples == 0)
+            return;
+
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        {
+            auto* x = buffer.getWritePointer (ch);
+            for (int n = 0; n < buffer.getNumSamples(); ++n)
+            {
+                delay.pushSample (ch, x[n]);
+                x[n] = delay.popSample (ch);
+            }
+        }
+    }
+
+    const int numResamplers;
+    const bool atBaseRate;
+    int delaySamples = 0;
+    chowdsp::DelayLine<float, chowdsp::DelayLineInterpolationTypes::None> delay;
+};
+
+ProcessorChainExecutionPlan::ProcessorChainExecutionPlan (uint64_t planSequenceNumber) : sequenceNumber (planSequenceNumber)
+{
+}
+
+ProcessorChainExecutionPlan::~ProcessorChainExecutionPlan() = default;
+
+void ProcessorChainExecutionPlan::compile (InputProcessor& inputProc, OutputProcessor& outputProc, const OwnedArray<BaseProcessor>& procs)
+{
+    inputProcessor = &inputProc;
+    outputProcessor = &outputProc;
+
+    // Find the order in which to run the processors. We start with any standalone
+    // modulation sources, followed by the chain input. Downstream processors are
+    // added once all of their connected inputs have been produced, so any processors
+    // that are unreachable (or part of a feedback loop) will never be scheduled.
+    std::vector<BaseProcessor*> processingOrder;
+    processingOrder.reserve ((size_t) procs.size() + 2);
+    for (auto* proc : procs)
+    {
+        if (proc->getNumInputConnections() == 0 && proc->isOutputModulationPortConnected())
+            processingOrder.push_back (proc);
+    }
+    processingOrder.push_back (&inputProc);
+    const auto numSources = processingOrder.size();
+    processors.assign (procs.begin(), procs.end());
+
+    std::unordered_map<const BaseProcessor*, int> numInputsReceived;
+    for (size_t orderIdx = 0; orderIdx < processingOrder.size(); ++orderIdx)
+    {
+        auto* proc = processingOrder[orderIdx];
+        if (proc == &outputProc)
+            continue;
+
+        for (int portIdx = 0; portIdx < proc->getNumOutputs(); ++portIdx)
+        {
+            for (int cIdx = 0; cIdx < proc->getNumOutputConnections (portIdx); ++cIdx)
+            {
+                auto* nextProc = proc->getOutputConnection (portIdx, cIdx).endProc;
+                if (++numInputsReceived[nextProc] == getNumInputsRequired (nextProc))
+                    processingOrder.push_back (nextProc);
+            }
+        }
+    }
+
+    // Processors that have outputs, but aren't connected to anything don't need to be processed.
+    steps.clear();
+    std::unordered_map<const BaseProcessor*, int> stepIndices;
+    for (size_t orderIdx = 0; orderIdx < processingOrder.size(); ++orderIdx)
+    {
+        auto* proc = processingOrder[orderIdx];
+        if (proc != &outputProc && proc->getNumOutputs() > 0 && getNumOutputConnections (proc) == 0)
+            continue;
+
+        stepIndices[proc] = (int) steps.size();
+        const auto isSource = orderIdx < numSources;
+        steps.push_back ({ proc, isSource, ! isSource && proc != &outputProc && ! proc->needsOversampling() });
+    }
+
+    // Resolve the buffer routing between steps. Processors with a single input receive
+    // a copy of the incoming buffer, unless they are the last processor to use that buffer,
+    // in which case they can process it in-place. Multi-input processors receive copies for
+    // now, but may end up sharing the sender's buffer (see below). Connections to a step that has already been processed
+    // (i.e. a second connection to a single-input processor) can never be used, so they are skipped.
+    // Connections between steps running at different sample rates are resampled into the
+    // receiving processor's input buffer.
+    routes.clear();
+    resamplers.clear();
+    for (size_t stepIdx = 0; stepIdx < steps.size(); ++stepIdx)
+    {
+        auto& step = steps[stepIdx];
+        step.firstRoute = routes.size();
+        if (step.proc == &outputProc)
+            continue;
+
+        const auto getNextStepIndex = [&stepIndices, stepIdx] (const BaseProcessor* nextProc)
+        {
+            const auto nextStepIter = stepIndices.find (nextProc);
+            if (nextStepIter == stepIndices.end() || nextStepIter->second <= (int) stepIdx)
+                return -1;
+            return nextStepIter->second;
+        };
+
+        int numRoutesRemaining = 0;
+        for (int portIdx = 0; portIdx < step.proc->getNumOutputs(); ++portIdx)
+        {
+            for (int cIdx = 0; cIdx < step.proc->getNumOutputConnections (portIdx); ++cIdx)
+                numRoutesRemaining += (int) (getNextStepIndex (step.proc->getOutputConnection (portIdx, cIdx).endProc) >= 0);
+        }
+
+        for (int portIdx = 0; portIdx < step.proc->getNumOutputs(); ++portIdx)
+        {
+            for (int cIdx = step.proc->getNumOutputConnections (portIdx) - 1; cIdx >= 0; --cIdx)
+            {
+                const auto& connectionInfo = step.proc->getOutputConnection (portIdx, cIdx);
+                const auto nextStepIdx = getNextStepIndex (connectionInfo.endProc);
+                if (nextStepIdx < 0)
+                    continue;
+
+                const auto nextStepAtBaseRate = steps[(size_t) nextStepIdx].atBaseRate;
+                const auto needsResampling = step.atBaseRate != nextStepAtBaseRate;
+                const auto processInPlace = connectionInfo.endProc->getNumInputs() == 1 && numRoutesRemaining == 1 && ! needsResampling;
+                routes.push_back ({ portIdx, nextStepIdx, connectionInfo.endPort, ! processInPlace });
+                numRoutesRemaining--;
+
+                if (needsResampling)
+                {
+                    routes.back().resamplerIndex = (int) resamplers.size();
+                    resamplers.push_back (std::make_unique<DomainResampler> (! nextStepAtBaseRate));
+                }
+            }
+        }
+
+        step.numRoutes = routes.size() - step.firstRoute;
+    }
+
+    // Every resampler delays the signal by the same amount, so the latency at each step is set by the
+    // largest number of resamplers on any path that leads to it. Inputs that arrive through fewer resamplers
+    // are delayed to match, so that parallel branches still line up when they are mixed back together.
+    // Routes only go forward through the steps, so each step's count is final by the time we reach it.
+    std::vector<int> numResamplersUpstream (steps.size(), 0);
+    for (size_t stepIdx = 0; stepIdx < steps.size(); ++stepIdx)
+    {
+        for (size_t routeIdx = steps[stepIdx].firstRoute; routeIdx < steps[stepIdx].firstRoute + steps[stepIdx].numRoutes; ++routeIdx)
+        {
+            const auto& route = routes[routeIdx];
+            auto& nextStepResamplers = numResamplersUpstream[(size_t) route.stepIndex];
+            nextStepResamplers = jmax (nextStepResamplers, numResamplersUpstream[stepIdx] + (int) (route.resamplerIndex >= 0));
+        }
+    }
+
+    compensationDelays.clear();
+    for (size_t stepIdx = 0; stepIdx < steps.size(); ++stepIdx)
+    {
+        for (size_t routeIdx = steps[stepIdx].firstRoute; routeIdx < steps[stepIdx].firstRoute + steps[stepIdx].numRoutes; ++routeIdx)
+        {
+            auto& route = routes[routeIdx];
+            const auto numMissingResamplers = numResamplersUpstream[(size_t) route.stepIndex] - numResamplersUpstream[stepIdx] - (int) (route.resamplerIndex >= 0);
+            if (numMissingResamplers > 0)
+            {
+                route.compensationDelayIndex = (int) compensationDelays.size();
+                compensationDelays.push_back (std::make_unique<CompensationDelay> (numMissingResamplers, steps[(size_t) route.stepIndex].atBaseRate));
+            }
+        }
+    }
+
+    const auto outputStepIter = stepIndices.find (&outputProc);
+    numOutputResamplers = outputStepIter != stepIndices.end() ? numResamplersUpstream[(size_t) outputStepIter->second] : 0;
+
+    // Multi-input processors receive a buffer from each of their inputs, but only the
+    // last one to arrive gets passed to the processor, same as if the steps were run in order.
+    // Keeping track of this up front means that the steps can also be processed concurrently.
+    std::vector<int> lastRouteToStep (steps.size(), -1);
+    for (size_t routeIdx = 0; routeIdx < routes.size(); ++routeIdx)
+    {
+        auto& route = routes[routeIdx];
+        if (lastRouteToStep[(size_t) route.stepIndex] >= 0)
+            routes[(size_t) lastRouteToStep[(size_t) route.stepIndex]].providesStepBuffer = false;
+        lastRouteToStep[(size_t) route.stepIndex] = (int) routeIdx;
+        steps[(size_t) route.stepIndex].numDependencies++;
+    }
+
+    // The input processor may process the chain input buffer in-place, so any standalone
+    // modulation sources get their own copy of the input, made before any of the steps run.
+    size_t numSourceBuffers = 0;
+    for (auto& step : steps)
+    {
+        if (step.isSource && step.proc != &inputProc)
+            step.sourceBufferIndex = (int) numSourceBuffers++;
+    }
+    sourceBuffers = std::vector<AudioBuffer<float>> (numSourceBuffers);
+
+    allocatePoolBuffers();
+
+    parallelBranches = std::count_if (steps.begin(), steps.end(), [] (const Step& step)
+                                      { return step.isSource; })
+                           > 1
+                       || std::any_of (steps.begin(), steps.end(), [] (const Step& step)
+                                       { return step.numRoutes > 1; });
+
+    stepBuffers.assign (steps.size(), nullptr);
+
+    size_t numInputBuffers = 0;
+    for (auto& step : steps)
+    {
+        step.firstInputBuffer = numInputBuffers;
+        numInputBuffers += (size_t) step.proc->getNumInputs();
+    }
+    inputBuffers.assign (numInputBuffers, nullptr);
+
+    osFactor = 0; // needs to be prepared!
+    pendingDependencies = std::vector<std::atomic<int>> (steps.size());
+    readyQueue = std::vector<std::atomic<int>> (steps.size());
+    numStepsFinished.store ((int) steps.size());
+    inputIsConnected = stepIndices.count (&inputProc) > 0;
+    outputIsReachable = stepIndices.count (&outputProc) > 0;
+}
+
+void ProcessorChainExecutionPlan::allocatePoolBuffers()
+{
+    const auto numSteps = steps.size();
+    const auto isInPlaceRoute = [this] (const Route& route)
+    { return ! route.copyBuffer && steps[(size_t) route.stepIndex].proc->getNumInputs() == 1; };
+
+    // Multi-input processors only read from their input ports, so they can share the sender's buffer,
+    // as long as nothing else is going to write to it, i.e. the sender doesn't have a downstream processor
+    // that will process its buffer in-place. The buffer that gets passed to the processor itself is still
+    // copied, since the processor is allowed to write to it.
+    for (size_t stepIdx = 0; stepIdx < numSteps; ++stepIdx)
+    {
+        const auto& step = steps[stepIdx];
+        const auto stepRoutes = std::next (routes.begin(), (std::ptrdiff_t) step.firstRoute);
+        if (std::any_of (stepRoutes, std::next (stepRoutes, (std::ptrdiff_t) step.numRoutes), isInPlaceRoute))
+            continue;
+
+        for (auto routeIter = stepRoutes; routeIter != std::next (stepRoutes, (std::ptrdiff_t) step.numRoutes); ++routeIter)
+        {
+            if (routeIter->resamplerIndex < 0 && routeIter->compensationDelayIndex < 0 && ! routeIter->providesStepBuffer)
+                routeIter->copyBuffer = false;
+        }
+    }
+
+    // isUpstreamOf[a][b] is true if step b can't start until step a has finished.
+    // Steps are sorted topologically, so we can fill this in from the back.
+    std::vector<std::vector<bool>> isUpstreamOf (numSteps, std::vector<bool> (numSteps, false));
+    for (auto stepIdx = numSteps; stepIdx-- > 0;)
+    {
+        const auto& step = steps[stepIdx];
+        const auto addDownstreamStep = [&isUpstreamOf, stepIdx, numSteps] (size_t nextStepIdx)
+        {
+            isUpstreamOf[stepIdx][nextStepIdx] = true;
+            for (size_t i = 0; i < numSteps; ++i)
+                if (isUpstreamOf[nextStepIdx][i])
+                    isUpstreamOf[stepIdx][i] = true;
+        };
+
+        for (size_t routeIdx = step.firstRoute; routeIdx < step.firstRoute + step.numRoutes; ++routeIdx)
+            addDownstreamStep ((size_t) routes[routeIdx].stepIndex);
+    }
+
+    // A step's output buffers might be its own input buffer, so anything that reads or
+    // processes its outputs without a copy might also be reading from its input buffer.
+    std::vector<std::vector<int>> outputReaders (numSteps);
+    for (auto stepIdx = numSteps; stepIdx-- > 0;)
+    {
+        const auto& step = steps[stepIdx];
+        auto& readers = outputReaders[stepIdx];
+        readers.push_back ((int) stepIdx);
+        for (size_t routeIdx = step.firstRoute; routeIdx < step.firstRoute + step.numRoutes; ++routeIdx)
+        {
+            const auto& route = routes[routeIdx];
+            if (isInPlaceRoute (route))
+                readers.insert (readers.end(), outputReaders[(size_t) route.stepIndex].begin(), outputReaders[(size_t) route.stepIndex].end());
+            else if (! route.copyBuffer)
+                readers.push_back (route.stepIndex);
+        }
+    }
+
+    // A pooled buffer is in use from the step that copies into it, until the last step that reads from it.
+    // After that it can be re-used by any step that can't start until all of those steps have finished,
+    // which holds whether the steps are processed in order or in parallel.
+    std::vector<std::vector<int>> poolBufferReaders;
+    for (size_t stepIdx = 0; stepIdx < numSteps; ++stepIdx)
+    {
+        const auto& step = steps[stepIdx];
+        for (size_t routeIdx = step.firstRoute; routeIdx < step.firstRoute + step.numRoutes; ++routeIdx)
+        {
+            auto& route = routes[routeIdx];
+            if (! route.copyBuffer)
+                continue;
+
+            auto readers = route.providesStepBuffer ? outputReaders[(size_t) route.stepIndex] : std::vector<int> { route.stepIndex };
+            readers.push_back ((int) stepIdx);
+
+            const auto poolBufferIter = std::find_if (poolBufferReaders.begin(),
+                                                      poolBufferReaders.end(),
+                                                      [&isUpstreamOf, stepIdx] (const std::vector<int>& prevReaders)
+                                                      {
+                                                          return std::all_of (prevReaders.begin(), prevReaders.end(), [&isUpstreamOf, stepIdx] (int readerIdx)
+                                                                              { return isUpstreamOf[(size_t) readerIdx][stepIdx]; });
+                                                      });
+
+            route.poolBufferIndex = (int) std::distance (poolBufferReaders.begin(), poolBufferIter);
+            if (poolBufferIter == poolBufferReaders.end())
+                poolBufferReaders.push_back (std::move (readers));
+            else
+                *poolBufferIter = std::move (readers);
+        }
+    }
+
+    bufferPool = std::vector<AudioBuffer<float>> (poolBufferReaders.size());
+}
+
+void ProcessorChainExecutionPlan::prepare (double baseSampleRate, int baseSamplesPerBlock, int oversamplingFactor)
+{
+    osFactor = oversamplingFactor;
+    for (auto& resampler : resamplers)
+        resampler->prepare (baseSamplesPerBlock, oversamplingFactor);
+
+    // without oversampling, the "resamplers" just copy the buffer, so there's no latency to compensate for
+    const auto resamplerLatencySamples = oversamplingFactor > 1 ? DomainResampler::latencyBaseSamples : 0;
+    for (auto& compensationDelay : compensationDelays)
+        compensationDelay->prepare (baseSampleRate, baseSamplesPerBlock, oversamplingFactor, resamplerLatencySamples);
+    latencySamples = numOutputResamplers * resamplerLatencySamples;
+
+    for (auto* buffers : { &bufferPool, &sourceBuffers })
+    {
+        for (auto& buffer : *buffers)
+        {
+            buffer.setSize (2, baseSamplesPerBlock * oversamplingFactor);
+            buffer.clear();
+        }
+    }
+}
+
+void ProcessorChainExecutionPlan::copySourceInputs (const AudioBuffer<float>& inputBuffer)
+{
+    for (auto& buffer : sourceBuffers)
+        copyIntoBuffer (inputBuffer, buffer);
+}
+
+void ProcessorChainExecutionPlan::processStep (size_t stepIdx, AudioBuffer<float>& inputBuffer, const MidiBuffer& midiBuffer, const MidiBuffer& baseRateMidiBuffer)
+{
+    TRACE_DSP();
+
+    const auto& step = steps[stepIdx];
+    jassert (step.isSource || stepBuffers[stepIdx] != nullptr);
+    auto& buffer = step.sourceBufferIndex >= 0 ? sourceBuffers[(size_t) step.sourceBufferIndex]
+                                               : (step.isSource ? inputBuffer : *stepBuffers[stepIdx]);
+
+    step.proc->midiBuffer = step.atBaseRate ? &baseRateMidiBuffer : &midiBuffer;
+    step.proc->inputBuffers = inputBuffers.data() + step.firstInputBuffer;
+    step.proc->processAudioBlock (buffer);
+    step.proc->inputBuffers = nullptr;
+    step.proc->midiBuffer = nullptr;
+
+    for (size_t routeIdx = step.firstRoute; routeIdx < step.firstRoute + step.numRoutes; ++routeIdx)
+    {
+        const auto& route = routes[routeIdx];
+
+        auto* outBuffer = step.proc->getOutputBuffer (route.outputPort);
+        if (outBuffer == nullptr)
+            outBuffer = &buffer;
+
+        if (route.copyBuffer)
+        {
+            auto& nextBuffer = bufferPool[(size_t) route.poolBufferIndex];
+            if (route.resamplerIndex >= 0)
+                resamplers[(size_t) route.resamplerIndex]->process (*outBuffer, nextBuffer);
+            else
+                copyIntoBuffer (*outBuffer, nextBuffer);
+
+            if (route.compensationDelayIndex >= 0)
+                compensationDelays[(size_t) route.compensationDelayIndex]->process (nextBuffer);
+            outBuffer = &nextBuffer;
+        }
+
+        inputBuffers[steps[(size_t) route.stepIndex].firstInputBuffer + (size_t) route.inputPort] = outBuffer;
+        if (route.providesStepBuffer)
+            stepBuffers[(size_t) route.stepIndex] = outBuffer;
+    }
+}
+
+bool ProcessorChainExecutionPlan::process (AudioBuffer<float>& inputBuffer, const MidiBuffer& midiBuffer, const MidiBuffer& baseRateMidiBuffer)
+{
+    jassert (osFactor > 0); // plan has not been prepared!
+    copySourceInputs (inputBuffer);
+    for (size_t stepIdx = 0; stepIdx < steps.size(); ++stepIdx)
+        processStep (stepIdx, inputBuffer, midiBuffer, baseRateMidiBuffer);
+
+    return outputIsReachable;
+}
+
+void ProcessorChainExecutionPlan::startParallelProcessing (AudioBuffer<float>& inputBuffer, const MidiBuffer& midiBuffer, const MidiBuffer& baseRateMidiBuffer)
+{
+    jassert (osFactor > 0); // plan has not been prepared!
+    copySourceInputs (inputBuffer);
+    parallelInputBuffer = &inputBuffer;
+    parallelMidiBuffer = &midiBuffer;
+    parallelBaseRateMidiBuffer = &baseRateMidiBuffer;
+
+    for (size_t stepIdx = 0; stepIdx < steps.size(); ++stepIdx)
+    {
+        pendingDependencies[stepIdx].store (steps[stepIdx].numDependencies, std::memory_order_relaxed);
+        readyQueue[stepIdx].store (-1, std::memory_order_relaxed);
+    }
+
+    numStepsQueued.store (0, std::memory_order_relaxed);
+    numStepsClaimed.store (0, std::memory_order_relaxed);
+    numStepsFinished.store (0, std::memory_order_relaxed);
+
+    for (size_t stepIdx = 0; stepIdx < steps.size(); ++stepIdx)
+    {
+        if (steps[stepIdx].numDependencies == 0)
+            readyQueue[(size_t) numStepsQueued.fetch_add (1, std::memory_order_relaxed)].store ((int) stepIdx, std::memory_order_relaxed);
+    }
+}
+
+void ProcessorChainExecutionPlan::resolveDependency (int stepIdx)
+{
+    if (pendingDependencies[(size_t) stepIdx].fetch_sub (1, std::memory_order_acq_rel) != 1)
+        return;
+
+    // the step now has all of its inputs, so it's ready to be processed
+    const auto queueIdx = numStepsQueued.fetch_add (1, std::memory_order_acq_rel);
+    readyQueue[(size_t) queueIdx].store (stepIdx, std::memory_order_release);
+}
+
+bool ProcessorChainExecutionPlan::hasReadySteps() const noexcept
+{
+    return numStepsClaimed.load (std::memory_order_acquire) < numStepsQueued.load (std::memory_order_acquire);
+}
+
+bool ProcessorChainExecutionPlan::processNextReadyStep()
+{
+    auto queueIdx = numStepsClaimed.load (std::memory_order_acquire);
+    int stepIdx;
+    do
+    {
+        if (queueIdx >= numStepsQueued.load (std::memory_order_acquire))
+            return false;
+
+        // the slot has been reserved, but the thread that queued the step may not have filled it in yet,
+        // in which case we leave it for later, rather than waiting for the other thread here
+        stepIdx = readyQueue[(size_t) queueIdx].load (std::memory_order_acquire);
+        if (stepIdx < 0)
+            return false;
+    } while (! numStepsClaimed.compare_exchange_weak (queueIdx, queueIdx + 1, std::memory_order_acq_rel));
+
+    processStep ((size_t) stepIdx, *parallelInputBuffer, *parallelMidiBuffer, *parallelBaseRateMidiBuffer);
+
+    const auto& step = steps[(size_t) stepIdx];
+    for (size_t routeIdx = step.firstRoute; routeIdx < step.firstRoute + step.numRoutes; ++routeIdx)
+        resolveDependency (routes[routeIdx].stepIndex);
+
+    numStepsFinished.fetch_add (1, std::memory_order_release);
+    return true;
+}
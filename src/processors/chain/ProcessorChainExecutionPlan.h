@@ -0,0 +1,157 @@
+#pragma once
+
+#include "../utility/InputProcessor.h"
+#include "../utility/OutputProcessor.h"
+
+/**
+ * A flattened, topologically sorted schedule for running the processor graph.
+ *
+ * The plan is compiled on the message thread whenever the graph changes, and
+ * resolves up front which processors need to run, in what order, and which
+ * buffers they should receive. The audio thread then just iterates over the
+ * list of steps, without needing to traverse the graph recursively.
+ *
+ * Once compiled and prepared, a plan is never modified by the message thread,
+ * so it can be handed over to the audio thread without any locking.
+ *
+ * Modules that don't need oversampling are run at the base sample rate, and
+ * any connections between the oversampled and base rate sections of the graph
+ * are resampled by the plan. The resamplers have a fixed latency, which the plan
+ * compensates for wherever branches with different latencies are mixed together,
+ * and reports for the output (see getLatencySamples()).
+ *
+ * The plan can also be processed by several threads at once: each step keeps
+ * track of how many of its inputs are still pending, and is queued up to be
+ * processed as soon as all of them have been delivered. Standalone modulation
+ * sources each process their own copy of the chain input, so they can run
+ * alongside the rest of the chain.
+ *
+ * Wherever possible, buffers are passed between processors without copying.
+ * When a copy is needed, it's made into a buffer from a pool owned by the plan,
+ * and the pooled buffers are re-used across the graph once nothing can read from
+ * them anymore.
+ */
+class ProcessorChainExecutionPlan
+{
+public:
+    explicit ProcessorChainExecutionPlan (uint64_t sequenceNumber);
+    ~ProcessorChainExecutionPlan();
+
+    /** Compiles the plan for the graph starting at the given input processor. */
+    void compile (InputProcessor& inputProc, OutputProcessor& outputProc, const OwnedArray<BaseProcessor>& procs);
+
+    /** Prepares the resamplers between the oversampled and base rate sections of the graph. */
+    void prepare (double baseSampleRate, int baseSamplesPerBlock, int oversamplingFactor);
+
+    /** Returns the oversampling factor that the plan was last prepared with. */
+    [[nodiscard]] int getOversamplingFactor() const noexcept { return osFactor; }
+
+    /** Returns the latency (at the base sample rate) added by resampling between the oversampled and base rate sections of the graph. */
+    [[nodiscard]] int getLatencySamples() const noexcept { return latencySamples; }
+
+    /**
+     * Runs the plan on the given (oversampled) input buffer.
+     * Returns true if the output processor was processed.
+     */
+    bool process (AudioBuffer<float>& inputBuffer, const MidiBuffer& midiBuffer, const MidiBuffer& baseRateMidiBuffer);
+
+    /** Resets the plan's step queue, so that the steps can be processed from multiple threads. */
+    void startParallelProcessing (AudioBuffer<float>& inputBuffer, const MidiBuffer& midiBuffer, const MidiBuffer& baseRateMidiBuffer);
+
+    /**
+     * Processes the next step that is ready to go.
+     * Returns false if no step is ready (but there may be some steps that are still waiting for their inputs).
+     */
+    bool processNextReadyStep();
+
+    /** Returns true if there are any steps that are ready to be processed, but haven't been claimed by a thread yet. */
+    [[nodiscard]] bool hasReadySteps() const noexcept;
+
+    /** Returns true once all the steps have been processed. */
+    [[nodiscard]] bool isParallelProcessingFinished() const noexcept { return numStepsFinished.load() == (int) steps.size(); }
+
+    /** Returns true if the plan has any steps that could be processed concurrently. */
+    [[nodiscard]] bool hasParallelBranches() const noexcept { return parallelBranches; }
+
+    /** Returns all the processors that were in the chain when the plan was compiled. */
+    [[nodiscard]] const auto& getProcessors() const noexcept { return processors; }
+
+    /** Returns the chain input processor that the plan was compiled with. */
+    [[nodiscard]] InputProcessor& getInputProcessor() const noexcept { return *inputProcessor; }
+
+    /** Returns the chain output processor that the plan was compiled with. */
+    [[nodiscard]] OutputProcessor& getOutputProcessor() const noexcept { return *outputProcessor; }
+
+    /** Returns true if the input processor has any outgoing connections. */
+    [[nodiscard]] bool isInputConnected() const noexcept { return inputIsConnected; }
+
+    /** Returns true if the output processor is reachable from the chain input. */
+    [[nodiscard]] bool isOutputReachable() const noexcept { return outputIsReachable; }
+
+    /** Plans are numbered in the order in which they were compiled. */
+    const uint64_t sequenceNumber;
+
+private:
+    struct Route
+    {
+        int outputPort = 0; // output port on the processor that is sending the buffer
+        int stepIndex = -1; // plan step for the processor receiving the buffer
+        int inputPort = 0; // input port on the processor receiving the buffer
+        bool copyBuffer = true; // if false, the receiving processor can process the sender's buffer in-place (or read from it, for multi-input processors)
+        int poolBufferIndex = -1; // pooled buffer to copy the sender's buffer into
+        bool providesStepBuffer = true; // if true, the receiving processor will process this buffer
+        int resamplerIndex = -1; // resampler to use if the sending and receiving processors run at different sample rates
+        int compensationDelayIndex = -1; // delay to line this buffer up with the receiving processor's other inputs
+    };
+
+    struct Step
+    {
+        BaseProcessor* proc = nullptr;
+        bool isSource = false; // source steps are processed with the chain input buffer (or a copy of it)
+        int sourceBufferIndex = -1; // standalone modulation sources process a copy of the chain input
+        bool atBaseRate = false; // if true, the step runs at the base sample rate, rather than the oversampled rate
+        size_t firstRoute = 0;
+        size_t numRoutes = 0;
+        int numDependencies = 0; // number of buffers this step needs to receive before it can be processed
+        size_t firstInputBuffer = 0; // index of the processor's first input port in the plan's input buffers
+    };
+
+    struct DomainResampler;
+    struct CompensationDelay;
+
+    void processStep (size_t stepIdx, AudioBuffer<float>& inputBuffer, const MidiBuffer& midiBuffer, const MidiBuffer& baseRateMidiBuffer);
+    void resolveDependency (int stepIdx);
+    void allocatePoolBuffers();
+    void copySourceInputs (const AudioBuffer<float>& inputBuffer);
+
+    std::vector<Step> steps;
+    std::vector<Route> routes;
+    std::vector<AudioBuffer<float>*> stepBuffers;
+    std::vector<const AudioBuffer<float>*> inputBuffers; // buffers delivered to each step's input ports (null until delivered)
+    std::vector<AudioBuffer<float>> bufferPool;
+    std::vector<AudioBuffer<float>> sourceBuffers;
+    std::vector<BaseProcessor*> processors;
+    InputProcessor* inputProcessor = nullptr;
+    OutputProcessor* outputProcessor = nullptr;
+    std::vector<std::unique_ptr<DomainResampler>> resamplers;
+    std::vector<std::unique_ptr<CompensationDelay>> compensationDelays;
+    int numOutputResamplers = 0;
+    int latencySamples = 0;
+    int osFactor = 1;
+
+    bool inputIsConnected = false;
+    bool outputIsReachable = false;
+    bool parallelBranches = false;
+
+    // parallel processing state
+    std::vector<std::atomic<int>> pendingDependencies;
+    std::vector<std::atomic<int>> readyQueue;
+    std::atomic<int> numStepsQueued { 0 };
+    std::atomic<int> numStepsClaimed { 0 };
+    std::atomic<int> numStepsFinished { 0 };
+    AudioBuffer<float>* parallelInputBuffer = nullptr;
+    const MidiBuffer* parallelMidiBuffer = nullptr;
+    const MidiBuffer* parallelBaseRateMidiBuffer = nullptr;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ProcessorChainExecutionPlan)
+};
@@ -0,0 +1,173 @@
+#include "ProcessorChainPlanSwapHelper.h"
+#include "ProcessorChainPrepareHelper.h"
+
+ProcessorChainPlanSwapHelper::ProcessorChainPlanSwapHelper (ProcessorChain& procChain) : chain (procChain)
+{
+    publishPlan();
+}
+
+ProcessorChainPlanSwapHelper::~ProcessorChainPlanSwapHelper() = default;
+
+void ProcessorChainPlanSwapHelper::publishPlan()
+{
+    publishPlan (chain.inputProcessor, chain.outputProcessor, chain.procs, chain.procsOversamplingFactor.load());
+
+    // if the audio thread was running a shadow copy of the chain, it won't be needed anymore
+    chain.prepareHelper->retireShadowChain();
+}
+
+uint64_t ProcessorChainPlanSwapHelper::publishShadowPlan (InputProcessor& inputProc, OutputProcessor& outputProc, const OwnedArray<BaseProcessor>& procs, int osFactor)
+{
+    return publishPlan (inputProc, outputProc, procs, osFactor);
+}
+
+uint64_t ProcessorChainPlanSwapHelper::publishPlan (InputProcessor& inputProc, OutputProcessor& outputProc, const OwnedArray<BaseProcessor>& procs, int osFactor)
+{
+    const auto sequenceNumber = executionPlans.empty() ? (uint64_t) 0 : executionPlans.back()->sequenceNumber + 1;
+    auto& newPlan = executionPlans.emplace_back (std::make_unique<ProcessorChainExecutionPlan> (sequenceNumber));
+    newPlan->compile (inputProc, outputProc, procs);
+    newPlan->prepare (chain.mySampleRate, chain.mySamplesPerBlock, osFactor);
+    latestPlan.store (newPlan.get());
+
+    reclaimUnusedResources();
+    return sequenceNumber;
+}
+
+void ProcessorChainPlanSwapHelper::releaseProcessorMemory (BaseProcessor* proc)
+{
+    // The latest plan no longer contains this processor, so once the
+    // audio thread has picked up that plan, it's safe to release it.
+    processorsAwaitingMemoryRelease.emplace_back (getLatestPlan().sequenceNumber, proc);
+    reclaimUnusedResources();
+}
+
+void ProcessorChainPlanSwapHelper::retireProcessor (BaseProcessor::Ptr proc)
+{
+    processorsAwaitingDeletion.emplace_back (getLatestPlan().sequenceNumber, std::move (proc));
+    reclaimUnusedResources();
+}
+
+void ProcessorChainPlanSwapHelper::reclaimUnusedResources()
+{
+    const auto oldestInUse = oldestPlanInUse.load();
+
+    // the latest plan is never removed, since its sequence number can't be older than the plan in use
+    executionPlans.erase (std::remove_if (executionPlans.begin(),
+                                          executionPlans.end(),
+                                          [oldestInUse] (const auto& plan)
+                                          { return plan->sequenceNumber < oldestInUse; }),
+                          executionPlans.end());
+
+    processorsAwaitingMemoryRelease.erase (std::remove_if (processorsAwaitingMemoryRelease.begin(),
+                                                           processorsAwaitingMemoryRelease.end(),
+                                                           [this, oldestInUse] (const auto& entry)
+                                                           {
+                                                               const auto& [sequenceNumber, proc] = entry;
+                                                               if (sequenceNumber > oldestInUse)
+                                                                   return false;
+
+                                                               // the processor may have been added back to the chain in the meantime!
+                                                               if (! chain.procs.contains (proc))
+                                                                   proc->freeInternalMemory();
+                                                               return true;
+                                                           }),
+                                           processorsAwaitingMemoryRelease.end());
+
+    processorsAwaitingDeletion.erase (std::remove_if (processorsAwaitingDeletion.begin(),
+                                                      processorsAwaitingDeletion.end(),
+                                                      [oldestInUse] (const auto& entry)
+                                                      { return entry.first <= oldestInUse; }),
+                                      processorsAwaitingDeletion.end());
+
+    if (executionPlans.size() > 1 || ! processorsAwaitingMemoryRelease.empty() || ! processorsAwaitingDeletion.empty())
+        startTimer (100);
+    else
+        stopTimer();
+}
+
+void ProcessorChainPlanSwapHelper::timerCallback()
+{
+    reclaimUnusedResources();
+}
+
+void ProcessorChainPlanSwapHelper::reset()
+{
+    activePlan = latestPlan.load();
+    nextPlan = nullptr;
+    fadeGain = 1.0f;
+    oldestPlanInUse.store (activePlan->sequenceNumber);
+}
+
+void ProcessorChainPlanSwapHelper::prepare (double baseSampleRate)
+{
+    fadeSampleRate = baseSampleRate;
+}
+
+int ProcessorChainPlanSwapHelper::getActiveOversamplingFactor() const noexcept
+{
+    if (activePlan == nullptr)
+        return latestPlan.load()->getOversamplingFactor();
+
+    return activePlan->getOversamplingFactor();
+}
+
+int ProcessorChainPlanSwapHelper::getFadeLengthSamples() const noexcept
+{
+    // the plans on either side of a swap may be running at different oversampling factors
+    return jmax (1, (int) (fadeTimeSeconds * fadeSampleRate * (double) activePlan->getOversamplingFactor()));
+}
+
+ProcessorChainExecutionPlan& ProcessorChainPlanSwapHelper::getPlanForBlock (int requestedOSFactor)
+{
+    auto* plan = latestPlan.load();
+    if (activePlan == nullptr)
+    {
+        activePlan = plan;
+        nextPlan = nullptr;
+    }
+    else if (plan != activePlan)
+    {
+        // keep running the current plan for this block, then swap at the end
+        const auto planOSFactor = plan->getOversamplingFactor();
+        const auto canSwap = planOSFactor == activePlan->getOversamplingFactor() || planOSFactor == requestedOSFactor;
+        nextPlan = canSwap ? plan : nullptr;
+    }
+
+    oldestPlanInUse.store (activePlan->sequenceNumber);
+    return *activePlan;
+}
+
+void ProcessorChainPlanSwapHelper::finishBlock (AudioBuffer<float>* outputBuffer, int numSamples)
+{
+    if (nextPlan != nullptr) // fade out the old graph, and swap to the new one
+    {
+        if (outputBuffer != nullptr)
+        {
+            if (fadeGain < 1.0f)
+            {
+                outputBuffer->applyGainRamp (0, numSamples, fadeGain, 0.0f);
+            }
+            else
+            {
+                const auto numFadeSamples = jmin (numSamples, getFadeLengthSamples());
+                outputBuffer->applyGainRamp (numSamples - numFadeSamples, numFadeSamples, 1.0f, 0.0f);
+            }
+        }
+
+        activePlan = std::exchange (nextPlan, nullptr);
+        fadeGain = 0.0f;
+        return;
+    }
+
+    if (fadeGain < 1.0f) // fade in the new graph
+    {
+        const auto gainIncrement = 1.0f / (float) getFadeLengthSamples();
+        const auto numFadeSamples = jmin (numSamples, (int) std::ceil ((1.0f - fadeGain) / gainIncrement));
+        const auto endGain = jmin (1.0f, fadeGain + gainIncrement * (float) numFadeSamples);
+
+        if (outputBuffer != nullptr)
+            outputBuffer->applyGainRamp (0, numFadeSamples, fadeGain, endGain);
+
+        fadeGain = endGain;
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "ProcessorChain.h"
+
+/**
+ * Hands execution plans over from the message thread to the audio thread.
+ *
+ * Whenever the graph changes, a new plan is compiled on the message thread and
+ * published with an atomic pointer swap. The audio thread picks up the new plan
+ * at the start of the next block, fading out the old graph at the end of that
+ * block, and fading in the new graph at the start of the following one.
+ *
+ * Plans, and any processors that were removed from the chain, are only reclaimed
+ * once the audio thread has moved on to a newer plan.
+ */
+class ProcessorChainPlanSwapHelper : private Timer
+{
+public:
+    explicit ProcessorChainPlanSwapHelper (ProcessorChain& procChain);
+    ~ProcessorChainPlanSwapHelper() override;
+
+    /** Compiles and publishes a new plan for the current state of the chain. */
+    void publishPlan();
+
+    /**
+     * Compiles and publishes a plan for a set of processors that are not part of the chain
+     * (i.e. a shadow copy of the chain), which have already been prepared at the given
+     * oversampling factor. Returns the sequence number of the new plan.
+     */
+    uint64_t publishShadowPlan (InputProcessor& inputProc, OutputProcessor& outputProc, const OwnedArray<BaseProcessor>& procs, int osFactor);
+
+    /** Returns true once the audio thread has moved on to the given plan (or a newer one). */
+    bool isAudioThreadUsingPlan (uint64_t sequenceNumber) const { return oldestPlanInUse.load() >= sequenceNumber; }
+
+    /** Returns the most recently published plan (message thread only). */
+    ProcessorChainExecutionPlan& getLatestPlan() const { return *executionPlans.back(); }
+
+    /** Frees the processor's internal memory, once the audio thread is no longer using it. */
+    void releaseProcessorMemory (BaseProcessor* proc);
+
+    /** Deletes the processor, once the audio thread is no longer using it. */
+    void retireProcessor (BaseProcessor::Ptr proc);
+
+    /** Resets the audio thread state to use the latest plan. Should be called while the audio thread is not running. */
+    void reset();
+
+    /** Sets the base sample rate used for computing fade lengths. */
+    void prepare (double baseSampleRate);
+
+    /** Returns the oversampling factor of the plan that the audio thread is currently using. */
+    int getActiveOversamplingFactor() const noexcept;
+
+    /**
+     * Returns the plan to use for the current audio block. A plan for a different
+     * oversampling factor is only swapped in once the chain input has been asked
+     * to switch to that factor, otherwise the current plan keeps running.
+     */
+    ProcessorChainExecutionPlan& getPlanForBlock (int requestedOSFactor);
+
+    /** Applies any fades needed for this block, and hands over to the next plan if needed. */
+    void finishBlock (AudioBuffer<float>* outputBuffer, int numSamples);
+
+private:
+    void timerCallback() override;
+    void reclaimUnusedResources();
+    uint64_t publishPlan (InputProcessor& inputProc, OutputProcessor& outputProc, const OwnedArray<BaseProcessor>& procs, int osFactor);
+    int getFadeLengthSamples() const noexcept;
+
+    ProcessorChain& chain;
+
+    // message thread state
+    std::vector<std::unique_ptr<ProcessorChainExecutionPlan>> executionPlans; // oldest first
+    std::vector<std::pair<uint64_t, BaseProcessor*>> processorsAwaitingMemoryRelease;
+    std::vector<std::pair<uint64_t, BaseProcessor::Ptr>> processorsAwaitingDeletion;
+
+    // shared state
+    std::atomic<ProcessorChainExecutionPlan*> latestPlan { nullptr };
+    std::atomic<uint64_t> oldestPlanInUse { 0 };
+
+    // audio thread state
+    ProcessorChainExecutionPlan* activePlan = nullptr;
+    ProcessorChainExecutionPlan* nextPlan = nullptr;
+    float fadeGain = 1.0f;
+    double fadeSampleRate = 48000.0;
+
+    static constexpr double fadeTimeSeconds = 0.005;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ProcessorChainPlanSwapHelper)
+};
@@ -0,0 +1,255 @@
+#include "ProcessorChainPrepareHelper.h"
+#include "ProcessorChainPlanSwapHelper.h"
+
+namespace
+{
+/** A set of processors to prepare, shared between all the threads that are helping to prepare them. */
+struct PrepareBatch
+{
+    std::vector<BaseProcessor*> procs;
+    std::function<void (BaseProcessor&)> prepareFunc;
+
+    std::atomic<size_t> nextIndex { 0 };
+    std::atomic<size_t> numPrepared { 0 };
+    WaitableEvent allPrepared;
+
+    void help()
+    {
+        for (auto idx = nextIndex.fetch_add (1); idx < procs.size(); idx = nextIndex.fetch_add (1))
+        {
+            prepareFunc (*procs[idx]);
+            if (numPrepared.fetch_add (1) + 1 == procs.size())
+                allPrepared.signal();
+        }
+    }
+};
+} // namespace
+
+ProcessorChainPrepareHelper::ProcessorChainPrepareHelper (ProcessorChain& procChain) : chain (procChain)
+{
+    startTimer (50);
+}
+
+ProcessorChainPrepareHelper::~ProcessorChainPrepareHelper()
+{
+    stopTimer();
+    backgroundJobFinished.wait (-1);
+}
+
+void ProcessorChainPrepareHelper::prepareProcessors (const std::vector<BaseProcessor*>& procsToPrepare, int osFactor)
+{
+    if (procsToPrepare.empty())
+        return;
+
+    auto batch = std::make_shared<PrepareBatch>();
+    batch->procs = procsToPrepare;
+    batch->prepareFunc = [this, osFactor] (BaseProcessor& proc)
+    { chain.prepareProcessor (proc, osFactor); };
+
+    // This thread prepares processors as well, so it never has to wait for the pool
+    // to get around to the batch. Any helpers that start after all the processors
+    // have been claimed will just return straight away.
+    const auto numHelpers = jmin ((int) procsToPrepare.size() - 1, threadPool->pool.getNumThreads());
+    for (int i = 0; i < numHelpers; ++i)
+        threadPool->pool.addJob ([batch]
+                                 { batch->help(); });
+
+    batch->help();
+    batch->allPrepared.wait (-1);
+}
+
+void ProcessorChainPrepareHelper::runInBackground (std::function<void()>&& job)
+{
+    backgroundJobFinished.reset();
+    threadPool->pool.addJob ([this, job = std::move (job)]
+                             {
+                                 job();
+                                 backgroundJobFinished.signal(); });
+}
+
+void ProcessorChainPrepareHelper::timerCallback()
+{
+    if (! backgroundJobFinished.wait (0))
+        return;
+
+    switch (state)
+    {
+        case State::Idle:
+        {
+            // compare against the latest plan, since the audio thread may still be catching up to it
+            const auto newOSFactor = chain.ioProcessor.getRequestedOversamplingFactor();
+            if (newOSFactor != chain.planSwapHelper->getLatestPlan().getOversamplingFactor())
+                startOversamplingFactorChange (newOSFactor);
+            break;
+        }
+        case State::PreparingShadowChain:
+        {
+            // if the graph or the oversampling factor have changed in the meantime, we need to start over
+            if (shadowChain->sourcePlanNumber != chain.planSwapHelper->getLatestPlan().sequenceNumber
+                || shadowChain->osFactor != chain.ioProcessor.getRequestedOversamplingFactor())
+            {
+                shadowChain.reset();
+                state = State::Idle;
+                break;
+            }
+
+            syncShadowChainParameters();
+            shadowChain->shadowPlanNumber = chain.planSwapHelper->publishShadowPlan (*shadowChain->inputProcessor,
+                                                                                     *shadowChain->outputProcessor,
+                                                                                     shadowChain->procs,
+                                                                                     shadowChain->osFactor);
+            shadowChain->wasPublished = true;
+            state = State::SwappingToShadowChain;
+            break;
+        }
+        case State::SwappingToShadowChain:
+        {
+            syncShadowChainParameters();
+
+            if (! chain.planSwapHelper->isAudioThreadUsingPlan (shadowChain->shadowPlanNumber))
+            {
+                // The oversampling factor has changed again, so the audio thread won't swap to the shadow
+                // chain. The chain's own processors haven't been touched yet, so we can go back to them.
+                if (shadowChain->osFactor != chain.ioProcessor.getRequestedOversamplingFactor())
+                    chain.planSwapHelper->publishPlan(); // also retires the shadow chain
+                break;
+            }
+
+            // hand the audio thread back to the chain's own processors
+            prepareChainProcessors();
+            chain.planSwapHelper->publishPlan(); // also retires the shadow chain
+            break;
+        }
+    }
+}
+
+void ProcessorChainPrepareHelper::syncShadowChainParameters()
+{
+    // copy over any automation or UI changes that were made since the shadow chain was copied
+    for (const auto& [proc, procCopy] : shadowChain->procCopies)
+    {
+        const auto& params = proc->getParameters();
+        const auto& paramCopies = procCopy->getParameters();
+        jassert (params.size() == paramCopies.size());
+
+        for (int i = 0; i < jmin (params.size(), paramCopies.size()); ++i)
+        {
+            const auto value = params[i]->getValue();
+            if (paramCopies[i]->getValue() != value)
+                paramCopies[i]->setValueNotifyingHost (value);
+        }
+    }
+}
+
+void ProcessorChainPrepareHelper::prepareChainProcessors()
+{
+    // The audio thread has let go of the chain's own processors, so now we can prepare
+    // them at whichever rate the audio thread has switched to (usually the new rate).
+    const auto osFactor = chain.ioProcessor.getOversamplingFactor();
+
+    std::vector<BaseProcessor*> procsToPrepare (chain.procs.begin(), chain.procs.end());
+    procsToPrepare.push_back (&chain.inputProcessor);
+    procsToPrepare.push_back (&chain.outputProcessor);
+    prepareProcessors (procsToPrepare, osFactor);
+
+    chain.procsOversamplingFactor.store (osFactor);
+}
+
+void ProcessorChainPrepareHelper::startOversamplingFactorChange (int newOSFactor)
+{
+    Logger::writeToLog ("Preparing processor chain for " + String (newOSFactor) + "x oversampling");
+
+    shadowChain = std::make_unique<ShadowChain>();
+    shadowChain->osFactor = newOSFactor;
+    shadowChain->sourcePlanNumber = chain.planSwapHelper->getLatestPlan().sequenceNumber;
+
+    // copy the processors...
+    std::unordered_map<BaseProcessor*, BaseProcessor*> procCopies;
+    const auto copyState = [&procCopies] (BaseProcessor& proc, BaseProcessor& procCopy)
+    {
+        procCopy.fromXML (proc.toXML().get(), chowdsp::Version { std::string_view { JucePlugin_VersionString } }, false);
+        procCopies[&proc] = &procCopy;
+    };
+
+    shadowChain->inputProcessor = std::make_unique<InputProcessor>();
+    copyState (chain.inputProcessor, *shadowChain->inputProcessor);
+    shadowChain->outputProcessor = std::make_unique<OutputProcessor>();
+    copyState (chain.outputProcessor, *shadowChain->outputProcessor);
+
+    for (auto* proc : chain.procs)
+    {
+        auto procCopy = ProcessorStore::createProcessorCopy (*proc);
+        if (procCopy == nullptr)
+        {
+            jassertfalse; // all the processors in the chain should have come from the store!
+            continue;
+        }
+
+        procCopies[proc] = procCopy.get();
+        shadowChain->procs.add (std::move (procCopy));
+    }
+
+    // ... and their connections
+    for (const auto& [proc, procCopy] : procCopies)
+    {
+        for (int portIdx = 0; portIdx < proc->getNumOutputs(); ++portIdx)
+        {
+            for (int cIdx = 0; cIdx < proc->getNumOutputConnections (portIdx); ++cIdx)
+            {
+                const auto& connection = proc->getOutputConnection (portIdx, cIdx);
+                if (const auto endProcIter = procCopies.find (connection.endProc); endProcIter != procCopies.end())
+                    procCopy->addConnection ({ procCopy, connection.startPort, endProcIter->second, connection.endPort });
+            }
+        }
+    }
+
+    shadowChain->procCopies.assign (procCopies.begin(), procCopies.end());
+
+    std::vector<BaseProcessor*> procsToPrepare (shadowChain->procs.begin(), shadowChain->procs.end());
+    procsToPrepare.push_back (shadowChain->inputProcessor.get());
+    procsToPrepare.push_back (shadowChain->outputProcessor.get());
+
+    runInBackground ([this, procsToPrepare = std::move (procsToPrepare), newOSFactor]
+                     { prepareProcessors (procsToPrepare, newOSFactor); });
+    state = State::PreparingShadowChain;
+}
+
+void ProcessorChainPrepareHelper::finishOversamplingFactorChange()
+{
+    // The change to the chain will publish a new plan for the chain's own processors (which also retires
+    // the shadow chain), so if the audio thread has already swapped to the new rate, they need to catch up.
+    if (state != State::SwappingToShadowChain || ! chain.planSwapHelper->isAudioThreadUsingPlan (shadowChain->shadowPlanNumber))
+        return;
+
+    prepareChainProcessors();
+}
+
+void ProcessorChainPrepareHelper::retireShadowChain()
+{
+    if (shadowChain == nullptr || ! shadowChain->wasPublished)
+        return;
+
+    // The latest plan uses the chain's own processors, so we're done with the shadow chain.
+    // The audio thread may still be using it though, so let the plan swap helper delete it.
+    state = State::Idle;
+
+    auto& planSwapHelper = *chain.planSwapHelper;
+    planSwapHelper.retireProcessor (std::move (shadowChain->inputProcessor));
+    planSwapHelper.retireProcessor (std::move (shadowChain->outputProcessor));
+    while (! shadowChain->procs.isEmpty())
+        planSwapHelper.retireProcessor (BaseProcessor::Ptr { shadowChain->procs.removeAndReturn (shadowChain->procs.size() - 1) });
+
+    shadowChain.reset();
+}
+
+void ProcessorChainPrepareHelper::cancelOversamplingFactorChange()
+{
+    backgroundJobFinished.wait (-1);
+
+    const auto shadowChainWasPublished = shadowChain != nullptr && shadowChain->wasPublished;
+    state = State::Idle;
+
+    if (shadowChainWasPublished)
+        chain.planSwapHelper->publishPlan(); // also retires the shadow chain
+    shadowChain.reset();
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "ProcessorChain.h"
+
+/**
+ * Prepares the processors in the chain, using a pool of background threads
+ * so that the processors can be prepared in parallel.
+ *
+ * When the oversampling factor changes, the audio thread keeps running at the
+ * old rate, while a "shadow" copy of the chain is prepared in the background
+ * at the new rate. Once the shadow chain is ready, the audio thread swaps over
+ * to it, and then the chain's own processors are prepared on the message thread
+ * (so that nothing else can touch them while they're being prepared). Finally,
+ * the audio thread is handed back to the chain's own processors, and the shadow
+ * chain is discarded.
+ *
+ * The shadow chain is never seen by the UI, so the editors (and undo history)
+ * can keep pointing to the chain's own processors the whole time. Any parameter
+ * changes made in the meantime are copied over to the shadow chain before it's
+ * swapped in, and for as long as the audio thread is using it.
+ */
+class ProcessorChainPrepareHelper : private Timer
+{
+public:
+    explicit ProcessorChainPrepareHelper (ProcessorChain& procChain);
+    ~ProcessorChainPrepareHelper() override;
+
+    /** Prepares the processors in parallel, and waits for them all to finish. */
+    void prepareProcessors (const std::vector<BaseProcessor*>& procsToPrepare, int osFactor);
+
+    /**
+     * If the audio thread is running the shadow chain, this prepares the chain's own
+     * processors for the new oversampling factor. Should be called before making any
+     * changes to the chain.
+     */
+    void finishOversamplingFactorChange();
+
+    /** Discards the shadow chain, once the latest plan no longer needs it. */
+    void retireShadowChain();
+
+    /** Abandons any oversampling factor change in progress. Should be called while the audio thread is not running. */
+    void cancelOversamplingFactorChange();
+
+private:
+    void timerCallback() override;
+
+    void startOversamplingFactorChange (int newOSFactor);
+    void syncShadowChainParameters();
+    void prepareChainProcessors();
+    void runInBackground (std::function<void()>&& job);
+
+    enum class State
+    {
+        Idle,
+        PreparingShadowChain, // the shadow chain is being prepared in the background
+        SwappingToShadowChain, // the audio thread is picking up (or running) the shadow chain
+    };
+
+    struct ShadowChain
+    {
+        std::unique_ptr<InputProcessor> inputProcessor;
+        std::unique_ptr<OutputProcessor> outputProcessor;
+        OwnedArray<BaseProcessor> procs;
+        std::vector<std::pair<BaseProcessor*, BaseProcessor*>> procCopies; // { chain processor, shadow copy }
+
+        int osFactor = 1;
+        uint64_t sourcePlanNumber = 0; // the chain plan that the shadow chain was copied from
+        uint64_t shadowPlanNumber = 0; // the plan for the shadow chain itself
+        bool wasPublished = false;
+    };
+
+    struct PrepareThreadPool
+    {
+        ThreadPool pool { jlimit (1, 8, SystemStats::getNumCpus()) };
+    };
+
+    ProcessorChain& chain;
+
+    State state = State::Idle;
+    std::unique_ptr<ShadowChain> shadowChain;
+
+    SharedResourcePointer<PrepareThreadPool> threadPool;
+    WaitableEvent backgroundJobFinished { true };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ProcessorChainPrepareHelper)
+};
@@ -0,0 +1,160 @@
+#include "ProcessorChainWorkerPool.h"
+
+class ProcessorChainWorkerPool::Worker : public Thread
+{
+public:
+    Worker (ProcessorChainWorkerPool& workerPool, int index) : Thread ("BYOD Audio Worker " + String (index)),
+                                                               pool (workerPool)
+    {
+    }
+
+    void run() override
+    {
+        auto lastBlock = pool.blockCounter.load();
+        int idleCount = 0;
+        while (! threadShouldExit())
+        {
+            const auto block = pool.blockCounter.load();
+            if (block != lastBlock)
+            {
+                lastBlock = block;
+                idleCount = 0;
+                pool.helpWithCurrentBlock();
+            }
+            else if (++idleCount > maxSpinCount + maxYieldCount)
+            {
+                // nothing's happened for a while, so poll less often until the next block comes along
+                wait (1);
+            }
+            else if (idleCount > maxSpinCount)
+            {
+                Thread::yield();
+            }
+        }
+    }
+
+private:
+    ProcessorChainWorkerPool& pool;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Worker)
+};
+
+ProcessorChainWorkerPool::ProcessorChainWorkerPool()
+{
+    pluginSettings->addProperties<&ProcessorChainWorkerPool::globalSettingChanged> ({ { multiCoreProcessingID, false } }, *this);
+    globalSettingChanged (multiCoreProcessingID);
+}
+
+ProcessorChainWorkerPool::~ProcessorChainWorkerPool()
+{
+    pluginSettings->removePropertyListener (*this);
+
+    multiCoreEnabled.store (false);
+    stopWorkers();
+}
+
+void ProcessorChainWorkerPool::globalSettingChanged (SettingID settingID)
+{
+    if (settingID != multiCoreProcessingID)
+        return;
+
+    const auto isNowOn = pluginSettings->getProperty<bool> (settingID);
+    Logger::writeToLog ("Turning multi-core processing: " + String (isNowOn ? "ON" : "OFF"));
+
+    if (isNowOn)
+    {
+        // the workers need to be running before the audio thread is allowed to use them
+        if (workers.isEmpty())
+            startWorkers();
+        multiCoreEnabled.store (true);
+    }
+    else
+    {
+        multiCoreEnabled.store (false);
+        stopWorkers();
+    }
+}
+
+void ProcessorChainWorkerPool::startWorkers()
+{
+    const auto numWorkers = jlimit (1, maxNumWorkers, SystemStats::getNumPhysicalCpus() - 1);
+    for (int i = 0; i < numWorkers; ++i)
+        workers.add (std::make_unique<Worker> (*this, i))->startRealtimeThread (Thread::RealtimeOptions {});
+}
+
+void ProcessorChainWorkerPool::stopWorkers()
+{
+    // Multi-core processing has already been turned off, so once the audio thread
+    // (and any workers that are still helping out) have finished the current block,
+    // nothing is going to use the workers again.
+    while (audioThreadIsUsingWorkers.load() || numActiveWorkers.load() > 0)
+        Thread::sleep (1);
+
+    for (auto* worker : workers)
+        worker->signalThreadShouldExit();
+
+    for (auto* worker : workers)
+        worker->stopThread (1000);
+
+    workers.clear();
+}
+
+void ProcessorChainWorkerPool::processReadySteps (ProcessorChainExecutionPlan& plan, bool isAudioThread)
+{
+    // Steps are usually short, so the audio thread just spins until the steps that
+    // are in progress on other threads have queued up some more steps (or finished).
+    // Workers spin and yield for a little while, and then leave the rest of the block
+    // to the audio thread, so that the audio thread is never left waiting on a worker
+    // that has gone to sleep.
+    int idleCount = 0;
+    while (! plan.isParallelProcessingFinished())
+    {
+        if (plan.processNextReadyStep())
+            idleCount = 0;
+        else if (isAudioThread)
+            continue;
+        else if (++idleCount > maxSpinCount + maxYieldCount)
+            return;
+        else if (idleCount > maxSpinCount)
+            Thread::yield();
+    }
+}
+
+void ProcessorChainWorkerPool::helpWithCurrentBlock()
+{
+    numActiveWorkers.fetch_add (1);
+    if (auto* plan = currentPlan.load())
+        processReadySteps (*plan, false);
+    numActiveWorkers.fetch_sub (1);
+}
+
+bool ProcessorChainWorkerPool::process (ProcessorChainExecutionPlan& plan, AudioBuffer<float>& inputBuffer, const MidiBuffer& midiBuffer, const MidiBuffer& baseRateMidiBuffer)
+{
+    if (! plan.hasParallelBranches())
+        return plan.process (inputBuffer, midiBuffer, baseRateMidiBuffer);
+
+    // Let the message thread know we might be using the workers, before checking
+    // whether it has turned them off (see stopWorkers()).
+    audioThreadIsUsingWorkers.store (true);
+    if (! multiCoreEnabled.load())
+    {
+        audioThreadIsUsingWorkers.store (false);
+        return plan.process (inputBuffer, midiBuffer, baseRateMidiBuffer);
+    }
+
+    plan.startParallelProcessing (inputBuffer, midiBuffer, baseRateMidiBuffer);
+    currentPlan.store (&plan);
+    blockCounter.fetch_add (1);
+
+    // The audio thread processes steps as well, so if the workers are slow to wake up, it can do all the work itself.
+    processReadySteps (plan, true);
+
+    // Join: all the steps are finished, so the workers just need to notice that, and let go of the plan.
+    // After that, it's safe to use the plan again for the next block.
+    currentPlan.store (nullptr);
+    while (numActiveWorkers.load() > 0)
+        continue;
+
+    audioThreadIsUsingWorkers.store (false);
+    return plan.isOutputReachable();
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "ProcessorChainExecutionPlan.h"
+
+/**
+ * An optional pool of audio worker threads, for processing independent
+ * branches of the processor graph (e.g. after a band splitter, or any other
+ * fan-out) on multiple cores.
+ *
+ * The audio thread starts each block by bumping an atomic block counter, which
+ * the workers poll, and then all the threads pull steps from the execution plan
+ * as they become ready. The audio thread only ever touches atomics: it processes
+ * steps alongside the workers, and spins while it waits for any steps that are
+ * still in progress on other threads, so it never waits on a lock or a sleeping
+ * worker. Workers that run out of steps spin and yield for a little while, and
+ * then go back to polling for the next block, with a 1 ms wait between polls
+ * once they have been idle for a while.
+ *
+ * The workers are real-time threads, so that they are scheduled like the audio
+ * thread that is waiting on them. They are only running while multi-core
+ * processing is turned on.
+ */
+class ProcessorChainWorkerPool
+{
+public:
+    using SettingID = chowdsp::GlobalPluginSettings::SettingID;
+
+    ProcessorChainWorkerPool();
+    ~ProcessorChainWorkerPool();
+
+    void globalSettingChanged (SettingID settingID);
+
+    /**
+     * Runs the plan on the given input buffer, using the worker threads if possible.
+     * Returns true if the output processor was processed.
+     */
+    bool process (ProcessorChainExecutionPlan& plan, AudioBuffer<float>& inputBuffer, const MidiBuffer& midiBuffer, const MidiBuffer& baseRateMidiBuffer);
+
+    static constexpr SettingID multiCoreProcessingID = "multi_core_processing";
+
+private:
+    class Worker;
+    void startWorkers();
+    void stopWorkers();
+    void helpWithCurrentBlock();
+    void processReadySteps (ProcessorChainExecutionPlan& plan, bool isAudioThread);
+
+    OwnedArray<Worker> workers;
+    std::atomic<uint32_t> blockCounter { 0 };
+    std::atomic<ProcessorChainExecutionPlan*> currentPlan { nullptr };
+    std::atomic<int> numActiveWorkers { 0 };
+    std::atomic_bool multiCoreEnabled { false };
+    std::atomic_bool audioThreadIsUsingWorkers { false };
+
+    chowdsp::SharedPluginSettings pluginSettings;
+
+    static constexpr int maxNumWorkers = 4;
+    static constexpr int maxSpinCount = 256;
+    static constexpr int maxYieldCount = 64;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ProcessorChainWorkerPool)
+};
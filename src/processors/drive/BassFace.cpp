@@ -25,13 +25,11 @@ void BassFace::prepare (double sampleRate, int samplesPerBlock)
 {
     if ((int) sampleRate % 44100 == 0)
     {
-        for (auto& m : model)
-            m.initialise (BinaryData::bass_face_model_88_2k_json, BinaryData::bass_face_model_88_2k_jsonSize, 88200.0);
+        model.initialise (BinaryData::bass_face_model_88_2k_bin, BinaryData::bass_face_model_88_2k_binSize, 88200.0);
     }
     else
     {
-        for (auto& m : model)
-            m.initialise (BinaryData::bass_face_model_96k_json, BinaryData::bass_face_model_96k_jsonSize, 96000.0);
+        model.initialise (BinaryData::bass_face_model_96k_bin, BinaryData::bass_face_model_96k_binSize, 96000.0);
     }
 
     const size_t oversamplingOrder = sampleRate <= 48000.0 ? 1 : 0;
@@ -40,8 +38,7 @@ void BassFace::prepare (double sampleRate, int samplesPerBlock)
     const auto osSampleRate = sampleRate * (double) oversampling->getOversamplingFactor();
     const auto osSamplesPerBlock = samplesPerBlock * (int) oversampling->getOversamplingFactor();
 
-    for (auto& m : model)
-        m.prepare (osSampleRate, osSamplesPerBlock);
+    model.prepare (osSampleRate, osSamplesPerBlock);
 
     gainSmoothed.prepare (osSampleRate, osSamplesPerBlock);
     gainSmoothed.setRampLength (0.05);
@@ -60,8 +57,6 @@ void BassFace::prepare (double sampleRate, int samplesPerBlock)
 
 void BassFace::processAudio (AudioBuffer<float>& buffer)
 {
-    const auto numChannels = buffer.getNumChannels();
-
     {
         auto&& block = dsp::AudioBlock<float> { buffer };
         auto&& osBlock = oversampling->processSamplesUp (block);
@@ -70,11 +65,7 @@ void BassFace::processAudio (AudioBuffer<float>& buffer)
         gainSmoothed.process (osNumSamples);
         const auto* gainData = gainSmoothed.getSmoothedBuffer();
 
-        for (int ch = 0; ch < numChannels; ++ch)
-        {
-            auto&& channelBlock = osBlock.getSingleChannelBlock ((size_t) ch);
-            model[ch].process (channelBlock, { gainData, (size_t) osNumSamples });
-        }
+        model.process (chowdsp::BufferView<float> { osBlock }, { gainData, (size_t) osNumSamples });
 
         oversampling->processSamplesDown (block);
     }
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "neural_utils/ResampledRNNAccelerated.h"
+#include "neural_utils/ResampledStereoRNNAccelerated.h"
 
 #include "../BaseProcessor.h"
 
@@ -10,6 +10,7 @@ public:
     explicit BassFace (UndoManager* um);
 
     ProcessorType getProcessorType() const override { return Drive; }
+    double getTailLengthSeconds() const override { return 0.1; } // give the network state some time to settle
     static ParamLayout createParameterLayout();
 
     void prepare (double sampleRate, int samplesPerBlock) override;
@@ -19,7 +20,7 @@ private:
     chowdsp::SmoothedBufferValue<float> gainSmoothed;
 
     static constexpr int hiddenSize = 24;
-    ResampledRNNAccelerated<2, hiddenSize> model[2];
+    ResampledStereoRNNAccelerated<2, hiddenSize> model;
 
     std::optional<dsp::Oversampling<float>> oversampling;
 
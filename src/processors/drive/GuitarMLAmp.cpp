@@ -5,9 +5,9 @@
 namespace
 {
 const juce::StringArray guitarMLModelResources {
-    "BluesJrAmp_VolKnob_json",
-    "TS9_DriveKnob_json",
-    "MesaRecMini_ModernChannel_GainKnob_json",
+    "BluesJrAmp_VolKnob_bin",
+    "TS9_DriveKnob_bin",
+    "MesaRecMini_ModernChannel_GainKnob_bin",
 };
 
 const juce::StringArray guitarMLModelNames {
@@ -23,10 +23,162 @@ const String gainTag = "gain";
 const String conditionTag = "condition";
 const String sampleRateCorrFilterTag = "sample_rate_corr_filter";
 const String customModelTag = "custom_model";
+const String customModelHashTag = "custom_model_hash";
+const String customModelNameTag = "custom_model_name";
 constexpr std::string_view modelNameTag = "byod_guitarml_model_name";
 } // namespace
 
-GuitarMLAmp::GuitarMLAmp (UndoManager* um) : BaseProcessor ("GuitarML", createParameterLayout(), um)
+struct GuitarMLAmp::ModelSet
+{
+    void initialise (const ModelWeights& modelWeights, ModelArch modelArchitecture, float normGain)
+    {
+        arch = modelArchitecture;
+        modelSampleRate = modelWeights.getMetadata().at ("model_data").value ("sample_rate", 44100.0);
+        normalizationGain = normGain;
+
+        modelKey = StateAssets::hashToString (modelWeights.getContentHash()) + "|" + String (normalizationGain);
+
+        const auto initialiseModel = [&modelWeights] (auto& model)
+        { model.initialise (modelWeights); };
+
+        if (arch == ModelArch::LSTM40NoCond)
+        {
+            LSTM40NoCond::emplace (lstm40NoCondModel);
+            lstm40NoCondModel.visit (initialiseModel);
+        }
+        else if (arch == ModelArch::LSTM40Cond)
+        {
+            LSTM40Cond::emplace (lstm40CondModel);
+            lstm40CondModel.visit (initialiseModel);
+        }
+    }
+
+    void prepare (double sampleRate, int samplesPerBlock, float inGainDB)
+    {
+        processSampleRate = sampleRate;
+
+        const auto rnnDelaySamples = jmax (1.0, sampleRate / modelSampleRate);
+        const auto prepareModel = [rnnDelaySamples] (auto& model)
+        { model.prepare ((float) rnnDelaySamples); };
+
+        if (arch == ModelArch::LSTM40NoCond)
+            lstm40NoCondModel.visit (prepareModel);
+        else if (arch == ModelArch::LSTM40Cond)
+            lstm40CondModel.visit (prepareModel);
+
+        inGain.prepare ({ sampleRate, (uint32) samplesPerBlock, 2 });
+        inGain.setRampDurationSeconds (0.1);
+        inGain.setGainDecibels (inGainDB);
+        inGain.reset();
+
+        sampleRateCorrectionFilter.prepare (2);
+        sampleRateCorrectionFilter.calcCoefs (8100.0f,
+                                              chowdsp::CoefficientCalculators::butterworthQ<float>,
+                                              (sampleRate < modelSampleRate * 1.1) ? 1.0f : 0.25f,
+                                              (float) sampleRate);
+    }
+
+    std::vector<float> getState()
+    {
+        std::vector<float> state;
+        const auto getModelState = [&state] (auto& model)
+        { state = model.get_state(); };
+
+        if (arch == ModelArch::LSTM40NoCond)
+            lstm40NoCondModel.visit (getModelState);
+        else if (arch == ModelArch::LSTM40Cond)
+            lstm40CondModel.visit (getModelState);
+
+        return state;
+    }
+
+    void setState (const std::vector<float>& state)
+    {
+        const auto setModelState = [&state] (auto& model)
+        { model.set_state (state); };
+
+        if (arch == ModelArch::LSTM40NoCond)
+            lstm40NoCondModel.visit (setModelState);
+        else if (arch == ModelArch::LSTM40Cond)
+            lstm40CondModel.visit (setModelState);
+    }
+
+    /** Runs some silence through the models, so that they have settled down before they're used for real. */
+    void preBuffer (int samplesPerBlock, float inGainDB, float condition)
+    {
+        AudioBuffer<float> buffer (2, samplesPerBlock);
+        const std::vector<float> conditionData ((size_t) samplesPerBlock, condition);
+        for (int i = 0; i < 5000; i += samplesPerBlock)
+        {
+            buffer.clear();
+            process (buffer, conditionData, inGainDB, false);
+        }
+    }
+
+    void process (AudioBuffer<float>& buffer, std::span<const float> condition, float inGainDB, bool useSampleRateCorrectionFilter)
+    {
+        const auto numSamples = buffer.getNumSamples();
+        const auto left = std::span { buffer.getWritePointer (0), (size_t) numSamples };
+        const auto right = buffer.getNumChannels() > 1 ? std::span { buffer.getWritePointer (1), (size_t) numSamples } : std::span<float> {};
+
+        if (arch == ModelArch::LSTM40NoCond)
+        {
+            inGain.setGainDecibels (inGainDB);
+            inGain.process (buffer);
+
+            lstm40NoCondModel.visit ([left, right] (auto& model)
+                                     { model.process (left, right, true); });
+        }
+        else if (arch == ModelArch::LSTM40Cond)
+        {
+            lstm40CondModel.visit ([left, right, condition = condition.first ((size_t) numSamples)] (auto& model)
+                                   { model.process_conditioned (left, right, condition, true); });
+        }
+
+        if (useSampleRateCorrectionFilter)
+            sampleRateCorrectionFilter.processBlock (buffer);
+
+        buffer.applyGain (normalizationGain);
+    }
+
+    ModelArch arch = ModelArch::LSTM40NoCond;
+    String modelKey; // identifies the model weights and normalization, for steady-state snapshots
+    double modelSampleRate = 44100.0;
+    double processSampleRate = 0.0;
+    float normalizationGain = 1.0f;
+
+    LSTM40Cond::Variant lstm40CondModel;
+    LSTM40NoCond::Variant lstm40NoCondModel;
+    chowdsp::Gain<float> inGain;
+    chowdsp::HighShelfFilter<float> sampleRateCorrectionFilter;
+};
+
+/** State shared between the processor and its background loading jobs, which may outlive the processor. */
+struct GuitarMLAmp::ModelLoaderState
+{
+    ~ModelLoaderState()
+    {
+        delete pendingModelSet.exchange (nullptr);
+    }
+
+    std::atomic<ModelSet*> pendingModelSet { nullptr };
+    std::atomic<int> numLoadsInFlight { 0 };
+    WaitableEvent loadsFinished; // signalled when numLoadsInFlight drops to zero
+};
+
+/** A single background thread that's shared between all the GuitarML processors, so that models are loaded in order. */
+struct GuitarMLAmp::ModelLoaderThreadPool
+{
+    ~ModelLoaderThreadPool()
+    {
+        pool.removeAllJobs (true, 1000);
+    }
+
+    ThreadPool pool { 1 };
+};
+
+GuitarMLAmp::GuitarMLAmp (UndoManager* um) : BaseProcessor ("GuitarML", createParameterLayout(), um),
+                                             loaderState (std::make_shared<ModelLoaderState>())
 {
     using namespace ParameterHelpers;
     loadParameterPointer (gainParam, vts, gainTag);
@@ -35,26 +187,20 @@ GuitarMLAmp::GuitarMLAmp (UndoManager* um) : BaseProcessor ("GuitarML", createPa
     addPopupMenuParameter (sampleRateCorrFilterTag);
 
     loadModel (0); // load Blues Jr. model by default
+    loadModelsInBackground = true;
 
     uiOptions.backgroundColour = Colours::cornsilk.darker();
     uiOptions.powerColour = Colours::cyan;
     uiOptions.info.description = "An implementation of the neural LSTM guitar amp modeller used by the GuitarML project. Supports loading custom models that are compatible with the GuitarML Protues plugin";
     uiOptions.info.authors = StringArray { "Keith Bloemer", "Jatin Chowdhury" };
     uiOptions.info.infoLink = "https://guitarml.com";
-
-#if 0 // JUCE_INTEL
-    if (juce::SystemStats::hasAVX() && juce::SystemStats::hasFMA3())
-    {
-        juce::Logger::writeToLog ("Using RNN model with AVX SIMD instructions!");
-        lstm40CondModels[0].template emplace<rnn_avx::RNNAccelerated<2, 40, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::LinInterp>>();
-        lstm40CondModels[1].template emplace<rnn_avx::RNNAccelerated<2, 40, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::LinInterp>>();
-        lstm40NoCondModels[0].template emplace<rnn_avx::RNNAccelerated<1, 40, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::LinInterp>>();
-        lstm40NoCondModels[1].template emplace<rnn_avx::RNNAccelerated<1, 40, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::LinInterp>>();
-    }
-#endif
 }
 
-GuitarMLAmp::~GuitarMLAmp() = default;
+GuitarMLAmp::~GuitarMLAmp()
+{
+    stopTimer();
+    delete retiredModelSet.exchange (nullptr);
+}
 
 ParamLayout GuitarMLAmp::createParameterLayout()
 {
@@ -68,82 +214,96 @@ ParamLayout GuitarMLAmp::createParameterLayout()
     return { params.begin(), params.end() };
 }
 
-void GuitarMLAmp::loadModelFromJson (const chowdsp::json& modelJson, const String& newModelName)
+GuitarMLAmp::ModelArch GuitarMLAmp::getModelArch (const ModelWeights& modelWeights)
 {
-    const auto& modelDataJson = modelJson.at ("model_data");
+    const auto& modelDataJson = modelWeights.getMetadata().at ("model_data");
     const auto numInputs = modelDataJson.value ("input_size", 1);
     const auto hiddenSize = modelDataJson.value ("hidden_size", 0);
-    const auto modelSampleRate = modelDataJson.value ("sample_rate", 44100.0);
-    const auto rnnDelaySamples = jmax (1.0, processSampleRate / modelSampleRate);
-
-    sampleRateCorrectionFilter.reset();
-    sampleRateCorrectionFilter.calcCoefs (8100.0f,
-                                          chowdsp::CoefficientCalculators::butterworthQ<float>,
-                                          (processSampleRate < modelSampleRate * 1.1) ? 1.0f : 0.25f,
-                                          (float) processSampleRate);
 
     if (numInputs == 1 && hiddenSize == 40) // non-conditioned LSMT40
-    {
-        SpinLock::ScopedLockType modelChangingLock { modelChangingMutex };
-        for (auto& modelVariant : lstm40NoCondModels)
-        {
-            modelVariant.visit (
-                [rnnDelaySamples, &modelJson] (auto& model)
-                {
-                    model.initialise (modelJson);
-                    model.prepare ((float) rnnDelaySamples);
-                });
-        }
+        return ModelArch::LSTM40NoCond;
 
-        modelArch = ModelArch::LSTM40NoCond;
-    }
-    else if (numInputs == 2 && hiddenSize == 40) // conditioned LSMT40
-    {
-        SpinLock::ScopedLockType modelChangingLock { modelChangingMutex };
-        for (auto& modelVariant : lstm40CondModels)
-        {
-            modelVariant.visit (
-                [rnnDelaySamples, &modelJson] (auto& model)
-                {
-                    model.initialise (modelJson);
-                    model.prepare ((float) rnnDelaySamples);
-                });
-        }
+    if (numInputs == 2 && hiddenSize == 40) // conditioned LSMT40
+        return ModelArch::LSTM40Cond;
+
+    // unsupported number of inputs!
+    throw std::exception();
+}
+
+void GuitarMLAmp::loadModelFromWeights (SharedAssetCache::AssetPtr<ModelWeights> modelWeights, const String& newModelName, float newNormalizationGain)
+{
+    // check the architecture up front, so that unsupported models are still reported to the caller
+    const auto newModelArch = getModelArch (*modelWeights);
 
-        modelArch = ModelArch::LSTM40Cond;
-        conditionParam.reset();
+    if (! loadModelsInBackground)
+    {
+        // the processor hasn't been constructed yet, so we can load the model in place
+        activeModelSet = std::make_unique<ModelSet>();
+        activeModelSet->initialise (*modelWeights, newModelArch, newNormalizationGain);
+        activeModelSet->prepare (processSampleRate, processBlockSize, gainParam->get() - 12.0f);
     }
     else
     {
-        // unsupported number of inputs!
-        throw std::exception();
+        // load the weights and pre-buffer the new models on the background thread,
+        // and then leave them for the audio thread to pick up at the start of the next block.
+        loaderState->numLoadsInFlight.fetch_add (1);
+        loaderThreadPool->pool.addJob (
+            [state = loaderState,
+             modelWeights,
+             newModelArch,
+             newNormalizationGain,
+             sampleRate = processSampleRate,
+             samplesPerBlock = processBlockSize,
+             inGainDB = gainParam->get() - 12.0f,
+             condition = ParameterHelpers::getParameterPointer<chowdsp::FloatParameter*> (vts, conditionTag)->get()]
+            {
+                try
+                {
+                    auto newModelSet = std::make_unique<ModelSet>();
+                    newModelSet->initialise (*modelWeights, newModelArch, newNormalizationGain);
+                    newModelSet->prepare (sampleRate, samplesPerBlock, inGainDB);
+                    newModelSet->preBuffer (samplesPerBlock, inGainDB, condition);
+
+                    // if the audio thread never picked up the previous model set, then it's safe to delete it here
+                    delete state->pendingModelSet.exchange (newModelSet.release());
+                }
+                catch (const std::exception& exc)
+                {
+                    Logger::writeToLog (String { "Unable to load GuitarML model weights: " } + exc.what());
+                    jassertfalse;
+                }
+
+                if (state->numLoadsInFlight.fetch_sub (1) == 1)
+                    state->loadsFinished.signal();
+            });
+
+        startTimer (100);
     }
 
-    cachedModel = modelJson;
-    if (newModelName.isNotEmpty())
-        cachedModel[modelNameTag] = newModelName;
+    modelArch = newModelArch;
+    cachedModelAsset = {};
+    cachedModel = std::move (modelWeights);
+    cachedModelName = newModelName;
 
     modelChangeBroadcaster();
 }
 
 void GuitarMLAmp::loadModel (int modelIndex, Component* parentComponent)
 {
-    normalizationGain = 1.0f;
-
     if (juce::isPositiveAndBelow (modelIndex, numBuiltInModels))
     {
         int modelDataSize = 0;
         const auto* modelData = BinaryData::getNamedResource (guitarMLModelResources[modelIndex].toRawUTF8(), modelDataSize);
         jassert (modelData != nullptr);
 
-        const auto modelJson = chowdsp::JSONUtils::fromBinaryData (modelData, modelDataSize);
-        loadModelFromJson (modelJson, guitarMLModelNames[modelIndex]);
-
         // The Mesa model is a bit loud, so let's normalize the level down a bit
         // Eventually it would be good to do this sort of thing programmatically.
         // so that it could work for custom loaded models as well.
-        if (modelIndex == 2)
-            normalizationGain = 0.5f;
+        const auto modelNormalizationGain = modelIndex == 2 ? 0.5f : 1.0f;
+
+        // the built-in models are loaded once, and shared between all the instances
+        auto modelWeights = SharedAssetCache::getInstance().getModelWeights (SharedAssetCache::getBinaryDataKey (modelData), modelData, (size_t) modelDataSize);
+        loadModelFromWeights (std::move (modelWeights), guitarMLModelNames[modelIndex], modelNormalizationGain);
     }
     else if (modelIndex == numBuiltInModels)
     {
@@ -162,8 +322,8 @@ void GuitarMLAmp::loadModel (int modelIndex, Component* parentComponent)
                                              try
                                              {
                                                  auto chosenFileStream = chosenFile.createInputStream (URL::InputStreamOptions (URL::ParameterHandling::inAddress));
-                                                 const auto& modelJson = chowdsp::JSONUtils::fromInputStream (*chosenFileStream);
-                                                 loadModelFromJson (modelJson, chosenFile.getLocalFile().getFileNameWithoutExtension());
+                                                 auto modelWeights = ModelWeights::fromJSON (chowdsp::JSONUtils::fromInputStream (*chosenFileStream));
+                                                 loadModelFromWeights (std::move (modelWeights), chosenFile.getLocalFile().getFileNameWithoutExtension());
                                              }
 #else
                 const auto chosenFile = modelChooser.getResult();
@@ -175,8 +335,8 @@ void GuitarMLAmp::loadModel (int modelIndex, Component* parentComponent)
 
                 try
                 {
-                    const auto& modelJson = chowdsp::JSONUtils::fromFile (chosenFile);
-                    loadModelFromJson (modelJson, chosenFile.getFileNameWithoutExtension());
+                    auto modelWeights = ModelWeights::fromJSON (chowdsp::JSONUtils::fromFile (chosenFile));
+                    loadModelFromWeights (std::move (modelWeights), chosenFile.getFileNameWithoutExtension());
                 }
 #endif
                                              catch (const std::exception& exc)
@@ -200,93 +360,225 @@ void GuitarMLAmp::loadModel (int modelIndex, Component* parentComponent)
 
 String GuitarMLAmp::getCurrentModelName() const
 {
-    return cachedModel.value (modelNameTag, "");
+    return cachedModelName;
 }
 
-void GuitarMLAmp::prepare (double sampleRate, int samplesPerBlock)
+void GuitarMLAmp::timerCallback()
 {
-    dsp::ProcessSpec spec { sampleRate, (uint32) samplesPerBlock, 2 };
-    inGain.prepare (spec);
-    inGain.setRampDurationSeconds (0.1);
-
-    sampleRateCorrectionFilter.prepare (2);
+    delete retiredModelSet.exchange (nullptr);
+
+    // The order of these checks matters: the audio thread marks the swap before it takes
+    // the pending models, and retires the old models before it un-marks the swap, so we
+    // can't miss a set of models that still needs to be reclaimed.
+    if (loaderState->numLoadsInFlight.load() == 0
+        && loaderState->pendingModelSet.load() == nullptr
+        && ! isSwappingModels.load()
+        && retiredModelSet.load() == nullptr)
+        stopTimer();
+}
 
+void GuitarMLAmp::prepare (double sampleRate, int samplesPerBlock)
+{
     conditionParam.prepare (sampleRate, samplesPerBlock);
     conditionParam.setRampLength (0.05);
 
     processSampleRate = sampleRate;
-    loadModelFromJson (cachedModel);
+    processBlockSize = samplesPerBlock;
+
+    // The audio thread isn't running, so we can wait for any models that are
+    // still loading, and then swap to the latest one straight away. Rather than
+    // re-parsing the model weights, we just re-prepare the models that are
+    // already loaded for the new sample rate.
+    while (loaderState->numLoadsInFlight.load() > 0)
+        loaderState->loadsFinished.wait (100);
+
+    if (auto* pendingModelSet = loaderState->pendingModelSet.exchange (nullptr))
+        activeModelSet.reset (pendingModelSet);
+    fadingOutModelSet.reset();
+    delete retiredModelSet.exchange (nullptr);
+    isSwappingModels.store (false);
+
+    activeModelSet->prepare (sampleRate, samplesPerBlock, gainParam->get() - 12.0f);
+
+    fadeBuffer.setSize (2, samplesPerBlock);
+    fadeLengthSamples = jmax (1, (int) (fadeTimeSeconds * sampleRate));
+    fadeSamplesRemaining = 0;
 
     dcBlocker.prepare (sampleRate, samplesPerBlock);
 
-    // pre-buffering
-    AudioBuffer<float> buffer (2, samplesPerBlock);
-    for (int i = 0; i < 5000; i += samplesPerBlock)
+    // the settled state of the conditioned models depends on the condition parameter
+    auto steadyStateKey = activeModelSet->modelKey;
+    if (activeModelSet->arch == ModelArch::LSTM40Cond)
+        steadyStateKey += "|" + String (ParameterHelpers::getParameterPointer<chowdsp::FloatParameter*> (vts, conditionTag)->get(), 2);
+
+    std::vector<float> modelState;
+    prepareSteadyState (sampleRate,
+                        steadyStateKey,
+                        [this, &modelState, samplesPerBlock]
+                        {
+                            // pre-buffering
+                            AudioBuffer<float> buffer (2, samplesPerBlock);
+                            for (int i = 0; i < 5000; i += samplesPerBlock)
+                            {
+                                buffer.clear();
+                                processAudio (buffer);
+                            }
+
+                            modelState = activeModelSet->getState();
+                        },
+                        modelState,
+                        activeModelSet->sampleRateCorrectionFilter,
+                        dcBlocker.getFilter());
+    activeModelSet->setState (modelState);
+}
+
+void GuitarMLAmp::updateModelSetForBlock (int numSamples, int numChannels)
+{
+    // wait until the last swap has finished, and the message thread has reclaimed the old models
+    if (fadingOutModelSet != nullptr || retiredModelSet.load() != nullptr)
+        return;
+
+    isSwappingModels.store (true);
+    auto* newModelSet = loaderState->pendingModelSet.exchange (nullptr);
+    if (newModelSet == nullptr)
     {
-        buffer.clear();
-        processAudio (buffer);
+        isSwappingModels.store (false);
+        return;
+    }
+
+    // models that were loaded before the last call to prepare() should have been picked up there
+    jassert (newModelSet->processSampleRate == processSampleRate);
+
+    fadingOutModelSet = std::exchange (activeModelSet, std::unique_ptr<ModelSet> { newModelSet });
+    fadeSamplesRemaining = fadeLengthSamples;
+
+    if (numSamples > fadeBuffer.getNumSamples() || numChannels > fadeBuffer.getNumChannels())
+    {
+        // the host has sent us a larger block than we were prepared for, so we can't crossfade this time
+        jassertfalse;
+        retiredModelSet.store (fadingOutModelSet.release());
+        isSwappingModels.store (false);
+        fadeSamplesRemaining = 0;
     }
 }
 
 void GuitarMLAmp::processAudio (AudioBuffer<float>& buffer)
 {
-    const SpinLock::ScopedTryLockType modelChangingLock { modelChangingMutex };
-    if (! modelChangingLock.isLocked())
-        return;
-
     const auto numChannels = buffer.getNumChannels();
     const auto numSamples = buffer.getNumSamples();
+    updateModelSetForBlock (numSamples, numChannels);
 
-    if (modelArch == ModelArch::LSTM40NoCond)
-    {
-        inGain.setGainDecibels (gainParam->getCurrentValue() - 12.0f);
-        inGain.process (buffer);
+    conditionParam.process (numSamples);
+    const auto condition = std::span { conditionParam.getSmoothedBuffer(), (size_t) numSamples };
+    const auto inGainDB = gainParam->getCurrentValue() - 12.0f;
+    const auto useSampleRateCorrectionFilter = sampleRateCorrectionFilterParam->get();
 
+    if (fadingOutModelSet != nullptr)
+    {
+        // run the outgoing models on a copy of the input, so we can crossfade to the new models
         for (int ch = 0; ch < numChannels; ++ch)
-        {
-            auto* x = buffer.getWritePointer (ch);
-            lstm40NoCondModels[ch].visit ([x, numSamples] (auto& model)
-                                          { model.process ({ x, (size_t) numSamples }, true); });
-        }
+            fadeBuffer.copyFrom (ch, 0, buffer, ch, 0, numSamples);
+
+        AudioBuffer<float> fadeOutBuffer { fadeBuffer.getArrayOfWritePointers(), numChannels, numSamples };
+        fadingOutModelSet->process (fadeOutBuffer, condition, inGainDB, useSampleRateCorrectionFilter);
     }
-    else if (modelArch == ModelArch::LSTM40Cond)
-    {
-        conditionParam.process (numSamples);
-        const auto* conditionData = conditionParam.getSmoothedBuffer();
 
+    activeModelSet->process (buffer, condition, inGainDB, useSampleRateCorrectionFilter);
+
+    if (fadingOutModelSet != nullptr)
+    {
+        const auto numFadeSamples = jmin (numSamples, fadeSamplesRemaining);
+        const auto fadeStartSample = fadeLengthSamples - fadeSamplesRemaining;
         for (int ch = 0; ch < numChannels; ++ch)
         {
-            auto* x = buffer.getWritePointer (ch);
-            lstm40CondModels[ch].visit ([x, conditionData, numSamples] (auto& model)
-                                        { model.process_conditioned ({ x, (size_t) numSamples }, { conditionData, (size_t) numSamples }, true); });
+            auto* newData = buffer.getWritePointer (ch);
+            const auto* oldData = fadeBuffer.getReadPointer (ch);
+            for (int n = 0; n < numFadeSamples; ++n)
+            {
+                const auto fadeGain = (float) (fadeStartSample + n + 1) / (float) fadeLengthSamples;
+                newData[n] = oldData[n] + fadeGain * (newData[n] - oldData[n]);
+            }
         }
-    }
 
-    if (sampleRateCorrectionFilterParam->get())
-    {
-        sampleRateCorrectionFilter.processBlock (buffer);
+        fadeSamplesRemaining -= numFadeSamples;
+        if (fadeSamplesRemaining == 0)
+        {
+            retiredModelSet.store (fadingOutModelSet.release());
+            isSwappingModels.store (false);
+        }
     }
 
-    buffer.applyGain (normalizationGain);
-
     dcBlocker.processAudio (buffer);
 }
 
 std::unique_ptr<XmlElement> GuitarMLAmp::toXML()
 {
     auto xml = BaseProcessor::toXML();
-    xml->setAttribute (customModelTag, cachedModel.dump());
+
+    // only serialise the model once, rather than every time the state is saved
+    if (! cachedModelAsset.isValid())
+    {
+        // if the model was loaded from the plugin state, it's already in the asset store
+        cachedModelAsset = stateAssets.getAsset (cachedModel->getContentHash());
+        if (! cachedModelAsset.isValid())
+        {
+            const auto modelWeightsData = cachedModel->toBinary();
+            cachedModelAsset = stateAssets.addAsset (MemoryBlock { modelWeightsData.data(), modelWeightsData.size() });
+        }
+    }
+
+    if (StateAssets::collectAsset (cachedModelAsset))
+    {
+        xml->setAttribute (customModelHashTag, StateAssets::hashToString (cachedModelAsset.hash));
+        xml->setAttribute (customModelNameTag, cachedModelName);
+    }
+    else
+    {
+        // the XML state stores the model in its original JSON format, so that older versions can still load it
+        auto modelJson = cachedModel->toJSON();
+        modelJson[modelNameTag] = cachedModelName;
+        xml->setAttribute (customModelTag, String { modelJson.dump() });
+    }
 
     return std::move (xml);
 }
 
 void GuitarMLAmp::fromXML (XmlElement* xml, const chowdsp::Version& version, bool loadPosition)
 {
-    const auto modelJsonString = xml->getStringAttribute (customModelTag, {});
     try
     {
-        const auto& modelJson = chowdsp::json::parse (modelJsonString.toStdString());
-        loadModelFromJson (modelJson);
+        if (xml->hasAttribute (customModelHashTag))
+        {
+            // the model is stored alongside the binary state, so it should already be in the asset store
+            auto modelAsset = stateAssets.getAsset (StateAssets::hashFromString (xml->getStringAttribute (customModelHashTag)));
+            if (! modelAsset.isValid())
+                throw std::runtime_error ("Model data is missing from the plugin state!");
+
+            auto modelWeights = SharedAssetCache::getInstance().getOrCreate<ModelWeights> (
+                SharedAssetCache::getContentKey (modelAsset.hash),
+                [&modelAsset]
+                {
+                    if (ModelWeights::isModelWeightsData (modelAsset.data, modelAsset.size))
+                        return ModelWeights::fromBinary (modelAsset.data, modelAsset.size, modelAsset.owner);
+
+                    // earlier binary states stored the model as JSON
+                    return ModelWeights::fromJSON (chowdsp::json::parse (modelAsset.toStringView()));
+                });
+
+            const auto modelName = xml->hasAttribute (customModelNameTag)
+                                       ? xml->getStringAttribute (customModelNameTag)
+                                       : String { modelWeights->getMetadata().value (modelNameTag, "") };
+            loadModelFromWeights (modelWeights, modelName);
+            if (ModelWeights::isModelWeightsData (modelAsset.data, modelAsset.size))
+                cachedModelAsset = std::move (modelAsset);
+        }
+        else
+        {
+            const auto modelJsonString = xml->getStringAttribute (customModelTag, {});
+            auto modelWeights = ModelWeights::fromJSON (chowdsp::json::parse (modelJsonString.toStdString()));
+            const auto modelName = String { modelWeights->getMetadata().value (modelNameTag, "") };
+            loadModelFromWeights (std::move (modelWeights), modelName);
+        }
     }
     catch (...)
     {
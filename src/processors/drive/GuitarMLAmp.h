@@ -1,17 +1,26 @@
 #pragma once
 
-#include "neural_utils/ResampledRNNAccelerated.h"
+#include "neural_utils/RNNAcceleratedDispatch.h"
 
 #include "../BaseProcessor.h"
+#include "../SharedAssetCache.h"
 #include "../utility/DCBlocker.h"
-
-class GuitarMLAmp : public BaseProcessor
+#include "state/StateAssets.h"
+
+/**
+ * Models are loaded on a background thread into a standby model set, which
+ * is then handed over to the audio thread with an atomic pointer swap, and
+ * crossfaded in over a few milliseconds.
+ */
+class GuitarMLAmp : public BaseProcessor,
+                    private Timer
 {
 public:
     explicit GuitarMLAmp (UndoManager* um = nullptr);
     ~GuitarMLAmp() override;
 
     ProcessorType getProcessorType() const override { return Drive; }
+    double getTailLengthSeconds() const override { return 0.1; } // give the network state some time to settle
     static ParamLayout createParameterLayout();
 
     void prepare (double sampleRate, int samplesPerBlock) override;
@@ -27,50 +36,62 @@ public:
     String getCurrentModelName() const;
 
 private:
-    void loadModelFromJson (const chowdsp::json& modelJson, const String& newModelName = {});
+    enum class ModelArch
+    {
+        LSTM40Cond,
+        LSTM40NoCond,
+    };
+
+    struct ModelSet;
+    struct ModelLoaderState;
+    struct ModelLoaderThreadPool;
+
+    static ModelArch getModelArch (const ModelWeights& modelWeights);
+    void loadModelFromWeights (SharedAssetCache::AssetPtr<ModelWeights> modelWeights, const String& newModelName, float newNormalizationGain = 1.0f);
+    void updateModelSetForBlock (int numSamples, int numChannels);
+    void timerCallback() override;
+
     using ModelChangeBroadcaster = chowdsp::Broadcaster<void()>;
     ModelChangeBroadcaster modelChangeBroadcaster;
 
     chowdsp::FloatParameter* gainParam = nullptr;
     chowdsp::SmoothedBufferValue<float> conditionParam;
     chowdsp::BoolParameter* sampleRateCorrectionFilterParam = nullptr;
-    chowdsp::Gain<float> inGain;
 
-    SpinLock modelChangingMutex;
     double processSampleRate = 96000.0;
+    int processBlockSize = 512;
     std::shared_ptr<FileChooser> customModelChooser;
 
-#if JUCE_INTEL
-    template <int numIns, int hiddenSize>
-    using GuitarML_LSTM = EA::Variant<
-        rnn_sse::RNNAccelerated<numIns, hiddenSize, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::LinInterp>,
-        rnn_avx::RNNAccelerated<numIns, hiddenSize, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::LinInterp>>;
-#else
     template <int numIns, int hiddenSize>
-    using GuitarML_LSTM = EA::Variant<
-        rnn_arm::RNNAccelerated<numIns, hiddenSize, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::LinInterp>>;
-#endif
+    using GuitarML_LSTM = rnn_dispatch::Models<true, numIns, hiddenSize, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::LinInterp>;
 
     using LSTM40Cond = GuitarML_LSTM<2, 40>;
     using LSTM40NoCond = GuitarML_LSTM<1, 40>;
 
-    std::array<LSTM40Cond, 2> lstm40CondModels;
-    std::array<LSTM40NoCond, 2> lstm40NoCondModels;
-    chowdsp::HighShelfFilter<float> sampleRateCorrectionFilter;
-
-    enum class ModelArch
-    {
-        LSTM40Cond,
-        LSTM40NoCond,
-    };
-
+    // message thread state
     ModelArch modelArch = ModelArch::LSTM40NoCond;
-
-    chowdsp::json cachedModel {};
+    SharedAssetCache::AssetPtr<ModelWeights> cachedModel {}; // built-in models are shared with the other instances
+    String cachedModelName {};
+    StateAssets::Asset cachedModelAsset {}; // the serialised cachedModel, created lazily when saving the state
+    StateAssets stateAssets;
+    SharedResourcePointer<ModelLoaderThreadPool> loaderThreadPool;
+    std::shared_ptr<ModelLoaderState> loaderState;
+    bool loadModelsInBackground = false;
+
+    // shared state
+    std::atomic<ModelSet*> retiredModelSet { nullptr };
+    std::atomic<bool> isSwappingModels { false }; // true from when the audio thread takes the pending models, until it retires the old ones
+
+    // audio thread state
+    std::unique_ptr<ModelSet> activeModelSet;
+    std::unique_ptr<ModelSet> fadingOutModelSet;
+    AudioBuffer<float> fadeBuffer;
+    int fadeLengthSamples = 1;
+    int fadeSamplesRemaining = 0;
+
+    static constexpr double fadeTimeSeconds = 0.02;
 
     DCBlocker dcBlocker;
 
-    float normalizationGain = 1.0f;
-
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (GuitarMLAmp)
 };
@@ -10,8 +10,7 @@ MetalFace::MetalFace (UndoManager* um) : BaseProcessor ("Metal Face", createPara
     uiOptions.info.description = "Emulation of a HEAVY distortion signal chain.";
     uiOptions.info.authors = StringArray { "Jatin Chowdhury" };
 
-    for (auto& model : rnn)
-        model.initialise (BinaryData::metal_face_model_json, BinaryData::metal_face_model_jsonSize, 96000.0);
+    rnn.initialise (BinaryData::metal_face_model_bin, BinaryData::metal_face_model_binSize, 96000.0);
 }
 
 ParamLayout MetalFace::createParameterLayout()
@@ -29,8 +28,7 @@ void MetalFace::prepare (double sampleRate, int samplesPerBlock)
     gain.prepare ({ sampleRate, (uint32) samplesPerBlock, 2 });
     gain.setRampDurationSeconds (0.1);
 
-    for (auto& model : rnn)
-        model.prepare (sampleRate, samplesPerBlock);
+    rnn.prepare (sampleRate, samplesPerBlock);
 
     dcBlocker.prepare (sampleRate, samplesPerBlock);
 
@@ -51,11 +49,7 @@ void MetalFace::processAudio (AudioBuffer<float>& buffer)
     gain.setGainDecibels (gainDB);
     gain.process (dsp::ProcessContextReplacing<float> { block });
 
-    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
-    {
-        auto&& channelBlock = block.getSingleChannelBlock ((size_t) ch);
-        rnn[ch].process (channelBlock);
-    }
+    rnn.process (chowdsp::BufferView<float> { buffer });
 
     const auto makeupDB = (-48.0f - gainDB) / 10.0f;
     block *= Decibels::decibelsToGain (makeupDB);
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "neural_utils/ResampledRNNAccelerated.h"
+#include "neural_utils/ResampledStereoRNNAccelerated.h"
 
 #include "../BaseProcessor.h"
 #include "../utility/DCBlocker.h"
@@ -11,6 +11,7 @@ public:
     explicit MetalFace (UndoManager* um);
 
     ProcessorType getProcessorType() const override { return Drive; }
+    double getTailLengthSeconds() const override { return 0.1; } // give the network state some time to settle
     static ParamLayout createParameterLayout();
 
     void prepare (double sampleRate, int samplesPerBlock) override;
@@ -20,7 +21,7 @@ private:
     chowdsp::FloatParameter* gainDBParam = nullptr;
 
     dsp::Gain<float> gain;
-    ResampledRNNAccelerated<1, 28> rnn[2];
+    ResampledStereoRNNAccelerated<1, 28> rnn;
 
     DCBlocker dcBlocker;
 
@@ -128,7 +128,14 @@ void RONN::parameterChanged (const String& parameterID, float newValue)
 
     auto seedIdx = int (newValue);
     reloadModel (randomSeeds[seedIdx]);
-    needsPrebuffering = true;
+
+    // Settle the new model here, rather than on the audio thread. Each seed only
+    // needs to be pre-buffered once, after that the state comes from the snapshot.
+    if (maxBlockSize > 0)
+    {
+        SpinLock::ScopedLockType modelLoadingScopedLock (modelLoadingLock);
+        prepareNeuralNetSteadyState();
+    }
 }
 
 void RONN::reloadModel (int randomSeed)
@@ -196,22 +203,35 @@ void RONN::prepare (double sampleRate, int samplesPerBlock)
 
     dcBlocker.prepare (sampleRate, samplesPerBlock);
 
+    fs = sampleRate;
     maxBlockSize = samplesPerBlock;
-    doPrebuffering();
+    prepareNeuralNetSteadyState();
 }
 
-void RONN::doPrebuffering()
+void RONN::prepareNeuralNetSteadyState()
 {
-    needsPrebuffering = false;
+    prepareSteadyState (fs,
+                        String (vts.getRawParameterValue ("seed")->load()),
+                        [this]
+                        { processSilence(); },
+                        neuralNet[0],
+                        neuralNet[1],
+                        dcBlocker.getFilter());
+    resetOutputGain();
+}
 
-    // pre-buffering
+void RONN::processSilence()
+{
     AudioBuffer<float> buffer (2, maxBlockSize);
     for (int i = 0; i < 100000; i += maxBlockSize)
     {
         buffer.clear();
-        processAudio (buffer);
+        processNeuralNet (buffer);
     }
+}
 
+void RONN::resetOutputGain()
+{
     outputGain.setRampDurationSeconds (0.0);
     outputGain.setGainLinear (0.0f);
     outputGain.setRampDurationSeconds (0.25);
@@ -224,9 +244,11 @@ void RONN::processAudio (AudioBuffer<float>& buffer)
     if (! modelLoadingTryLock.isLocked())
         return;
 
-    if (needsPrebuffering)
-        doPrebuffering();
+    processNeuralNet (buffer);
+}
 
+void RONN::processNeuralNet (AudioBuffer<float>& buffer)
+{
     dsp::AudioBlock<float> block (buffer);
     dsp::ProcessContextReplacing<float> context (block);
 
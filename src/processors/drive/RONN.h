@@ -18,7 +18,10 @@ public:
     void processAudio (AudioBuffer<float>& buffer) override;
 
 private:
-    void doPrebuffering();
+    void processNeuralNet (AudioBuffer<float>& buffer);
+    void prepareNeuralNetSteadyState();
+    void processSilence();
+    void resetOutputGain();
 
     // model loading utils
     SpinLock modelLoadingLock;
@@ -32,7 +35,7 @@ private:
 
     RTNeural::ModelT<float, 1, 1, RTNeural::DenseT<float, 1, 8>, RTNeural::TanhActivationT<float, 8>, RTNeural::Conv1DT<float, 8, 4, 3, 2>, RTNeural::TanhActivationT<float, 4>, RTNeural::GRULayerT<float, 4, 8>, RTNeural::DenseT<float, 8, 1>> neuralNet[2];
 
-    std::atomic_bool needsPrebuffering { false };
+    double fs = 48000.0;
     int maxBlockSize = 0;
     DCBlocker dcBlocker;
 
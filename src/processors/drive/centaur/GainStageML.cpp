@@ -2,52 +2,97 @@
 
 GainStageML::GainStageML (AudioProcessorValueTreeState& vts)
 {
-    loadModel (gainStageML[0], BinaryData::centaur_0_json, BinaryData::centaur_0_jsonSize);
-    loadModel (gainStageML[1], BinaryData::centaur_25_json, BinaryData::centaur_25_jsonSize);
-    loadModel (gainStageML[2], BinaryData::centaur_50_json, BinaryData::centaur_50_jsonSize);
-    loadModel (gainStageML[3], BinaryData::centaur_75_json, BinaryData::centaur_75_jsonSize);
-    loadModel (gainStageML[4], BinaryData::centaur_100_json, BinaryData::centaur_100_jsonSize);
+    loadModel (gainStageML, 0, BinaryData::centaur_0_bin, BinaryData::centaur_0_binSize);
+    loadModel (gainStageML, 1, BinaryData::centaur_25_bin, BinaryData::centaur_25_binSize);
+    loadModel (gainStageML, 2, BinaryData::centaur_50_bin, BinaryData::centaur_50_binSize);
+    loadModel (gainStageML, 3, BinaryData::centaur_75_bin, BinaryData::centaur_75_binSize);
+    loadModel (gainStageML, 4, BinaryData::centaur_100_bin, BinaryData::centaur_100_binSize);
+
+    // start the models from their settled state, to avoid a "click" on initialisation
+    gainStageML.setInitialState (getSteadyState (gainStageML));
 
     chowdsp::ParamUtils::loadParameterPointer (gainParam, vts, "gain");
 }
 
-void GainStageML::loadModel (ModelPair& model, const char* data, int size)
+void GainStageML::loadModel (GRUModels& models, int modelIdx, const char* data, int size)
 {
-    for (auto& channelModel : model)
-        channelModel.initialise (data, size, 44100.0);
+    modelWeights[(size_t) modelIdx] = SharedAssetCache::getInstance().getModelWeights (SharedAssetCache::getBinaryDataKey (data), data, (size_t) size);
+
+    for (int ch = 0; ch < (int) numChannels; ++ch)
+        models.loadLaneWeights (modelIdx * numChannels + ch, *modelWeights[(size_t) modelIdx]);
 }
 
-void GainStageML::reset (double sampleRate, int samplesPerBlock)
+const GainStageML::GRUModels::LaneStates& GainStageML::getSteadyState (const GRUModels& models)
 {
-    fadeBuffer.setSize (2, samplesPerBlock);
+    // The model weights are always the same, so the steady state
+    // only needs to be computed once for the whole process.
+    static const auto steadyState = models.computeSteadyState();
+    return steadyState;
+}
 
-    for (size_t i = 0; i < (size_t) numModels; ++i)
+void GainStageML::reset (double sampleRate, int samplesPerBlock)
+{
+    const auto [resampleRatio, rnnDelaySamples] = [] (auto curFs, auto targetFs)
     {
-        for (size_t ch = 0; ch < 2; ++ch)
-        {
-            gainStageML[i][ch].prepare (sampleRate, samplesPerBlock);
+        if (curFs == targetFs)
+            return std::make_pair (1.0, 1);
 
-            // pre-buffer to avoid "click" on initialisation
-            for (int k = 0; k < int (0.1 * sampleRate); k += samplesPerBlock)
-            {
-                fadeBuffer.clear();
-                auto&& preBufferBlock = dsp::AudioBlock<float> { fadeBuffer }.getSingleChannelBlock (0);
-                gainStageML[i][ch].process (preBufferBlock);
-            }
+        if (curFs > targetFs)
+        {
+            const auto delaySamples = std::ceil (curFs / targetFs);
+            return std::make_pair (delaySamples * targetFs / curFs, (int) delaySamples);
         }
-    }
 
+        // curFs < targetFs
+        return std::make_pair (targetFs / curFs, 1);
+    }(sampleRate, modelSampleRate);
+
+    needsResampling = resampleRatio != 1.0;
+    resampler.prepareWithTargetSampleRate ({ sampleRate, (uint32) samplesPerBlock, (uint32) numChannels }, sampleRate * resampleRatio);
+
+    gainStageML.prepare (rnnDelaySamples);
+
+    // leave some headroom, since the number of resampled samples can vary from block to block
+    fadeBuffer.setSize (numChannels, (int) std::ceil (samplesPerBlock * resampleRatio) + 32);
     fadeBuffer.clear();
     lastModelIdx = getModelIdx();
 }
 
-void GainStageML::processModel (AudioBuffer<float>& buffer, ModelPair& model)
+void GainStageML::processModels (const chowdsp::BufferView<float>& buffer, int modelIdx)
 {
-    auto&& block = dsp::AudioBlock<float> { buffer };
+    const auto numSamples = buffer.getNumSamples();
+    const auto needsFade = modelIdx != lastModelIdx && numSamples <= fadeBuffer.getNumSamples();
+    jassert (numSamples <= fadeBuffer.getNumSamples());
+
+    std::array<const float*, (size_t) numModels * numChannels> laneInputs {};
+    std::array<float*, (size_t) numModels * numChannels> laneOutputs {};
     for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
     {
-        auto&& channelBlock = block.getSingleChannelBlock ((size_t) ch);
-        model[(size_t) ch].process (channelBlock);
+        for (int model = 0; model < (int) numModels; ++model)
+            laneInputs[size_t (model * numChannels + ch)] = buffer.getReadPointer (ch);
+
+        laneOutputs[size_t (modelIdx * numChannels + ch)] = buffer.getWritePointer (ch);
+        if (needsFade)
+            laneOutputs[size_t (lastModelIdx * numChannels + ch)] = fadeBuffer.getWritePointer (ch);
+    }
+
+    // run the selected model, the previous model, and their neighbours
+    const auto firstModel = jmax (0, jmin (modelIdx, lastModelIdx) - 1);
+    const auto lastModel = jmin ((int) numModels - 1, jmax (modelIdx, lastModelIdx) + 1);
+    gainStageML.process (laneInputs, laneOutputs, numSamples, firstModel * numChannels, lastModel * numChannels + numChannels - 1);
+
+    if (needsFade) // fade from the previous model to the new one
+    {
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        {
+            auto* data = buffer.getWritePointer (ch);
+            const auto* prevData = fadeBuffer.getReadPointer (ch);
+            for (int n = 0; n < numSamples; ++n)
+            {
+                const auto fadeGain = (float) n / (float) numSamples;
+                data[n] = prevData[n] + fadeGain * (data[n] - prevData[n]);
+            }
+        }
     }
 }
 
@@ -55,21 +100,17 @@ void GainStageML::processBlock (AudioBuffer<float>& buffer)
 {
     const auto modelIdx = getModelIdx();
 
-    //    processModel (buffer, gainStageML[modelIdx]);
-
-    if (modelIdx == lastModelIdx)
+    auto bufferView = chowdsp::BufferView<float> { buffer };
+    if (! needsResampling)
     {
-        processModel (buffer, gainStageML[(size_t) modelIdx]);
+        processModels (bufferView, modelIdx);
     }
-    else // need to fade between models
+    else
     {
-        fadeBuffer.makeCopyOf (buffer, true);
-        processModel (buffer, gainStageML[(size_t) lastModelIdx]); // previous model
-        processModel (fadeBuffer, gainStageML[(size_t) modelIdx]); // next model
-
-        buffer.applyGainRamp (0, buffer.getNumSamples(), 1.0f, 0.0f);
-        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
-            buffer.addFromWithRamp (ch, 0, fadeBuffer.getReadPointer (ch), buffer.getNumSamples(), 0.0f, 1.0f);
+        // all the models share the same input, so we only need to resample once
+        auto blockAtSampleRate = resampler.processIn (bufferView);
+        processModels (blockAtSampleRate, modelIdx);
+        resampler.processOut (blockAtSampleRate, bufferView);
     }
 
     lastModelIdx = modelIdx;
@@ -1,6 +1,7 @@
 #pragma once
 
-#include "../neural_utils/ResampledRNN.h"
+#include "../neural_utils/BatchedGRU.h"
+#include "processors/SharedAssetCache.h"
 
 class GainStageML
 {
@@ -14,23 +15,35 @@ private:
     enum
     {
         numModels = 5,
+        numChannels = 2,
     };
 
-    using RNNModel = ResampledRNN<8, RTNeural::GRULayerT>;
-    using ModelPair = std::array<RNNModel, 2>;
-    std::array<ModelPair, numModels> gainStageML;
+    // The models for both channels are processed together, with model
+    // N for channel C in lane (N * numChannels + C). The selected model
+    // and its neighbours are kept running, so that their state is valid
+    // when the gain knob moves over to the next model.
+    using GRUModels = BatchedGRU<numModels * numChannels, 8>;
+    GRUModels gainStageML;
 
-    static void loadModel (ModelPair& model, const char* data, int size);
-    static void processModel (AudioBuffer<float>& buffer, ModelPair& model);
+    void loadModel (GRUModels& models, int modelIdx, const char* data, int size);
+    std::array<SharedAssetCache::AssetPtr<ModelWeights>, numModels> modelWeights; // shared with the other instances
+    static const GRUModels::LaneStates& getSteadyState (const GRUModels& models);
+    void processModels (const chowdsp::BufferView<float>& buffer, int modelIdx);
 
     inline int getModelIdx() const noexcept
     {
         return jlimit (0, numModels - 1, int ((float) numModels * *gainParam));
     }
 
+    using ResamplerType = chowdsp::ResamplingTypes::LanczosResampler<8192, 8>;
+    chowdsp::ResampledProcess<ResamplerType> resampler;
+    bool needsResampling = true;
+
     AudioBuffer<float> fadeBuffer;
     chowdsp::FloatParameter* gainParam = nullptr;
     int lastModelIdx = 0;
 
+    static constexpr double modelSampleRate = 44100.0;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (GainStageML)
 };
@@ -9,6 +9,7 @@ public:
     explicit DiodeClipper (UndoManager* um = nullptr);
 
     ProcessorType getProcessorType() const override { return Drive; }
+    double getTailLengthSeconds() const override { return 0.0; }
     static ParamLayout createParameterLayout();
 
     void prepare (double sampleRate, int samplesPerBlock) override;
@@ -22,8 +23,8 @@ private:
     chowdsp::FloatParameter* nDiodesParam = nullptr;
 
     dsp::Gain<float> inGain, outGain;
-    using DiodeClipperDP = DiodeClipperWDF<wdft::DiodePairT>;
-    DiodeClipperDP wdf[2];
+    using DiodeClipperDP = DiodeClipperWDF<wdft::DiodePairT, wdf_simd::Batch>;
+    DiodeClipperDP wdf;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (DiodeClipper)
 };
@@ -1,8 +1,12 @@
 #pragma once
 
-#include <pch.h>
+#include "processors/WDFSimdHelpers.h"
 
-template <template <typename, typename, wdft::DiodeQuality> typename DiodeType>
+/**
+ * WDF model of a simple diode clipper circuit. The sample type T may be a
+ * SIMD batch, in which case each lane is processed as a separate channel.
+ */
+template <template <typename, typename, wdft::DiodeQuality> typename DiodeType, typename T>
 class DiodeClipperWDF
 {
 public:
@@ -33,61 +37,64 @@ public:
         }
     }
 
-    inline float processSample (float x) noexcept
+    inline T processSample (T x) noexcept
     {
         Vs.setVoltage (x);
 
         dp.incident (P1.reflected());
-        auto y = wdft::voltage<float> (C1);
+        auto y = wdft::voltage<T> (C1);
         P1.incident (dp.reflected());
 
         return y;
     }
 
-    void process (float* buffer, const int numSamples) noexcept
+    /** Processes all the channels in the buffer at once, with each channel in its own lane. */
+    void process (AudioBuffer<float>& buffer) noexcept
     {
         if (cutoffSmooth.isSmoothing() && nDiodesSmooth.isSmoothing())
         {
-            for (int n = 0; n < numSamples; ++n)
-            {
-                Vs.setResistanceValue (1.0f / (MathConstants<float>::twoPi * cutoffSmooth.getNextValue() * capVal));
-                dp.setDiodeParameters (curDiodeIs, Vt, nDiodesSmooth.getNextValue());
-
-                buffer[n] = processSample (buffer[n]);
-            }
+            wdf_simd::processChannels<T> (buffer,
+                                          [this] (int, T x)
+                                          {
+                                              Vs.setResistanceValue (1.0f / (MathConstants<float>::twoPi * cutoffSmooth.getNextValue() * capVal));
+                                              dp.setDiodeParameters (curDiodeIs, Vt, nDiodesSmooth.getNextValue());
+                                              return processSample (x);
+                                          });
             return;
         }
 
         if (cutoffSmooth.isSmoothing())
         {
-            for (int n = 0; n < numSamples; ++n)
-            {
-                Vs.setResistanceValue (1.0f / (MathConstants<float>::twoPi * cutoffSmooth.getNextValue() * capVal));
-                buffer[n] = processSample (buffer[n]);
-            }
+            wdf_simd::processChannels<T> (buffer,
+                                          [this] (int, T x)
+                                          {
+                                              Vs.setResistanceValue (1.0f / (MathConstants<float>::twoPi * cutoffSmooth.getNextValue() * capVal));
+                                              return processSample (x);
+                                          });
             return;
         }
 
         if (nDiodesSmooth.isSmoothing())
         {
-            for (int n = 0; n < numSamples; ++n)
-            {
-                dp.setDiodeParameters (curDiodeIs, Vt, nDiodesSmooth.getNextValue());
-                buffer[n] = processSample (buffer[n]);
-            }
+            wdf_simd::processChannels<T> (buffer,
+                                          [this] (int, T x)
+                                          {
+                                              dp.setDiodeParameters (curDiodeIs, Vt, nDiodesSmooth.getNextValue());
+                                              return processSample (x);
+                                          });
             return;
         }
 
         Vs.setResistanceValue (1.0f / (MathConstants<float>::twoPi * cutoffSmooth.getNextValue() * capVal));
         dp.setDiodeParameters (curDiodeIs, Vt, nDiodesSmooth.getNextValue());
-        for (int n = 0; n < numSamples; ++n)
-            buffer[n] = processSample (buffer[n]);
+        wdf_simd::processChannels<T> (buffer, [this] (int, T x)
+                                      { return processSample (x); });
     }
 
 private:
     static constexpr float Vt = 0.02585f;
     static constexpr float capVal = 47.0e-9f;
-    using wdf_type = float;
+    using wdf_type = T;
     using Res = wdft::ResistorT<wdf_type>;
     using Cap = wdft::CapacitorT<wdf_type>;
     using ResVs = wdft::ResistiveVoltageSourceT<wdf_type>;
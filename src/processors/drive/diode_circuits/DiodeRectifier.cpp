@@ -30,11 +30,8 @@ ParamLayout DiodeRectifier::createParameterLayout()
 void DiodeRectifier::prepare (double sampleRate, int samplesPerBlock)
 {
     int diodeType = static_cast<int> (*diodeTypeParam);
-    for (auto& wdfProc : wdf)
-    {
-        wdfProc.prepare ((float) sampleRate);
-        wdfProc.setParameters (*cutoffParam, DiodeParameter::getDiodeIs (diodeType), *nDiodesParam, true);
-    }
+    wdf.prepare ((float) sampleRate);
+    wdf.setParameters (*cutoffParam, DiodeParameter::getDiodeIs (diodeType), *nDiodesParam, true);
 
     dsp::ProcessSpec spec { sampleRate, (uint32) samplesPerBlock, 2 };
     for (auto* gain : { &inGain, &outGain })
@@ -53,12 +50,8 @@ void DiodeRectifier::processAudio (AudioBuffer<float>& buffer)
     inGain.process (context);
 
     int diodeType = static_cast<int> (*diodeTypeParam);
-    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
-    {
-        wdf[ch].setParameters (*cutoffParam, DiodeParameter::getDiodeIs (diodeType), *nDiodesParam);
-        auto* x = buffer.getWritePointer (ch);
-        wdf[ch].process (x, buffer.getNumSamples());
-    }
+    wdf.setParameters (*cutoffParam, DiodeParameter::getDiodeIs (diodeType), *nDiodesParam);
+    wdf.process (buffer);
 
     outGain.process (context);
 }
@@ -9,6 +9,7 @@ public:
     explicit DiodeRectifier (UndoManager* um = nullptr);
 
     ProcessorType getProcessorType() const override { return Drive; }
+    double getTailLengthSeconds() const override { return 0.0; }
     static ParamLayout createParameterLayout();
 
     void prepare (double sampleRate, int samplesPerBlock) override;
@@ -22,8 +23,8 @@ private:
     chowdsp::FloatParameter* nDiodesParam = nullptr;
 
     dsp::Gain<float> inGain, outGain;
-    using DiodeRectifierWDF = DiodeClipperWDF<wdft::DiodeT>;
-    DiodeRectifierWDF wdf[2];
+    using DiodeRectifierWDF = DiodeClipperWDF<wdft::DiodeT, wdf_simd::Batch>;
+    DiodeRectifierWDF wdf;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (DiodeRectifier)
 };
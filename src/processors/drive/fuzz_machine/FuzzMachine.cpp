@@ -29,30 +29,32 @@ ParamLayout FuzzMachine::createParameterLayout()
 
 void FuzzMachine::prepare (double sampleRate, int samplesPerBlock)
 {
-    const auto osRatio = sampleRate >= 80000.0 ? 1 : 2;
+    // if the chain is already oversampling, we may be able to run the models at a lower rate
+    const auto osRatio = getInternalResamplingRatio (sampleRate, 80'000.0);
+    const auto osSampleRate = osRatio * sampleRate;
+    const auto osSamplesPerBlock = (int) std::ceil (osRatio * samplesPerBlock);
 
     fuzzParam.setRampLength (0.025);
-    fuzzParam.prepare (osRatio * sampleRate, osRatio * samplesPerBlock);
+    fuzzParam.prepare (osSampleRate, osSamplesPerBlock);
 
     for (int ch = 0; ch < 2; ++ch)
     {
         if ((int) sampleRate % 44100 == 0)
         {
-            model_ff_15[ch].initialise (BinaryData::fuzz_15_88_json, BinaryData::fuzz_15_88_jsonSize, 88200.0);
-            model_ff_2[ch].initialise (BinaryData::fuzz_2_88_json, BinaryData::fuzz_2_88_jsonSize, 88200.0);
+            model_ff_15[ch].initialise (BinaryData::fuzz_15_88_bin, BinaryData::fuzz_15_88_binSize, 88200.0);
+            model_ff_2[ch].initialise (BinaryData::fuzz_2_88_bin, BinaryData::fuzz_2_88_binSize, 88200.0);
         }
         else
         {
-            model_ff_15[ch].initialise (BinaryData::fuzz_15_json, BinaryData::fuzz_15_jsonSize, 96000.0);
-            model_ff_2[ch].initialise (BinaryData::fuzz_2_json, BinaryData::fuzz_2_jsonSize, 96000.0);
+            model_ff_15[ch].initialise (BinaryData::fuzz_15_bin, BinaryData::fuzz_15_binSize, 96000.0);
+            model_ff_2[ch].initialise (BinaryData::fuzz_2_bin, BinaryData::fuzz_2_binSize, 96000.0);
         }
 
-        model_ff_15[ch].prepare (osRatio * sampleRate, osRatio * samplesPerBlock);
-        model_ff_2[ch].prepare (osRatio * sampleRate, osRatio * samplesPerBlock);
+        model_ff_15[ch].prepare (osSampleRate, osSamplesPerBlock);
+        model_ff_2[ch].prepare (osSampleRate, osSamplesPerBlock);
     }
 
-    upsampler.prepare ({ sampleRate, (uint32_t) samplesPerBlock, 2 }, osRatio);
-    downsampler.prepare ({ osRatio * sampleRate, osRatio * (uint32_t) samplesPerBlock, 2 }, osRatio);
+    resampler.prepare (sampleRate, samplesPerBlock, osRatio);
 
     const auto spec = juce::dsp::ProcessSpec { sampleRate, (uint32_t) samplesPerBlock, 2 };
     dcBlocker.prepare (spec);
@@ -62,22 +64,54 @@ void FuzzMachine::prepare (double sampleRate, int samplesPerBlock)
     volume.setRampDurationSeconds (0.05);
     volume.prepare (spec);
 
-    // pre-buffering
+    // the settled state depends on which model is running, and how hard it's being driven
+    const auto steadyStateKey = String ((int) modelParam->get()) + "|" + String (ParameterHelpers::getParameterPointer<chowdsp::PercentParameter*> (vts, "fuzz")->get(), 2);
+
+    std::vector<std::shared_ptr<const void>> modelStates;
+    prepareSteadyState (sampleRate,
+                        steadyStateKey,
+                        [this, &modelStates, samplesPerBlock]
+                        {
+                            // pre-buffering
+                            AudioBuffer<float> buffer (2, samplesPerBlock);
+                            float level = 100.0f;
+                            int count = 0;
+                            while (level > 1.0e-4f || count < 100)
+                            {
+                                buffer.clear();
+                                processAudio (buffer);
+                                level = buffer.getMagnitude (0, samplesPerBlock);
+                                count++;
+                            }
+
+                            for (int ch = 0; ch < 2; ++ch)
+                            {
+                                modelStates.push_back (model_ff_15[ch].get_state());
+                                modelStates.push_back (model_ff_2[ch].get_state());
+                            }
+                        },
+                        modelStates,
+                        dcBlocker);
+
+    for (int ch = 0; ch < 2; ++ch)
+    {
+        model_ff_15[ch].set_state (modelStates[2 * (size_t) ch]);
+        model_ff_2[ch].set_state (modelStates[2 * (size_t) ch + 1]);
+    }
+
+    // The resamplers only hold a few samples of history, so rather than saving their state, we
+    // fill them back up with the output of the models (which stay settled while processing silence).
     AudioBuffer<float> buffer (2, samplesPerBlock);
-    float level = 100.0f;
-    int count = 0;
-    while (level > 1.0e-4f || count < 100)
+    for (int i = 0; i < 256; i += samplesPerBlock)
     {
         buffer.clear();
-        processAudio (buffer);
-        level = buffer.getMagnitude (0, samplesPerBlock);
-        count++;
+        processModels (buffer);
     }
 }
 
-void FuzzMachine::processAudio (AudioBuffer<float>& buffer)
+void FuzzMachine::processModels (AudioBuffer<float>& buffer)
 {
-    const auto osBuffer = upsampler.process (buffer);
+    auto& osBuffer = resampler.processIn (buffer);
     const auto osNumSamples = osBuffer.getNumSamples();
     fuzzParam.process (osNumSamples);
 
@@ -95,7 +129,12 @@ void FuzzMachine::processAudio (AudioBuffer<float>& buffer)
             modelParam->get());
     }
 
-    downsampler.process (osBuffer, buffer);
+    resampler.processOut (osBuffer, buffer);
+}
+
+void FuzzMachine::processAudio (AudioBuffer<float>& buffer)
+{
+    processModels (buffer);
 
     dcBlocker.processBlock (buffer);
 
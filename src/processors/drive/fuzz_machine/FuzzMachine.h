@@ -1,6 +1,7 @@
 #pragma once
 
 #include "processors/BaseProcessor.h"
+#include "processors/InternalResampler.h"
 
 #include "FuzzFaceNDK.h"
 #include "processors/drive/neural_utils/ResampledRNNAccelerated.h"
@@ -17,6 +18,8 @@ public:
     void processAudio (AudioBuffer<float>& buffer) override;
 
 private:
+    void processModels (AudioBuffer<float>& buffer);
+
     enum class Model
     {
         Mode_1z5 = 1,
@@ -32,8 +35,7 @@ private:
     ResampledRNNAccelerated<2, hiddenSize> model_ff_2[2];
 
     using AAFilter = chowdsp::EllipticFilter<4>;
-    chowdsp::Upsampler<float, AAFilter> upsampler;
-    chowdsp::Downsampler<float, AAFilter, false> downsampler;
+    InternalResampler<AAFilter> resampler;
 
     chowdsp::FirstOrderHPF<float> dcBlocker;
     chowdsp::Gain<float> volume;
@@ -26,25 +26,19 @@ ParamLayout Hysteresis::createParameterLayout()
     return { params.begin(), params.end() };
 }
 
-void Hysteresis::prepare (double sampleRate, int samplesPerBlock)
+void Hysteresis::prepare (double sampleRate, int /*samplesPerBlock*/)
 {
     hysteresisProc.reset();
     hysteresisProc.setSampleRate (sampleRate);
-
-    doubleBuffer.setSize (2, samplesPerBlock);
 }
 
 void Hysteresis::processAudio (AudioBuffer<float>& buffer)
 {
     buffer.applyGain (2.0f);
 
-    doubleBuffer.makeCopyOf (buffer, true);
-
-    auto* leftPtr = doubleBuffer.getWritePointer (0);
-    auto* rightPtr = doubleBuffer.getNumChannels() > 1 ? doubleBuffer.getWritePointer (1) : leftPtr;
+    auto* leftPtr = buffer.getWritePointer (0);
+    auto* rightPtr = buffer.getNumChannels() > 1 ? buffer.getWritePointer (1) : leftPtr;
 
     hysteresisProc.setParameters (*driveParam, *widthParam, *satParam);
     hysteresisProc.processBlock (leftPtr, rightPtr, buffer.getNumSamples());
-
-    buffer.makeCopyOf (doubleBuffer, true);
 }
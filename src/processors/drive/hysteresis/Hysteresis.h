@@ -9,6 +9,7 @@ public:
     explicit Hysteresis (UndoManager* um = nullptr);
 
     ProcessorType getProcessorType() const override { return Drive; }
+    double getTailLengthSeconds() const override { return 0.0; }
     static ParamLayout createParameterLayout();
 
     void prepare (double sampleRate, int samplesPerBlock) override;
@@ -19,8 +20,7 @@ private:
     chowdsp::FloatParameter* driveParam = nullptr;
     chowdsp::FloatParameter* widthParam = nullptr;
 
-    HysteresisProcessing hysteresisProc;
-    AudioBuffer<double> doubleBuffer;
+    HysteresisProcessing<float> hysteresisProc;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Hysteresis)
 };
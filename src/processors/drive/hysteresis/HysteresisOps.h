@@ -9,38 +9,63 @@ namespace HysteresisOps
 {
 using namespace chowdsp::SIMDUtils;
 
+#if HYSTERESIS_USE_SIMD
+template <typename Float>
+using SampleTypeOf = typename Float::value_type;
+#else
+template <typename Float>
+using SampleTypeOf = Float;
+#endif
+
+template <typename SampleType>
 struct HysteresisState
 {
     // parameter values
-    double M_s = 1.0;
-    double a = M_s / 4.0;
-    static constexpr double alpha = 1.6e-3;
-    double k = 0.47875;
-    double c = 1.7e-1;
+    SampleType M_s = 1.0;
+    SampleType a = M_s / 4.0;
+    static constexpr SampleType alpha = (SampleType) 1.6e-3;
+    SampleType k = 0.47875;
+    SampleType c = 1.7e-1;
 
     // Save calculations
-    double nc = 1 - c;
-    double M_s_oa = M_s / a;
-    double M_s_oa_talpha = alpha * M_s / a;
-    double M_s_oa_tc = c * M_s / a;
-    double M_s_oa_tc_talpha = alpha * c * M_s / a;
-    double M_s_oaSq_tc_talpha = alpha * c * M_s / (a * a);
-    double M_s_oaSq_tc_talphaSq = alpha * alpha * c * M_s / (a * a);
+    SampleType nc = 1 - c;
+    SampleType M_s_oa = M_s / a;
+    SampleType M_s_oa_talpha = alpha * M_s / a;
+    SampleType M_s_oa_tc = c * M_s / a;
+    SampleType M_s_oa_tc_talpha = alpha * c * M_s / a;
+    SampleType M_s_oaSq_tc_talpha = alpha * c * M_s / (a * a);
+    SampleType M_s_oaSq_tc_talphaSq = alpha * alpha * c * M_s / (a * a);
 
     // temp vars
 #if HYSTERESIS_USE_SIMD
-    xsimd::batch<double> Q, M_diff, L_prime, kap1, f1Denom, f1, f2, f3;
-    xsimd::batch<double> coth = 0.0;
-    xsimd::batch_bool<double> nearZero;
+    xsimd::batch<SampleType> Q, M_diff, L_prime, kap1, f1Denom, f1, f2, f3;
+    xsimd::batch<SampleType> coth = 0.0;
+    xsimd::batch_bool<SampleType> nearZero;
 #else
-    double Q, M_diff, L_prime, kap1, f1Denom, f1, f2, f3;
-    double coth = 0.0;
+    SampleType Q, M_diff, L_prime, kap1, f1Denom, f1, f2, f3;
+    SampleType coth = 0.0;
     bool nearZero = false;
 #endif
 };
 
 constexpr double ONE_THIRD = 1.0 / 3.0;
+constexpr double NEG_ONE_OVER_15 = -1.0 / 15.0;
+constexpr double NEG_ONE_OVER_45 = -1.0 / 45.0;
 constexpr double NEG_TWO_OVER_15 = -2.0 / 15.0;
+constexpr double TWO_OVER_189 = 2.0 / 189.0;
+constexpr double EIGHT_OVER_189 = 8.0 / 189.0;
+constexpr double TWO_OVER_945 = 2.0 / 945.0;
+
+/**
+ * Near zero, the Langevin function (and its derivatives) are computed from their Taylor series.
+ * In single precision, coth(x) - 1/x loses most of its precision well before x = 0.001, so
+ * we switch to the series further out, and keep a couple more terms.
+ */
+template <typename SampleType>
+constexpr bool useExtendedSeries = std::is_same_v<SampleType, float>;
+
+template <typename SampleType>
+constexpr SampleType nearZeroLimit = useExtendedSeries<SampleType> ? (SampleType) 0.1 : (SampleType) 0.001;
 
 constexpr inline int sign (double x)
 {
@@ -52,9 +77,18 @@ template <typename Float, typename Bool>
 static inline Float langevin (Float x, Float coth, Bool nearZero) noexcept
 {
 #if HYSTERESIS_USE_SIMD
-    return xsimd::select (nearZero, x / 3.0, coth - ((Float) 1.0 / x));
+    if constexpr (useExtendedSeries<SampleTypeOf<Float>>)
+    {
+        const auto x2 = x * x;
+        const auto series = x * ((Float) ONE_THIRD + x2 * ((Float) NEG_ONE_OVER_45 + x2 * (Float) TWO_OVER_945));
+        return xsimd::select (nearZero, series, coth - ((Float) 1.0 / x));
+    }
+    else
+    {
+        return xsimd::select (nearZero, x / (Float) 3.0, coth - ((Float) 1.0 / x));
+    }
 #else
-    return ! nearZero ? (coth) - (1.0 / x) : x / 3.0;
+    return ! nearZero ? (coth) - ((Float) 1.0 / x) : x / (Float) 3.0;
 #endif
 }
 
@@ -63,9 +97,18 @@ template <typename Float, typename Bool>
 static inline Float langevinD (Float x, Float coth, Bool nearZero) noexcept
 {
 #if HYSTERESIS_USE_SIMD
-    return xsimd::select (nearZero, (Float) ONE_THIRD, ((Float) 1.0 / (x * x)) - (coth * coth) + 1.0);
+    if constexpr (useExtendedSeries<SampleTypeOf<Float>>)
+    {
+        const auto x2 = x * x;
+        const auto series = (Float) ONE_THIRD + x2 * ((Float) NEG_ONE_OVER_15 + x2 * (Float) TWO_OVER_189);
+        return xsimd::select (nearZero, series, ((Float) 1.0 / (x * x)) - (coth * coth) + (Float) 1.0);
+    }
+    else
+    {
+        return xsimd::select (nearZero, (Float) ONE_THIRD, ((Float) 1.0 / (x * x)) - (coth * coth) + (Float) 1.0);
+    }
 #else
-    return ! nearZero ? (1.0 / (x * x)) - (coth * coth) + 1.0 : ONE_THIRD;
+    return ! nearZero ? ((Float) 1.0 / (x * x)) - (coth * coth) + (Float) 1.0 : (Float) ONE_THIRD;
 #endif
 }
 
@@ -74,11 +117,19 @@ template <typename Float, typename Bool>
 static inline Float langevinD2 (Float x, Float coth, Bool nearZero) noexcept
 {
 #if HYSTERESIS_USE_SIMD
-    return xsimd::select (nearZero, x * NEG_TWO_OVER_15, (Float) 2.0 * coth * (coth * coth - 1.0) - ((Float) 2.0 / (x * x * x)));
+    if constexpr (useExtendedSeries<SampleTypeOf<Float>>)
+    {
+        const auto series = x * ((Float) NEG_TWO_OVER_15 + x * x * (Float) EIGHT_OVER_189);
+        return xsimd::select (nearZero, series, (Float) 2.0 * coth * (coth * coth - (Float) 1.0) - ((Float) 2.0 / (x * x * x)));
+    }
+    else
+    {
+        return xsimd::select (nearZero, x * (Float) NEG_TWO_OVER_15, (Float) 2.0 * coth * (coth * coth - (Float) 1.0) - ((Float) 2.0 / (x * x * x)));
+    }
 #else
     return ! nearZero
-               ? 2.0 * coth * (coth * coth - 1.0) - (2.0 / (x * x * x))
-               : NEG_TWO_OVER_15 * x;
+               ? (Float) 2.0 * coth * (coth * coth - (Float) 1.0) - ((Float) 2.0 / (x * x * x))
+               : (Float) NEG_TWO_OVER_15 * x;
 #endif
 }
 
@@ -86,28 +137,32 @@ static inline Float langevinD2 (Float x, Float coth, Bool nearZero) noexcept
 template <typename Float>
 static inline Float deriv (Float x_n, Float x_n1, Float x_d_n1, Float T) noexcept
 {
-    const Float dAlpha = 0.75;
+    const Float dAlpha = (Float) 0.75;
     return ((((Float) 1.0 + dAlpha) / T) * (x_n - x_n1)) - dAlpha * x_d_n1;
 }
 
 /** hysteresis function dM/dt */
 template <typename Float>
-static inline Float hysteresisFunc (Float M, Float H, Float H_d, HysteresisState& hp) noexcept
+static inline Float hysteresisFunc (Float M, Float H, Float H_d, HysteresisState<SampleTypeOf<Float>>& hp) noexcept
 {
-    hp.Q = (H + M * HysteresisOps::HysteresisState::alpha) * (1.0 / hp.a);
+    using SampleType = SampleTypeOf<Float>;
+    constexpr auto alpha = HysteresisState<SampleType>::alpha;
+    constexpr auto zeroLimit = nearZeroLimit<SampleType>;
+
+    hp.Q = (H + M * alpha) * ((SampleType) 1 / hp.a);
 
 #if HYSTERESIS_USE_SIMD
     hp.coth = (Float) 1.0 / xsimd::tanh (hp.Q);
-    hp.nearZero = (hp.Q < 0.001) && (hp.Q > -0.001);
+    hp.nearZero = (hp.Q < zeroLimit) && (hp.Q > -zeroLimit);
 #else
-    hp.coth = 1.0 / std::tanh (hp.Q);
-    hp.nearZero = hp.Q < 0.001 && hp.Q > -0.001;
+    hp.coth = (Float) 1.0 / std::tanh (hp.Q);
+    hp.nearZero = hp.Q < zeroLimit && hp.Q > -zeroLimit;
 #endif
 
     hp.M_diff = langevin (hp.Q, hp.coth, hp.nearZero) * hp.M_s - M;
 
 #if HYSTERESIS_USE_SIMD
-    const auto delta = xsimd::select (H_d >= 0.0, (Float) 1, (Float) -1);
+    const auto delta = xsimd::select (H_d >= (Float) 0.0, (Float) 1, (Float) -1);
     const auto delta_M = chowdsp::Math::sign (delta) == chowdsp::Math::sign (hp.M_diff);
     hp.kap1 = xsimd::select (delta_M, (Float) hp.nc, (Float) 0);
 #else
@@ -118,7 +173,7 @@ static inline Float hysteresisFunc (Float M, Float H, Float H_d, HysteresisState
 
     hp.L_prime = langevinD (hp.Q, hp.coth, hp.nearZero);
 
-    hp.f1Denom = ((Float) hp.nc * delta) * hp.k - (Float) HysteresisOps::HysteresisState::alpha * hp.M_diff;
+    hp.f1Denom = ((Float) hp.nc * delta) * hp.k - (Float) alpha * hp.M_diff;
     hp.f1 = hp.kap1 * hp.M_diff / hp.f1Denom;
     hp.f2 = hp.L_prime * hp.M_s_oa_tc;
     hp.f3 = (Float) 1.0 - (hp.L_prime * hp.M_s_oa_tc_talpha);
@@ -128,12 +183,14 @@ static inline Float hysteresisFunc (Float M, Float H, Float H_d, HysteresisState
 
 // derivative of hysteresis func w.r.t M (depends on cached values from computing hysteresisFunc)
 template <typename Float>
-static inline Float hysteresisFuncPrime (Float H_d, Float dMdt, HysteresisState& hp) noexcept
+static inline Float hysteresisFuncPrime (Float H_d, Float dMdt, HysteresisState<SampleTypeOf<Float>>& hp) noexcept
 {
+    constexpr auto alpha = HysteresisState<SampleTypeOf<Float>>::alpha;
+
     const Float L_prime2 = langevinD2 (hp.Q, hp.coth, hp.nearZero);
-    const Float M_diff2 = hp.L_prime * hp.M_s_oa_talpha - 1.0;
+    const Float M_diff2 = hp.L_prime * hp.M_s_oa_talpha - (Float) 1.0;
 
-    const Float f1_p = hp.kap1 * ((M_diff2 / hp.f1Denom) + hp.M_diff * HysteresisOps::HysteresisState::alpha * M_diff2 / (hp.f1Denom * hp.f1Denom));
+    const Float f1_p = hp.kap1 * ((M_diff2 / hp.f1Denom) + hp.M_diff * alpha * M_diff2 / (hp.f1Denom * hp.f1Denom));
     const Float f2_p = L_prime2 * hp.M_s_oaSq_tc_talpha;
     const Float f3_p = L_prime2 * (-hp.M_s_oaSq_tc_talphaSq);
 
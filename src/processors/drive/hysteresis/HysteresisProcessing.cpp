@@ -1,6 +1,7 @@
 #include "HysteresisProcessing.h"
 
-void HysteresisProcessing::reset()
+template <typename SampleType>
+void HysteresisProcessing<SampleType>::reset()
 {
     M_n1 = 0.0;
     H_n1 = 0.0;
@@ -10,34 +11,37 @@ void HysteresisProcessing::reset()
     hpState.nearZero = false;
 }
 
-void HysteresisProcessing::setSampleRate (double newSR)
+template <typename SampleType>
+void HysteresisProcessing<SampleType>::setSampleRate (double newSR)
 {
     fs = newSR;
-    T = 1.0 / fs;
-    Talpha = T / 1.9;
+    T = (SampleType) (1.0 / fs);
+    Talpha = T / (SampleType) 1.9;
 
     driveSmooth.reset (newSR, 0.01);
     satSmooth.reset (newSR, 0.01);
     widthSmooth.reset (newSR, 0.01);
 }
 
-void HysteresisProcessing::setParameters (float drive, float width, float sat)
+template <typename SampleType>
+void HysteresisProcessing<SampleType>::setParameters (float drive, float width, float sat)
 {
     driveSmooth.setTargetValue (drive);
     satSmooth.setTargetValue (sat);
     widthSmooth.setTargetValue (width);
 }
 
-void HysteresisProcessing::cook (float drive, float width, float sat)
+template <typename SampleType>
+void HysteresisProcessing<SampleType>::cook (float drive, float width, float sat)
 {
-    hpState.M_s = 0.5 + 1.5 * (1.0 - (double) sat);
-    hpState.a = hpState.M_s / (0.01 + 6.0 * (double) drive);
-    hpState.c = std::sqrt (1.0f - (double) width) - 0.01;
-    hpState.k = 0.47875;
-    upperLim = 20.0;
-
-    constexpr auto alpha = HysteresisOps::HysteresisState::alpha;
-    hpState.nc = 1.0 - hpState.c;
+    hpState.M_s = (SampleType) (0.5 + 1.5 * (1.0 - (double) sat));
+    hpState.a = hpState.M_s / (SampleType) (0.01 + 6.0 * (double) drive);
+    hpState.c = (SampleType) (std::sqrt (1.0f - (double) width) - 0.01);
+    hpState.k = (SampleType) 0.47875;
+    upperLim = (SampleType) 20.0;
+
+    constexpr auto alpha = HysteresisOps::HysteresisState<SampleType>::alpha;
+    hpState.nc = (SampleType) 1 - hpState.c;
     hpState.M_s_oa = hpState.M_s / hpState.a;
     hpState.M_s_oa_talpha = alpha * hpState.M_s_oa;
     hpState.M_s_oa_tc = hpState.c * hpState.M_s_oa;
@@ -46,13 +50,15 @@ void HysteresisProcessing::cook (float drive, float width, float sat)
     hpState.M_s_oaSq_tc_talphaSq = alpha * hpState.M_s_oaSq_tc_talpha;
 }
 
-void HysteresisProcessing::processBlock (double* bufferLeft, double* bufferRight, const int numSamples)
+template <typename SampleType>
+void HysteresisProcessing<SampleType>::processBlock (SampleType* bufferLeft, SampleType* bufferRight, const int numSamples)
 {
-    using Float = xsimd::batch<double>;
+    using Float = xsimd::batch<SampleType>;
 
     bool needsSmoothing = driveSmooth.isSmoothing() || widthSmooth.isSmoothing() || satSmooth.isSmoothing();
 
-    double stereoVec alignas (16)[2];
+    // any lanes past the right channel stay silent
+    alignas (Float::arch_type::alignment()) SampleType stereoVec[Float::size] {};
 
     if (needsSmoothing)
     {
@@ -64,7 +70,7 @@ void HysteresisProcessing::processBlock (double* bufferLeft, double* bufferRight
             stereoVec[1] = bufferRight[n];
             auto H = xsimd::load_aligned (stereoVec);
             auto H_d = HysteresisOps::deriv (H, H_n1, H_d_n1, (Float) T);
-            auto M = NRSolver<4> (H, H_d);
+            auto M = NRSolver<maxNRIterations> (H, H_d);
 
             // check for instability
 #if HYSTERESIS_USE_SIMD
@@ -95,7 +101,7 @@ void HysteresisProcessing::processBlock (double* bufferLeft, double* bufferRight
             stereoVec[1] = bufferRight[n];
             auto H = xsimd::load_aligned (stereoVec);
             auto H_d = HysteresisOps::deriv (H, H_n1, H_d_n1, (Float) T);
-            auto M = NRSolver<4> (H, H_d);
+            auto M = NRSolver<maxNRIterations> (H, H_d);
 
             // check for instability
 #if HYSTERESIS_USE_SIMD
@@ -118,3 +124,6 @@ void HysteresisProcessing::processBlock (double* bufferLeft, double* bufferRight
         }
     }
 }
+
+template class HysteresisProcessing<float>;
+template class HysteresisProcessing<double>;
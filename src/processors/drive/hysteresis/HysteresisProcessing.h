@@ -6,7 +6,13 @@
     Hysteresis processing for a model of an analog tape machine.
     For more information on the DSP happening here, see:
     https://ccrma.stanford.edu/~jatin/420/tape/TapeModel_DAFx.pdf
+
+    The left and right channels are processed in separate SIMD lanes.
+    In double precision, the Newton-Raphson solver runs a fixed number
+    of iterations. In single precision, the solver stops once all of the
+    lanes have converged, which usually only takes 2-3 iterations.
 */
+template <typename SampleType>
 class HysteresisProcessing
 {
 public:
@@ -17,9 +23,13 @@ public:
 
     void setParameters (float drive, float width, float sat);
 
-    void processBlock (double* bufferL, double* bufferR, const int numSamples);
+    void processBlock (SampleType* bufferL, SampleType* bufferR, const int numSamples);
 
 private:
+    static constexpr bool useAdaptiveIterations = std::is_same_v<SampleType, float>;
+    static constexpr int maxNRIterations = useAdaptiveIterations ? 8 : 4;
+    static constexpr auto nrTolerance = (SampleType) 1.0e-5;
+
     // newton-raphson solvers
     template <int nIterations, typename Float>
     inline Float NRSolver (Float H, Float H_d) noexcept
@@ -38,6 +48,12 @@ private:
             dMdtPrime = HysteresisOps::hysteresisFuncPrime (H_d, dMdt, hpState);
             deltaNR = (M - M_n1 - (Float) Talpha * (dMdt + last_dMdt)) / (Float (1.0) - (Float) Talpha * dMdtPrime);
             M -= deltaNR;
+
+            if constexpr (useAdaptiveIterations)
+            {
+                if (xsimd::all (xsimd::abs (deltaNR) < nrTolerance))
+                    break;
+            }
         }
 
         return M;
@@ -49,22 +65,22 @@ private:
 
     // parameter values
     double fs = 48000.0;
-    double T = 1.0 / fs;
-    double Talpha = T / 1.9;
-    double upperLim = 20.0;
+    SampleType T = (SampleType) (1.0 / fs);
+    SampleType Talpha = T / (SampleType) 1.9;
+    SampleType upperLim = 20.0;
 
     // state variables
 #if HYSTERESIS_USE_SIMD
-    xsimd::batch<double> M_n1 = 0.0;
-    xsimd::batch<double> H_n1 = 0.0;
-    xsimd::batch<double> H_d_n1 = 0.0;
+    xsimd::batch<SampleType> M_n1 = 0.0;
+    xsimd::batch<SampleType> H_n1 = 0.0;
+    xsimd::batch<SampleType> H_d_n1 = 0.0;
 #else
-    double M_n1 = 0.0;
-    double H_n1 = 0.0;
-    double H_d_n1 = 0.0;
+    SampleType M_n1 = 0.0;
+    SampleType H_n1 = 0.0;
+    SampleType H_d_n1 = 0.0;
 #endif
 
-    HysteresisOps::HysteresisState hpState;
+    HysteresisOps::HysteresisState<SampleType> hpState;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (HysteresisProcessing)
 };
@@ -53,13 +53,34 @@ void JuniorB::prepare (double sampleRate, int samplesPerBlock)
 
     dryBuffer.setMaxSize (2, samplesPerBlock);
 
-    // pre-buffering
-    ScopedValueSetter svs { preBuffering, true };
-    AudioBuffer<float> buffer (2, samplesPerBlock);
-    for (int i = 0; i < 50000; i += samplesPerBlock)
+    std::vector<SingleStageModel::WDF::State> wdfStates;
+    prepareSteadyState (sampleRate,
+                        {},
+                        [this, &wdfStates, samplesPerBlock]
+                        {
+                            // pre-buffering
+                            ScopedValueSetter svs { preBuffering, true };
+                            AudioBuffer<float> buffer (2, samplesPerBlock);
+                            for (int i = 0; i < 50000; i += samplesPerBlock)
+                            {
+                                buffer.clear();
+                                processAudio (buffer);
+                            }
+
+                            for (auto& stage : stages)
+                            {
+                                for (auto& wdf : stage.wdfs)
+                                    wdfStates.push_back (wdf.getState());
+                            }
+                        },
+                        wdfStates,
+                        dcBlocker);
+
+    auto wdfStateIter = wdfStates.begin();
+    for (auto& stage : stages)
     {
-        buffer.clear();
-        processAudio (buffer);
+        for (auto& wdf : stage.wdfs)
+            wdf.setState (*wdfStateIter++);
     }
 }
 
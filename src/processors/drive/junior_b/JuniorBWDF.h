@@ -27,6 +27,35 @@ struct JuniorBWDF
         return wdft::voltage<Float> (R6);
     }
 
+    /**
+     * The reactive elements hold all the state of the circuit (the triode model is
+     * stateless, and the adaptors are re-computed every sample), so the settled state
+     * of the circuit can be saved and restored by copying just those elements.
+     */
+    struct State
+    {
+        wdft::CapacitorT<Float> C24;
+        wdft::ResistorCapacitorParallelT<float> R4_C22;
+        wdft::ResistorCapacitorParallelT<float> R5_C2;
+        wdft::CapacitorT<Float> C1;
+    };
+
+    State getState() const { return { C24, R4_C22, R5_C2, C1 }; }
+
+    /** Restores a state from getState(). The circuit must have been prepared at the same sample rate. */
+    void setState (const State& state)
+    {
+        // copy the elements, but keep them connected to this circuit
+        C24 = state.C24;
+        C24.connectToParent (&P0);
+        R4_C22 = state.R4_C22;
+        R4_C22.connectToParent (&R);
+        R5_C2 = state.R5_C2;
+        R5_C2.connectToParent (&S2);
+        C1 = state.C1;
+        C1.connectToParent (&S1);
+    }
+
     wdft::ResistiveVoltageSourceT<Float> Vsig { (Float) 1.0e3 };
     wdft::PolarityInverterT<Float, decltype (Vsig)> Isig { Vsig };
 
@@ -9,7 +9,7 @@ MouseDrive::MouseDrive (UndoManager* um) : BaseProcessor ("Mouse Drive", createP
     distortionParam.setRampLength (0.025);
     distortionParam.mappingFunction = [] (float x)
     {
-        return 1.0f + MouseDriveWDF::Rdistortion * std::pow (x, 5.0f);
+        return 1.0f + MouseDriveWDF<wdf_simd::Batch>::Rdistortion * std::pow (x, 5.0f);
     };
     loadParameterPointer (volumeParam, vts, "volume");
 
@@ -25,8 +25,7 @@ MouseDrive::MouseDrive (UndoManager* um) : BaseProcessor ("Mouse Drive", createP
         "R2",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.R2.setResistanceValue (self.value.load());
+            wdf.R2.setResistanceValue (self.value.load());
         },
         10.0e3f,
         2.0e6f);
@@ -35,8 +34,7 @@ MouseDrive::MouseDrive (UndoManager* um) : BaseProcessor ("Mouse Drive", createP
         "R3",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.R3.setResistanceValue (self.value.load());
+            wdf.R3.setResistanceValue (self.value.load());
         },
         100.0f,
         1.0e6f);
@@ -45,8 +43,7 @@ MouseDrive::MouseDrive (UndoManager* um) : BaseProcessor ("Mouse Drive", createP
         "R4",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.R4_C5.setResistanceValue (self.value.load());
+            wdf.R4_C5.setResistanceValue (self.value.load());
         },
         10.0f,
         10.0e3f);
@@ -55,8 +52,7 @@ MouseDrive::MouseDrive (UndoManager* um) : BaseProcessor ("Mouse Drive", createP
         "R5",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.R5_C6.setResistanceValue (self.value.load());
+            wdf.R5_C6.setResistanceValue (self.value.load());
         },
         10.0f,
         100.0e3f);
@@ -65,8 +61,7 @@ MouseDrive::MouseDrive (UndoManager* um) : BaseProcessor ("Mouse Drive", createP
         "R6",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.R6_C7.setResistanceValue (self.value.load());
+            wdf.R6_C7.setResistanceValue (self.value.load());
         },
         100.0f,
         1.0e6f);
@@ -75,8 +70,7 @@ MouseDrive::MouseDrive (UndoManager* um) : BaseProcessor ("Mouse Drive", createP
         "C1",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.Vin_C1.setCapacitanceValue (self.value.load());
+            wdf.Vin_C1.setCapacitanceValue (self.value.load());
         },
         100.0e-12f,
         1.0e-3f);
@@ -85,8 +79,7 @@ MouseDrive::MouseDrive (UndoManager* um) : BaseProcessor ("Mouse Drive", createP
         "C2",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.C2.setCapacitanceValue (self.value.load());
+            wdf.C2.setCapacitanceValue (self.value.load());
         },
         1.0e-12f,
         1.0e-6f);
@@ -95,8 +88,7 @@ MouseDrive::MouseDrive (UndoManager* um) : BaseProcessor ("Mouse Drive", createP
         "C4",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.Rd_C4.setCapacitanceValue (self.value.load());
+            wdf.Rd_C4.setCapacitanceValue (self.value.load());
         },
         1.0e-12f,
         1.0e-6f);
@@ -105,8 +97,7 @@ MouseDrive::MouseDrive (UndoManager* um) : BaseProcessor ("Mouse Drive", createP
         "C5",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.R4_C5.setCapacitanceValue (self.value.load());
+            wdf.R4_C5.setCapacitanceValue (self.value.load());
         },
         100.0e-12f,
         1.0e-3f);
@@ -115,8 +106,7 @@ MouseDrive::MouseDrive (UndoManager* um) : BaseProcessor ("Mouse Drive", createP
         "C6",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.R5_C6.setCapacitanceValue (self.value.load());
+            wdf.R5_C6.setCapacitanceValue (self.value.load());
         },
         100.0e-12f,
         1.0e-3f);
@@ -125,8 +115,7 @@ MouseDrive::MouseDrive (UndoManager* um) : BaseProcessor ("Mouse Drive", createP
         "C7",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.R6_C7.setCapacitanceValue (self.value.load());
+            wdf.R6_C7.setCapacitanceValue (self.value.load());
         },
         100.0e-12f,
         1.0e-3f);
@@ -146,8 +135,7 @@ ParamLayout MouseDrive::createParameterLayout()
 void MouseDrive::prepare (double sampleRate, int samplesPerBlock)
 {
     distortionParam.prepare (sampleRate, samplesPerBlock);
-    for (auto& model : wdf)
-        model.prepare (sampleRate);
+    wdf.prepare (sampleRate);
 
     const auto spec = dsp::ProcessSpec { sampleRate, (uint32_t) samplesPerBlock, 2 };
     gain.setGainLinear (0.0f);
@@ -169,23 +157,21 @@ void MouseDrive::prepare (double sampleRate, int samplesPerBlock)
 void MouseDrive::processAudio (AudioBuffer<float>& buffer)
 {
     distortionParam.process (buffer.getNumSamples());
-    for (auto [ch, data] : chowdsp::buffer_iters::channels (buffer))
+    if (distortionParam.isSmoothing())
     {
-        if (distortionParam.isSmoothing())
-        {
-            const auto* distParamSmoothData = distortionParam.getSmoothedBuffer();
-            for (auto [n, x] : chowdsp::enumerate (data))
-            {
-                wdf[ch].Rd_C4.setResistanceValue (distParamSmoothData[n]);
-                x = wdf[ch].process (x);
-            }
-        }
-        else
-        {
-            wdf[ch].Rd_C4.setResistanceValue (distortionParam.getCurrentValue());
-            for (auto& x : data)
-                x = wdf[ch].process (x);
-        }
+        const auto* distParamSmoothData = distortionParam.getSmoothedBuffer();
+        wdf_simd::processChannels (buffer,
+                                   [this, distParamSmoothData] (int n, wdf_simd::Batch x)
+                                   {
+                                       wdf.Rd_C4.setResistanceValue (distParamSmoothData[n]);
+                                       return wdf.process (x);
+                                   });
+    }
+    else
+    {
+        wdf.Rd_C4.setResistanceValue (distortionParam.getCurrentValue());
+        wdf_simd::processChannels (buffer, [this] (int, wdf_simd::Batch x)
+                                   { return wdf.process (x); });
     }
 
     const auto volumeParamVal = volumeParam->getCurrentValue();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "MouseDriveWDF.h"
+#include "processors/WDFSimdHelpers.h"
 #include "processors/BaseProcessor.h"
 
 class MouseDrive : public BaseProcessor
@@ -9,6 +10,7 @@ public:
     explicit MouseDrive (UndoManager* um = nullptr);
 
     ProcessorType getProcessorType() const override { return Drive; }
+    double getTailLengthSeconds() const override { return 0.0; }
     static ParamLayout createParameterLayout();
 
     void prepare (double sampleRate, int samplesPerBlock) override;
@@ -18,7 +20,7 @@ private:
     chowdsp::SmoothedBufferValue<float, juce::ValueSmoothingTypes::Multiplicative> distortionParam;
     chowdsp::FloatParameter* volumeParam = nullptr;
 
-    MouseDriveWDF wdf[2];
+    MouseDriveWDF<wdf_simd::Batch> wdf;
     chowdsp::Gain<float> gain;
     chowdsp::FirstOrderHPF<float> dcBlocker;
 
@@ -30,8 +30,7 @@ MXRDistortion::MXRDistortion (UndoManager* um) : BaseProcessor ("Distortion Plus
         "R1",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.R1_C2.setResistanceValue (self.value.load());
+            wdf.R1_C2.setResistanceValue (self.value.load());
         },
         100.0f,
         500.0e3f);
@@ -40,8 +39,7 @@ MXRDistortion::MXRDistortion (UndoManager* um) : BaseProcessor ("Distortion Plus
         "R2",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.Vb.setResistanceValue (self.value.load());
+            wdf.Vb.setResistanceValue (self.value.load());
         },
         10.0e3f,
         10.0e6f);
@@ -50,8 +48,7 @@ MXRDistortion::MXRDistortion (UndoManager* um) : BaseProcessor ("Distortion Plus
         "R4",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.R4.setResistanceValue (self.value.load());
+            wdf.R4.setResistanceValue (self.value.load());
         },
         10.0e3f,
         10.0e6f);
@@ -60,8 +57,7 @@ MXRDistortion::MXRDistortion (UndoManager* um) : BaseProcessor ("Distortion Plus
         "R5",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.R5_C4.setResistanceValue (self.value.load());
+            wdf.R5_C4.setResistanceValue (self.value.load());
         },
         100.0f,
         500.0e3f);
@@ -70,8 +66,7 @@ MXRDistortion::MXRDistortion (UndoManager* um) : BaseProcessor ("Distortion Plus
         "C1",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.C1.setCapacitanceValue (self.value.load());
+            wdf.C1.setCapacitanceValue (self.value.load());
         },
         1.0e-12f,
         500.0e-3f);
@@ -80,8 +75,7 @@ MXRDistortion::MXRDistortion (UndoManager* um) : BaseProcessor ("Distortion Plus
         "C2",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.R1_C2.setCapacitanceValue (self.value.load());
+            wdf.R1_C2.setCapacitanceValue (self.value.load());
         },
         1.0e-12f,
         500.0e-3f);
@@ -90,8 +84,7 @@ MXRDistortion::MXRDistortion (UndoManager* um) : BaseProcessor ("Distortion Plus
         "C3",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.ResDist_R3_C3.setCapacitanceValue (self.value.load());
+            wdf.ResDist_R3_C3.setCapacitanceValue (self.value.load());
         },
         1.0e-12f,
         500.0e-3f);
@@ -100,8 +93,7 @@ MXRDistortion::MXRDistortion (UndoManager* um) : BaseProcessor ("Distortion Plus
         "C4",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.R5_C4.setCapacitanceValue (self.value.load());
+            wdf.R5_C4.setCapacitanceValue (self.value.load());
         },
         1.0e-12f,
         500.0e-3f);
@@ -110,8 +102,7 @@ MXRDistortion::MXRDistortion (UndoManager* um) : BaseProcessor ("Distortion Plus
         "C5",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.C5.setCapacitanceValue (self.value.load());
+            wdf.C5.setCapacitanceValue (self.value.load());
         },
         1.0e-12f,
         500.0e-3f);
@@ -128,11 +119,8 @@ ParamLayout MXRDistortion::createParameterLayout()
 
 void MXRDistortion::prepare (double sampleRate, int samplesPerBlock)
 {
-    for (auto& wdfProc : wdf)
-    {
-        wdfProc.prepare (sampleRate);
-        wdfProc.setParams (paramSkew (*distParam));
-    }
+    wdf.prepare (sampleRate);
+    wdf.setParams (paramSkew (*distParam));
 
     dcBlocker.prepare (sampleRate, samplesPerBlock);
 
@@ -154,14 +142,9 @@ void MXRDistortion::processAudio (AudioBuffer<float>& buffer)
     dsp::AudioBlock<float> block (buffer);
     dsp::ProcessContextReplacing<float> context (block);
 
-    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
-    {
-        wdf[ch].setParams (paramSkew (*distParam));
-
-        auto* x = buffer.getWritePointer (ch);
-        for (int n = 0; n < buffer.getNumSamples(); ++n)
-            x[n] = wdf[ch].processSample (x[n]);
-    }
+    wdf.setParams (paramSkew (*distParam));
+    wdf_simd::processChannels (buffer, [this] (int, wdf_simd::Batch x)
+                               { return wdf.processSample (x); });
 
     dcBlocker.processAudio (buffer);
 
@@ -2,6 +2,7 @@
 
 #include "../../utility/DCBlocker.h"
 #include "MXRDistWDF.h"
+#include "processors/WDFSimdHelpers.h"
 
 class MXRDistortion : public BaseProcessor
 {
@@ -9,6 +10,7 @@ public:
     explicit MXRDistortion (UndoManager* um = nullptr);
 
     ProcessorType getProcessorType() const override { return Drive; }
+    double getTailLengthSeconds() const override { return 0.0; }
     static ParamLayout createParameterLayout();
 
     void prepare (double sampleRate, int samplesPerBlock) override;
@@ -18,7 +20,7 @@ private:
     chowdsp::FloatParameter* distParam = nullptr;
     chowdsp::FloatParameter* levelParam = nullptr;
 
-    MXRDistWDF wdf[2];
+    MXRDistWDF<wdf_simd::Batch> wdf;
 
     dsp::Gain<float> gain;
     DCBlocker dcBlocker;
@@ -0,0 +1,225 @@
+#pragma once
+
+#include "ModelWeights.h"
+#include <pch.h>
+
+/**
+ * A group of small GRU networks (with Keras-style weights, and a dense output layer),
+ * which are processed together, with each network running in its own SIMD lane.
+ *
+ * Since the weight loads are shared across the lanes, it's cheap to keep running
+ * the networks that aren't currently being listened to, so that their state is
+ * still valid if we need to switch over to them.
+ *
+ * Like RTNeural's "NoInterp" sample rate correction, the recurrent state can be
+ * delayed by an integer number of samples, when running at a multiple of the
+ * networks' training sample rate.
+ */
+template <int numLanes, int hiddenSize>
+class BatchedGRU
+{
+public:
+    using Batch = xsimd::batch<float>;
+    static constexpr int batchSize = (int) Batch::size;
+    static constexpr int numBatches = (numLanes + batchSize - 1) / batchSize;
+
+    /** Hidden state for each lane */
+    using LaneStates = std::array<std::array<float, (size_t) hiddenSize>, (size_t) numLanes>;
+
+    BatchedGRU() = default;
+
+    /** Loads the weights for a single lane, from an RTNeural-style Keras model. */
+    void loadLaneWeights (int lane, const ModelWeights& modelWeights)
+    {
+        constexpr auto numGateUnits = size_t (3 * hiddenSize);
+        const auto& kernel = modelWeights.getTensor ("/layers/0/weights/0", { 1, numGateUnits });
+        const auto& recurrentKernel = modelWeights.getTensor ("/layers/0/weights/1", { (size_t) hiddenSize, numGateUnits });
+        const auto& bias = modelWeights.getTensor ("/layers/0/weights/2", { 2, numGateUnits });
+        const auto& denseKernel = modelWeights.getTensor ("/layers/1/weights/0", { (size_t) hiddenSize, 1 });
+        const auto& denseBias = modelWeights.getTensor ("/layers/1/weights/1", { 1 });
+
+        auto& w = weights[size_t (lane / batchSize)];
+        const auto laneIdx = size_t (lane % batchSize);
+
+        // Keras gate order is: update, reset, new
+        for (size_t gate = 0; gate < 3; ++gate)
+        {
+            for (size_t j = 0; j < (size_t) hiddenSize; ++j)
+            {
+                const auto col = gate * (size_t) hiddenSize + j;
+                w.kernel[gate][j][laneIdx] = kernel (0, col);
+                w.inputBias[gate][j][laneIdx] = bias (0, col);
+                w.recurrentBias[gate][j][laneIdx] = bias (1, col);
+
+                for (size_t k = 0; k < (size_t) hiddenSize; ++k)
+                    w.recurrentKernel[gate][j][k][laneIdx] = recurrentKernel (k, col);
+            }
+        }
+
+        for (size_t k = 0; k < (size_t) hiddenSize; ++k)
+            w.denseKernel[k][laneIdx] = denseKernel (k, 0);
+        w.denseBias[laneIdx] = denseBias (0);
+    }
+
+    /** Prepares the networks, with the recurrent state delayed by the given number of samples. */
+    void prepare (int delaySamples)
+    {
+        stateHistory.resize ((size_t) jmax (1, delaySamples));
+        reset();
+    }
+
+    /** Sets the hidden state that the networks will start from when they are reset. */
+    void setInitialState (const LaneStates& laneStates)
+    {
+        for (size_t lane = 0; lane < (size_t) numLanes; ++lane)
+            for (size_t j = 0; j < (size_t) hiddenSize; ++j)
+                initialState[lane / (size_t) batchSize][j][lane % (size_t) batchSize] = laneStates[lane][j];
+    }
+
+    /** Resets the networks to their initial state. */
+    void reset()
+    {
+        for (auto& historyState : stateHistory)
+            for (size_t b = 0; b < (size_t) numBatches; ++b)
+                for (size_t j = 0; j < (size_t) hiddenSize; ++j)
+                    historyState[b][j] = xsimd::load_aligned (initialState[b][j]);
+
+        historyIndex = 0;
+    }
+
+    /**
+     * Finds the state that the networks settle into, when given a silent input.
+     * This state doesn't depend on the sample rate, so it can be computed once, and
+     * used as the initial state for the networks, instead of pre-buffering them.
+     */
+    [[nodiscard]] LaneStates computeSteadyState (int maxNumIterations = 10000, float tolerance = 1.0e-7f) const
+    {
+        std::array<BatchState, (size_t) numBatches> state {};
+        for (size_t b = 0; b < (size_t) numBatches; ++b)
+        {
+            for (int i = 0; i < maxNumIterations; ++i)
+            {
+                const auto newState = computeNextState (weights[b], Batch (0.0f), state[b]);
+
+                auto maxChange = Batch (0.0f);
+                for (size_t j = 0; j < (size_t) hiddenSize; ++j)
+                    maxChange = xsimd::max (maxChange, xsimd::abs (newState[j] - state[b][j]));
+
+                state[b] = newState;
+
+                alignas (Batch::arch_type::alignment()) float changeData[batchSize];
+                maxChange.store_aligned (changeData);
+                if (*std::max_element (std::begin (changeData), std::end (changeData)) < tolerance)
+                    break;
+            }
+        }
+
+        LaneStates laneStates {};
+        alignas (Batch::arch_type::alignment()) float data[batchSize];
+        for (size_t lane = 0; lane < (size_t) numLanes; ++lane)
+        {
+            for (size_t j = 0; j < (size_t) hiddenSize; ++j)
+            {
+                state[lane / (size_t) batchSize][j].store_aligned (data);
+                laneStates[lane][j] = data[lane % (size_t) batchSize];
+            }
+        }
+
+        return laneStates;
+    }
+
+    /**
+     * Processes the lanes in the range [firstLane, lastLane]. The rest of the
+     * lanes in the SIMD batches that overlap that range are processed as well.
+     *
+     * Lanes with a null input pointer are given a silent input, and lanes with
+     * a null output pointer are processed, but their output is discarded.
+     * The input and output pointers for a lane may point to the same data.
+     */
+    void process (const std::array<const float*, (size_t) numLanes>& laneInputs,
+                  const std::array<float*, (size_t) numLanes>& laneOutputs,
+                  int numSamples,
+                  int firstLane = 0,
+                  int lastLane = numLanes - 1) noexcept
+    {
+        const auto firstBatch = (size_t) (firstLane / batchSize);
+        const auto lastBatch = (size_t) (lastLane / batchSize);
+        const auto historySize = stateHistory.size();
+
+        alignas (Batch::arch_type::alignment()) float data[batchSize] {};
+        for (int n = 0; n < numSamples; ++n)
+        {
+            auto& state = stateHistory[historyIndex];
+            for (auto b = firstBatch; b <= lastBatch; ++b)
+            {
+                const auto laneOffset = b * (size_t) batchSize;
+                for (size_t i = 0; i < (size_t) batchSize && laneOffset + i < (size_t) numLanes; ++i)
+                    data[i] = laneInputs[laneOffset + i] != nullptr ? laneInputs[laneOffset + i][n] : 0.0f;
+
+                const auto& w = weights[b];
+                state[b] = computeNextState (w, xsimd::load_aligned (data), state[b]);
+
+                auto y = xsimd::load_aligned (w.denseBias);
+                for (size_t k = 0; k < (size_t) hiddenSize; ++k)
+                    y = xsimd::fma (xsimd::load_aligned (w.denseKernel[k]), state[b][k], y);
+
+                y.store_aligned (data);
+                for (size_t i = 0; i < (size_t) batchSize && laneOffset + i < (size_t) numLanes; ++i)
+                {
+                    if (laneOutputs[laneOffset + i] != nullptr)
+                        laneOutputs[laneOffset + i][n] = data[i];
+                }
+            }
+
+            historyIndex = historyIndex + 1 == historySize ? 0 : historyIndex + 1;
+        }
+    }
+
+private:
+    using BatchState = std::array<Batch, (size_t) hiddenSize>;
+
+    struct alignas (Batch::arch_type::alignment()) BatchWeights
+    {
+        float kernel[3][hiddenSize][batchSize] {};
+        float recurrentKernel[3][hiddenSize][hiddenSize][batchSize] {};
+        float inputBias[3][hiddenSize][batchSize] {};
+        float recurrentBias[3][hiddenSize][batchSize] {};
+        float denseKernel[hiddenSize][batchSize] {};
+        float denseBias[batchSize] {};
+    };
+
+    static BatchState computeNextState (const BatchWeights& w, const Batch& x, const BatchState& h) noexcept
+    {
+        const auto sigmoid = [] (const Batch& v)
+        { return Batch (1.0f) / (Batch (1.0f) + xsimd::exp (-v)); };
+
+        BatchState newState;
+        for (size_t j = 0; j < (size_t) hiddenSize; ++j)
+        {
+            auto z = xsimd::fma (xsimd::load_aligned (w.kernel[0][j]), x, xsimd::load_aligned (w.inputBias[0][j]) + xsimd::load_aligned (w.recurrentBias[0][j]));
+            auto r = xsimd::fma (xsimd::load_aligned (w.kernel[1][j]), x, xsimd::load_aligned (w.inputBias[1][j]) + xsimd::load_aligned (w.recurrentBias[1][j]));
+            auto c = xsimd::load_aligned (w.recurrentBias[2][j]);
+            for (size_t k = 0; k < (size_t) hiddenSize; ++k)
+            {
+                z = xsimd::fma (xsimd::load_aligned (w.recurrentKernel[0][j][k]), h[k], z);
+                r = xsimd::fma (xsimd::load_aligned (w.recurrentKernel[1][j][k]), h[k], r);
+                c = xsimd::fma (xsimd::load_aligned (w.recurrentKernel[2][j][k]), h[k], c);
+            }
+
+            z = sigmoid (z);
+            r = sigmoid (r);
+            const auto candidate = xsimd::tanh (xsimd::fma (xsimd::load_aligned (w.kernel[2][j]), x, xsimd::load_aligned (w.inputBias[2][j])) + r * c);
+            newState[j] = xsimd::fma (z, h[j] - candidate, candidate);
+        }
+
+        return newState;
+    }
+
+    std::array<BatchWeights, (size_t) numBatches> weights {};
+    alignas (Batch::arch_type::alignment()) float initialState[numBatches][hiddenSize][batchSize] {};
+
+    std::vector<std::array<BatchState, (size_t) numBatches>> stateHistory { 1 };
+    size_t historyIndex = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BatchedGRU)
+};
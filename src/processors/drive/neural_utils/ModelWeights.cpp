@@ -0,0 +1,324 @@
+#include "ModelWeights.h"
+#include "state/StateAssets.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+constexpr size_t headerSize = 4 * sizeof (uint32_t);
+
+size_t getAlignedSize (size_t size)
+{
+    return (size + ModelWeights::tensorAlignment - 1) & ~(ModelWeights::tensorAlignment - 1);
+}
+
+std::string escapeJSONPointerToken (const std::string& token)
+{
+    std::string escapedToken;
+    for (auto c : token)
+    {
+        if (c == '~')
+            escapedToken += "~0";
+        else if (c == '/')
+            escapedToken += "~1";
+        else
+            escapedToken += c;
+    }
+    return escapedToken;
+}
+
+/** Returns true if the JSON is a non-empty, rectangular, array of numbers (i.e. a tensor) */
+bool getTensorShape (const nlohmann::json& json, std::vector<size_t>& shape)
+{
+    if (! json.is_array() || json.empty())
+        return false;
+
+    if (json.front().is_number())
+    {
+        for (const auto& element : json)
+            if (! element.is_number())
+                return false;
+
+        shape = { json.size() };
+        return true;
+    }
+
+    std::vector<size_t> innerShape;
+    if (! getTensorShape (json.front(), innerShape))
+        return false;
+
+    for (const auto& element : json)
+    {
+        std::vector<size_t> elementShape;
+        if (! getTensorShape (element, elementShape) || elementShape != innerShape)
+            return false;
+    }
+
+    shape = { json.size() };
+    shape.insert (shape.end(), innerShape.begin(), innerShape.end());
+    return true;
+}
+
+void flattenTensor (const nlohmann::json& json, std::vector<float>& data)
+{
+    if (json.is_number())
+    {
+        data.push_back (json.get<float>());
+        return;
+    }
+
+    for (const auto& element : json)
+        flattenTensor (element, data);
+}
+
+nlohmann::json unflattenTensor (const float* data, const size_t* shape, size_t numDims)
+{
+    if (numDims == 1)
+        return std::vector<float> (data, data + shape[0]);
+
+    size_t innerSize = 1;
+    for (size_t i = 1; i < numDims; ++i)
+        innerSize *= shape[i];
+
+    auto json = nlohmann::json::array();
+    for (size_t i = 0; i < shape[0]; ++i)
+        json.push_back (unflattenTensor (data + i * innerSize, shape + 1, numDims - 1));
+    return json;
+}
+
+template <typename T>
+T readValue (const char* data, size_t& offset, size_t dataSize)
+{
+    if (offset + sizeof (T) > dataSize)
+        throw std::runtime_error ("Model weights data is truncated!");
+
+    T value;
+    std::memcpy (&value, data + offset, sizeof (T));
+    offset += sizeof (T);
+    return ByteOrder::swapIfBigEndian (value);
+}
+
+template <typename T>
+void writeValue (std::vector<char>& data, T value)
+{
+    const auto offset = data.size();
+    data.resize (offset + sizeof (T));
+    value = ByteOrder::swapIfBigEndian (value);
+    std::memcpy (data.data() + offset, &value, sizeof (T));
+}
+} // namespace
+
+std::vector<std::vector<float>> ModelWeights::Tensor::toVector2D() const
+{
+    std::vector<std::vector<float>> vec (shape[0]);
+    for (size_t i = 0; i < shape[0]; ++i)
+        vec[i].assign (data + i * shape[1], data + (i + 1) * shape[1]);
+    return vec;
+}
+
+bool ModelWeights::isModelWeightsData (const void* data, size_t size) noexcept
+{
+    if (data == nullptr || size < headerSize)
+        return false;
+
+    return ByteOrder::littleEndianInt (data) == magicNumber;
+}
+
+std::shared_ptr<const ModelWeights> ModelWeights::fromBinary (const void* data, size_t size, std::shared_ptr<const void> owner)
+{
+    if (! isModelWeightsData (data, size))
+        throw std::runtime_error ("Data does not contain model weights!");
+
+    // the tensors need to be aligned so that we can read them in-place
+    if (reinterpret_cast<uintptr_t> (data) % alignof (float) != 0)
+    {
+        auto alignedCopy = std::make_shared<std::vector<float>> ((size + sizeof (float) - 1) / sizeof (float));
+        std::memcpy (alignedCopy->data(), data, size);
+        return fromBinary (alignedCopy->data(), size, alignedCopy);
+    }
+
+    const auto* bytes = static_cast<const char*> (data);
+    size_t offset = sizeof (uint32_t);
+    if (readValue<uint32_t> (bytes, offset, size) > formatVersion)
+        throw std::runtime_error ("Model weights were saved with a newer format version!");
+
+    const auto numTensors = (size_t) readValue<uint32_t> (bytes, offset, size);
+    const auto metadataSize = (size_t) readValue<uint32_t> (bytes, offset, size);
+    if (offset + metadataSize > size)
+        throw std::runtime_error ("Model weights data is truncated!");
+
+    auto weights = std::make_shared<ModelWeights>();
+    weights->dataOwner = std::move (owner);
+    weights->metadata = nlohmann::json::parse (bytes + offset, bytes + offset + metadataSize);
+    offset += metadataSize;
+
+    for (size_t i = 0; i < numTensors; ++i)
+    {
+        const auto nameLength = (size_t) readValue<uint32_t> (bytes, offset, size);
+        if (offset + nameLength > size)
+            throw std::runtime_error ("Model weights data is truncated!");
+        std::string name { bytes + offset, nameLength };
+        offset += nameLength;
+
+        Tensor tensor;
+        const auto numDims = (size_t) readValue<uint32_t> (bytes, offset, size);
+        if (numDims > (size - offset) / sizeof (uint32_t))
+            throw std::runtime_error ("Model weights data is truncated!");
+
+        tensor.shape.resize (numDims);
+        for (auto& dim : tensor.shape)
+            dim = (size_t) readValue<uint32_t> (bytes, offset, size);
+
+        const auto dataOffset = (size_t) readValue<uint32_t> (bytes, offset, size);
+        if (dataOffset % tensorAlignment != 0 || dataOffset > size)
+            throw std::runtime_error ("Model weights data is truncated!");
+
+        // check the size as each dimension is multiplied in, so that a corrupted shape can't overflow it
+        const auto maxNumElements = (size - dataOffset) / sizeof (float);
+        size_t numElements = 1;
+        for (auto dim : tensor.shape)
+        {
+            if (dim != 0 && numElements > maxNumElements / dim)
+                throw std::runtime_error ("Model weights data is truncated!");
+            numElements *= dim;
+        }
+
+        tensor.data = reinterpret_cast<const float*> (bytes + dataOffset);
+        weights->tensors.emplace (std::move (name), std::move (tensor));
+    }
+
+#if JUCE_BIG_ENDIAN
+    // the tensor data is little-endian, so it can't be read in-place
+    size_t totalNumElements = 0;
+    for (const auto& [name, tensor] : weights->tensors)
+        totalNumElements += tensor.size();
+    weights->ownedData.reserve (totalNumElements);
+
+    for (auto& [name, tensor] : weights->tensors)
+    {
+        const auto tensorOffset = weights->ownedData.size();
+        for (size_t i = 0; i < tensor.size(); ++i)
+            weights->ownedData.push_back (ByteOrder::swap (tensor.data[i]));
+        tensor.data = weights->ownedData.data() + tensorOffset;
+    }
+#endif
+
+    weights->contentHash = StateAssets::computeHash (data, size);
+    return weights;
+}
+
+std::shared_ptr<const ModelWeights> ModelWeights::fromJSON (const nlohmann::json& modelJson)
+{
+    auto weights = std::make_shared<ModelWeights>();
+    weights->metadata = modelJson;
+
+    std::vector<std::pair<std::string, size_t>> tensorOffsets;
+    const auto findTensors = [&weights, &tensorOffsets] (auto& self, nlohmann::json& json, const std::string& path) -> void
+    {
+        if (std::vector<size_t> shape; getTensorShape (json, shape))
+        {
+            tensorOffsets.emplace_back (path, weights->ownedData.size());
+            flattenTensor (json, weights->ownedData);
+            weights->tensors[path].shape = std::move (shape);
+            json = nullptr;
+        }
+        else if (json.is_object())
+        {
+            for (auto& [key, value] : json.items())
+                self (self, value, path + "/" + escapeJSONPointerToken (key));
+        }
+        else if (json.is_array())
+        {
+            for (size_t i = 0; i < json.size(); ++i)
+                self (self, json[i], path + "/" + std::to_string (i));
+        }
+    };
+    findTensors (findTensors, weights->metadata, {});
+
+    // now that all the data is in place, we can point the tensors at it
+    for (const auto& [name, dataOffset] : tensorOffsets)
+        weights->tensors[name].data = weights->ownedData.data() + dataOffset;
+
+    // hash the binary format, so that the model has the same hash however it was loaded
+    const auto binaryData = weights->toBinary();
+    weights->contentHash = StateAssets::computeHash (binaryData.data(), binaryData.size());
+    return weights;
+}
+
+std::vector<char> ModelWeights::toBinary() const
+{
+    const auto metadataString = metadata.dump();
+
+    std::vector<char> data;
+    writeValue<uint32_t> (data, magicNumber);
+    writeValue<uint32_t> (data, formatVersion);
+    writeValue<uint32_t> (data, (uint32_t) tensors.size());
+    writeValue<uint32_t> (data, (uint32_t) metadataString.size());
+    data.insert (data.end(), metadataString.begin(), metadataString.end());
+
+    // work out where the tensor data will go, once the tensor table has been written
+    auto tableSize = size_t {};
+    for (const auto& [name, tensor] : tensors)
+        tableSize += 3 * sizeof (uint32_t) + name.size() + tensor.shape.size() * sizeof (uint32_t);
+
+    auto dataOffset = getAlignedSize (data.size() + tableSize);
+    std::vector<size_t> dataOffsets;
+    for (const auto& [name, tensor] : tensors)
+    {
+        writeValue<uint32_t> (data, (uint32_t) name.size());
+        data.insert (data.end(), name.begin(), name.end());
+        writeValue<uint32_t> (data, (uint32_t) tensor.shape.size());
+        for (auto dim : tensor.shape)
+            writeValue<uint32_t> (data, (uint32_t) dim);
+        writeValue<uint32_t> (data, (uint32_t) dataOffset);
+
+        dataOffsets.push_back (dataOffset);
+        dataOffset = getAlignedSize (dataOffset + tensor.size() * sizeof (float));
+    }
+
+    data.resize (dataOffset, 0);
+    size_t tensorIndex = 0;
+    for (const auto& [name, tensor] : tensors)
+    {
+        auto* tensorData = data.data() + dataOffsets[tensorIndex++];
+#if JUCE_BIG_ENDIAN
+        for (size_t i = 0; i < tensor.size(); ++i)
+        {
+            const auto value = ByteOrder::swap (tensor.data[i]);
+            std::memcpy (tensorData + i * sizeof (float), &value, sizeof (float));
+        }
+#else
+        std::memcpy (tensorData, tensor.data, tensor.size() * sizeof (float));
+#endif
+    }
+
+    return data;
+}
+
+nlohmann::json ModelWeights::toJSON() const
+{
+    auto json = metadata;
+    for (const auto& [name, tensor] : tensors)
+        json[nlohmann::json::json_pointer { name }] = unflattenTensor (tensor.data, tensor.shape.data(), tensor.shape.size());
+
+    return json;
+}
+
+const ModelWeights::Tensor& ModelWeights::getTensor (const std::string& name) const
+{
+    const auto tensorIter = tensors.find (name);
+    if (tensorIter == tensors.end())
+        throw std::runtime_error ("Model weights are missing tensor: " + name);
+
+    return tensorIter->second;
+}
+
+const ModelWeights::Tensor& ModelWeights::getTensor (const std::string& name, const std::vector<size_t>& expectedShape) const
+{
+    const auto& tensor = getTensor (name);
+    if (tensor.shape != expectedShape)
+        throw std::runtime_error ("Model weights do not match the expected model architecture! (" + name + ")");
+
+    return tensor;
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <modules/json/json.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * Neural network weights, stored as a set of named float tensors, along with
+ * the rest of the model information (as JSON metadata).
+ *
+ * The built-in models are converted from JSON ahead of time (see
+ * scripts/convert_model_weights.py), so that they can be loaded without
+ * parsing any text. The binary format is (all values little-endian):
+ * - Header: magic number, format version, number of tensors, metadata size (uint32)
+ * - Metadata: the original model JSON (UTF-8), with each tensor replaced by null
+ * - Tensor table: for each tensor, the name length (uint32), the name (a JSON pointer
+ *   to where the tensor sits in the original JSON), the number of dimensions (uint32),
+ *   the dimensions (uint32), and the offset of the tensor data from the start (uint32)
+ * - Tensor data: row-major float32 arrays, each aligned to 16 bytes
+ */
+class ModelWeights
+{
+public:
+    /** A read-only view of a tensor's data */
+    struct Tensor
+    {
+        std::vector<size_t> shape;
+        const float* data = nullptr;
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            size_t numElements = 1;
+            for (auto dim : shape)
+                numElements *= dim;
+            return numElements;
+        }
+
+        /** Returns an element of a 1D tensor (or the flattened tensor) */
+        [[nodiscard]] float operator() (size_t i) const noexcept { return data[i]; }
+
+        /** Returns an element of a 2D tensor */
+        [[nodiscard]] float operator() (size_t i, size_t j) const noexcept { return data[i * shape[1] + j]; }
+
+        [[nodiscard]] std::vector<float> toVector() const { return { data, data + size() }; }
+        [[nodiscard]] std::vector<std::vector<float>> toVector2D() const;
+    };
+
+    ModelWeights() = default;
+    ModelWeights (const ModelWeights&) = delete; // the tensors point into the data
+    ModelWeights& operator= (const ModelWeights&) = delete;
+
+    /** Returns true if the data looks like binary model weights */
+    static bool isModelWeightsData (const void* data, size_t size) noexcept;
+
+    /**
+     * Loads weights from the binary format. The tensors point into the given data
+     * wherever possible, so the owner must keep the data alive (the data in BinaryData
+     * is always alive, so it doesn't need an owner).
+     *
+     * Throws an exception if the data is not valid.
+     */
+    static std::shared_ptr<const ModelWeights> fromBinary (const void* data, size_t size, std::shared_ptr<const void> owner = {});
+
+    /** Converts weights from JSON (e.g. for custom models), in the same way as scripts/convert_model_weights.py. */
+    static std::shared_ptr<const ModelWeights> fromJSON (const nlohmann::json& modelJson);
+
+    /** Writes the weights into the binary format. */
+    [[nodiscard]] std::vector<char> toBinary() const;
+
+    /** Converts the weights back to their original JSON format. */
+    [[nodiscard]] nlohmann::json toJSON() const;
+
+    /** Returns the tensor with the given name (e.g. "/state_dict/lin.bias"), or throws an exception if it doesn't exist. */
+    [[nodiscard]] const Tensor& getTensor (const std::string& name) const;
+
+    /** Returns the tensor with the given name, and checks that it has the expected shape. */
+    [[nodiscard]] const Tensor& getTensor (const std::string& name, const std::vector<size_t>& expectedShape) const;
+
+    /** Returns the model information that isn't stored in the tensors. */
+    [[nodiscard]] const nlohmann::json& getMetadata() const noexcept { return metadata; }
+
+    /**
+     * Returns a hash of the weights in the binary format (the same hash that StateAssets
+     * would give the binary data), which is computed once when the weights are loaded,
+     * so that the model can be identified without serialising it again.
+     */
+    [[nodiscard]] uint64_t getContentHash() const noexcept { return contentHash; }
+
+    static constexpr uint32_t magicNumber = 0x574e5942; // "BYNW"
+    static constexpr uint32_t formatVersion = 1;
+    static constexpr size_t tensorAlignment = 16;
+
+private:
+    nlohmann::json metadata;
+    std::map<std::string, Tensor> tensors;
+    uint64_t contentHash = 0;
+
+    std::shared_ptr<const void> dataOwner;
+    std::vector<float> ownedData;
+};
@@ -1,6 +1,18 @@
 #include "RNNAccelerated.h"
 
-#if __AVX__
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#if __AVX512F__
+#define RTNeural RTNeural_avx512
+#define xsimd xsimd_avx512
+#elif __AVX2__
+#define RTNeural RTNeural_avx2
+#define xsimd xsimd_avx2
+#elif __AVX__
 #define RTNeural RTNeural_avx
 #define xsimd xsimd_avx
 #elif __SSE__
@@ -29,17 +41,23 @@
 #if (__aarch64__ || __arm__)
 namespace rnn_arm
 {
+#elif __AVX512F__ || (_MSC_VER && BYOD_COMPILING_WITH_AVX512)
+namespace rnn_avx512
+{
+#elif __AVX2__ || (_MSC_VER && BYOD_COMPILING_WITH_AVX2)
+namespace rnn_avx2
+{
 #elif __AVX__ || (_MSC_VER && BYOD_COMPILING_WITH_AVX)
 namespace rnn_avx
 {
-#elif __SSE__ || (_MSC_VER && ! BYOD_COMPILING_WITH_AVX)
+#elif __SSE__ || (_MSC_VER && ! (BYOD_COMPILING_WITH_AVX || BYOD_COMPILING_WITH_AVX2 || BYOD_COMPILING_WITH_AVX512))
 namespace rnn_sse
 {
 #else
 #error "Unknown or un-supported platform!"
 #endif
 
-#if ! (XSIMD_WITH_NEON && BYOD_COMPILING_WITH_AVX)
+#if ! (XSIMD_WITH_NEON && (BYOD_COMPILING_WITH_AVX || BYOD_COMPILING_WITH_AVX2 || BYOD_COMPILING_WITH_AVX512))
 
 template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
 struct RNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::Internal
@@ -65,10 +83,10 @@ RNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::~RNNAccelera
 }
 
 template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
-void RNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::initialise (const nlohmann::json& weights_json)
+void RNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::initialise (const ModelWeights& weights)
 {
     // @TODO: handle GRU models if needed...
-    model_loaders::loadLSTMModel (internal->model, weights_json);
+    model_loaders::loadLSTMModel<inputSize, hiddenSize> (internal->model, weights);
 }
 
 template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
@@ -136,9 +154,341 @@ void RNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::process
     }
 }
 
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+std::shared_ptr<const void> RNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::get_state() const
+{
+    // RTNeural doesn't expose the recurrent state on its own, so we copy the whole model
+    return std::make_shared<const Internal> (*internal);
+}
+
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+void RNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::set_state (const std::shared_ptr<const void>& state)
+{
+    // the model was prepared with the same delay, so this copy doesn't need to re-allocate the delayed states
+    *internal = *static_cast<const Internal*> (state.get());
+}
+
 template class RNNAccelerated<1, 28, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::NoInterp>; // MetalFace
 template class RNNAccelerated<2, 24, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::NoInterp>; // BassFace
 template class RNNAccelerated<1, 40, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::LinInterp>; // GuitarML (no-cond)
 template class RNNAccelerated<2, 40, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::LinInterp>; // GuitarML (cond)
+
+//=======================================================
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+struct StereoRNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::Internal
+{
+    static_assert (RecurrentLayerType == RecurrentLayerType::LSTMLayer, "Stereo processing is only implemented for LSTM models!");
+
+    using Batch = xsimd::batch<float>;
+    static constexpr int batch_size = (int) Batch::size;
+    static constexpr int v_hidden_size = (hiddenSize + batch_size - 1) / batch_size;
+    static constexpr int padded_hidden_size = v_hidden_size * batch_size;
+    static constexpr int num_gates = 4; // input, forget, cell, output (same order as PyTorch)
+    static constexpr int max_num_channels = 2;
+
+    // The weights are stored as columns, so that each column can be multiplied
+    // by a single value from the input or hidden state of each channel.
+    Batch W[num_gates][inputSize][v_hidden_size];
+    Batch U[num_gates][hiddenSize][v_hidden_size];
+    Batch b[num_gates][v_hidden_size];
+    Batch dense_weights[v_hidden_size];
+    float dense_bias = 0.0f;
+
+    struct State
+    {
+        alignas (alignment) float h[max_num_channels][padded_hidden_size] {};
+        alignas (alignment) float c[max_num_channels][padded_hidden_size] {};
+    };
+
+    // Sample rate correction: the recurrent state used for each sample
+    // is the state from delay_samples + delay_frac samples ago.
+    std::vector<State> state_history = std::vector<State> (3);
+    size_t latest_state_index = 0;
+    int delay_samples = 1;
+    float delay_frac = 0.0f;
+    State interp_state;
+
+    void load_weights (const ModelWeights& weights)
+    {
+        const auto& weights_ih = weights.getTensor ("/state_dict/rec.weight_ih_l0", { (size_t) num_gates * hiddenSize, (size_t) inputSize });
+        const auto& weights_hh = weights.getTensor ("/state_dict/rec.weight_hh_l0", { (size_t) num_gates * hiddenSize, (size_t) hiddenSize });
+        const auto& bias_ih = weights.getTensor ("/state_dict/rec.bias_ih_l0", { (size_t) num_gates * hiddenSize });
+        const auto& bias_hh = weights.getTensor ("/state_dict/rec.bias_hh_l0", { (size_t) num_gates * hiddenSize });
+        const auto& dense_w = weights.getTensor ("/state_dict/lin.weight", { 1, (size_t) hiddenSize });
+        const auto& dense_b = weights.getTensor ("/state_dict/lin.bias", { 1 });
+
+        // gathers the values for each row of a batch column, and zero-pads the rows past the hidden size
+        const auto make_column = [] (auto&& get_value, int v_idx)
+        {
+            alignas (alignment) float data[batch_size] {};
+            for (int k = 0; k < batch_size; ++k)
+            {
+                const auto row = v_idx * batch_size + k;
+                if (row < hiddenSize)
+                    data[k] = get_value ((size_t) row);
+            }
+            return xsimd::load_aligned (data);
+        };
+
+        for (size_t g = 0; g < num_gates; ++g)
+        {
+            const auto gate_offset = g * (size_t) hiddenSize;
+            for (int v = 0; v < v_hidden_size; ++v)
+            {
+                for (size_t i = 0; i < (size_t) inputSize; ++i)
+                    W[g][i][v] = make_column ([&] (size_t row)
+                                              { return weights_ih (gate_offset + row, i); },
+                                              v);
+
+                for (size_t k = 0; k < (size_t) hiddenSize; ++k)
+                    U[g][k][v] = make_column ([&] (size_t row)
+                                              { return weights_hh (gate_offset + row, k); },
+                                              v);
+
+                b[g][v] = make_column ([&] (size_t row)
+                                       { return bias_ih (gate_offset + row) + bias_hh (gate_offset + row); },
+                                       v);
+            }
+        }
+
+        for (int v = 0; v < v_hidden_size; ++v)
+            dense_weights[v] = make_column ([&] (size_t row)
+                                            { return dense_w (0, row); },
+                                            v);
+        dense_bias = dense_b (0);
+    }
+
+    void prepare (int new_delay_samples, float new_delay_frac)
+    {
+        delay_samples = std::max (1, new_delay_samples);
+        delay_frac = new_delay_frac;
+
+        // one extra state for interpolating, and one for the state currently being computed
+        state_history.resize ((size_t) delay_samples + 2);
+        reset();
+    }
+
+    void reset()
+    {
+        std::fill (state_history.begin(), state_history.end(), State {});
+        interp_state = State {};
+        latest_state_index = 0;
+    }
+
+    const State& get_delayed_state (int num_channels) noexcept
+    {
+        const auto history_size = state_history.size();
+        const auto& state_1 = state_history[(latest_state_index + history_size - (size_t) (delay_samples - 1)) % history_size];
+        if (delay_frac == 0.0f)
+            return state_1;
+
+        const auto& state_2 = state_history[(latest_state_index + history_size - (size_t) delay_samples) % history_size];
+        const auto mult_1 = Batch (1.0f - delay_frac);
+        const auto mult_2 = Batch (delay_frac);
+        for (int ch = 0; ch < num_channels; ++ch)
+        {
+            for (int i = 0; i < padded_hidden_size; i += batch_size)
+            {
+                xsimd::store_aligned (interp_state.h[ch] + i, mult_1 * xsimd::load_aligned (state_1.h[ch] + i) + mult_2 * xsimd::load_aligned (state_2.h[ch] + i));
+                xsimd::store_aligned (interp_state.c[ch] + i, mult_1 * xsimd::load_aligned (state_1.c[ch] + i) + mult_2 * xsimd::load_aligned (state_2.c[ch] + i));
+            }
+        }
+        return interp_state;
+    }
+
+    static inline Batch sigmoid (Batch x) noexcept
+    {
+        return (Batch) 1.0f / ((Batch) 1.0f + xsimd::exp (-x));
+    }
+
+    template <int numChannels>
+    inline void forward (const float (&ins)[numChannels][inputSize], float (&outs)[numChannels]) noexcept
+    {
+        const auto& prev_state = get_delayed_state (numChannels);
+        const auto next_state_index = (latest_state_index + 1) % state_history.size();
+        auto& next_state = state_history[next_state_index];
+
+        // gates = W * x + U * h + b
+        Batch gates[numChannels][num_gates][v_hidden_size];
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            for (int g = 0; g < num_gates; ++g)
+            {
+                for (int v = 0; v < v_hidden_size; ++v)
+                {
+                    gates[ch][g][v] = b[g][v];
+                    for (int i = 0; i < inputSize; ++i)
+                        gates[ch][g][v] = xsimd::fma (W[g][i][v], (Batch) ins[ch][i], gates[ch][g][v]);
+                }
+            }
+        }
+
+        for (int k = 0; k < hiddenSize; ++k)
+        {
+            Batch h_k[numChannels];
+            for (int ch = 0; ch < numChannels; ++ch)
+                h_k[ch] = (Batch) prev_state.h[ch][k];
+
+            for (int g = 0; g < num_gates; ++g)
+            {
+                for (int v = 0; v < v_hidden_size; ++v)
+                {
+                    const auto& u_col = U[g][k][v];
+                    for (int ch = 0; ch < numChannels; ++ch)
+                        gates[ch][g][v] = xsimd::fma (u_col, h_k[ch], gates[ch][g][v]);
+                }
+            }
+        }
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto dense_sum = (Batch) 0.0f;
+            for (int v = 0; v < v_hidden_size; ++v)
+            {
+                const auto i_t = sigmoid (gates[ch][0][v]);
+                const auto f_t = sigmoid (gates[ch][1][v]);
+                const auto g_t = xsimd::tanh (gates[ch][2][v]);
+                const auto o_t = sigmoid (gates[ch][3][v]);
+
+                const auto c_t = xsimd::fma (f_t, xsimd::load_aligned (prev_state.c[ch] + v * batch_size), i_t * g_t);
+                const auto h_t = o_t * xsimd::tanh (c_t);
+                xsimd::store_aligned (next_state.c[ch] + v * batch_size, c_t);
+                xsimd::store_aligned (next_state.h[ch] + v * batch_size, h_t);
+
+                dense_sum = xsimd::fma (dense_weights[v], h_t, dense_sum);
+            }
+            outs[ch] = xsimd::reduce_add (dense_sum) + dense_bias;
+        }
+
+        latest_state_index = next_state_index;
+    }
+
+    template <int numChannels>
+    void process (std::array<float*, (size_t) numChannels> channels, const float* condition, size_t num_samples, bool useResiduals) noexcept
+    {
+        float ins[numChannels][inputSize] {};
+        float outs[numChannels] {};
+        for (size_t n = 0; n < num_samples; ++n)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                ins[ch][0] = channels[(size_t) ch][n];
+                if constexpr (inputSize > 1)
+                    ins[ch][1] = condition != nullptr ? condition[n] : 0.0f;
+            }
+
+            forward<numChannels> (ins, outs);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                channels[(size_t) ch][n] = useResiduals ? channels[(size_t) ch][n] + outs[ch] : outs[ch];
+        }
+    }
+};
+
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+StereoRNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::StereoRNNAccelerated()
+{
+    static_assert (sizeof (Internal) <= max_model_size);
+    internal = new (internal_data) Internal();
+}
+
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+StereoRNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::~StereoRNNAccelerated()
+{
+    internal->~Internal();
+}
+
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+void StereoRNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::initialise (const ModelWeights& weights)
+{
+    internal->load_weights (weights);
+}
+
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+void StereoRNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::prepare ([[maybe_unused]] int rnnDelaySamples)
+{
+    if constexpr (SRCMode == (int) RTNeural::SampleRateCorrectionMode::NoInterp)
+        internal->prepare (rnnDelaySamples, 0.0f);
+}
+
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+void StereoRNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::prepare ([[maybe_unused]] float rnnDelaySamples)
+{
+    if constexpr (SRCMode == (int) RTNeural::SampleRateCorrectionMode::LinInterp)
+    {
+        const auto delayInt = std::floor (rnnDelaySamples);
+        internal->prepare ((int) delayInt, rnnDelaySamples - delayInt);
+    }
+}
+
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+void StereoRNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::reset()
+{
+    internal->reset();
+}
+
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+std::vector<float> StereoRNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::get_state() const
+{
+    // the states are stored from newest to oldest
+    constexpr auto floats_per_state = sizeof (typename Internal::State) / sizeof (float);
+    const auto history_size = internal->state_history.size();
+    std::vector<float> state (history_size * floats_per_state);
+    for (size_t i = 0; i < history_size; ++i)
+    {
+        const auto& history_state = internal->state_history[(internal->latest_state_index + history_size - i) % history_size];
+        std::memcpy (state.data() + i * floats_per_state, &history_state, sizeof (typename Internal::State));
+    }
+    return state;
+}
+
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+void StereoRNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::set_state (const std::vector<float>& state)
+{
+    constexpr auto floats_per_state = sizeof (typename Internal::State) / sizeof (float);
+    const auto history_size = internal->state_history.size();
+    if (state.size() != history_size * floats_per_state)
+    {
+        assert (false); // the model has been prepared with a different delay!
+        return;
+    }
+
+    for (size_t i = 0; i < history_size; ++i)
+        std::memcpy (&internal->state_history[(history_size - i) % history_size], state.data() + i * floats_per_state, sizeof (typename Internal::State));
+    internal->latest_state_index = 0;
+}
+
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+void StereoRNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::process (std::span<float> left, std::span<float> right, bool useResiduals) noexcept
+{
+    assert (inputSize == 1); // conditioned models should use process_conditioned()
+    if (right.empty())
+    {
+        internal->template process<1> ({ left.data() }, nullptr, left.size(), useResiduals);
+        return;
+    }
+
+    assert (left.size() == right.size());
+    internal->template process<2> ({ left.data(), right.data() }, nullptr, left.size(), useResiduals);
+}
+
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+void StereoRNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>::process_conditioned (std::span<float> left, std::span<float> right, std::span<const float> condition, bool useResiduals) noexcept
+{
+    assert (inputSize == 2 && condition.size() == left.size());
+    if (right.empty())
+    {
+        internal->template process<1> ({ left.data() }, condition.data(), left.size(), useResiduals);
+        return;
+    }
+
+    assert (left.size() == right.size());
+    internal->template process<2> ({ left.data(), right.data() }, condition.data(), left.size(), useResiduals);
+}
+
+template class StereoRNNAccelerated<1, 28, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::NoInterp>; // MetalFace
+template class StereoRNNAccelerated<2, 24, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::NoInterp>; // BassFace
+template class StereoRNNAccelerated<1, 40, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::LinInterp>; // GuitarML (no-cond)
+template class StereoRNNAccelerated<2, 40, RecurrentLayerType::LSTMLayer, (int) RTNeural::SampleRateCorrectionMode::LinInterp>; // GuitarML (cond)
 #endif // NEON + AVX
 }
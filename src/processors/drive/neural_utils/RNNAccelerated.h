@@ -1,8 +1,9 @@
 #pragma once
 
+#include "ModelWeights.h"
 #include <memory>
-#include <modules/json/json.hpp>
 #include <span>
+#include <vector>
 
 namespace RecurrentLayerType
 {
@@ -25,7 +26,7 @@ public:
     RNNAccelerated (RNNAccelerated&&) noexcept = delete;
     RNNAccelerated& operator= (RNNAccelerated&&) noexcept = delete;
 
-    void initialise (const nlohmann::json& weights_json);
+    void initialise (const ModelWeights& weights);
 
     void prepare (int rnnDelaySamples);
     void prepare (float rnnDelaySamples);
@@ -34,6 +35,12 @@ public:
     void process (std::span<float> buffer, bool useResiduals = false) noexcept;
     void process_conditioned (std::span<float> buffer, std::span<const float> condition, bool useResiduals = false) noexcept;
 
+    /** Returns a copy of the model's recurrent state (along with the model weights, since RTNeural keeps them together). */
+    std::shared_ptr<const void> get_state() const;
+
+    /** Restores a state returned by get_state(). The model must have been prepared with the same delay. */
+    void set_state (const std::shared_ptr<const void>& state);
+
 private:
     struct Internal;
     Internal* internal = nullptr;
@@ -42,6 +49,48 @@ private:
     static constexpr size_t alignment = 16;
     alignas (alignment) char internal_data[max_model_size] {};
 };
+
+/**
+ * An LSTM model that processes the left and right channels of a stereo
+ * signal together, so that each weight is only loaded once per sample,
+ * and is then applied to the state vectors of both channels.
+ */
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+class StereoRNNAccelerated
+{
+public:
+    StereoRNNAccelerated();
+    ~StereoRNNAccelerated();
+
+    StereoRNNAccelerated (const StereoRNNAccelerated&) = delete;
+    StereoRNNAccelerated& operator= (const StereoRNNAccelerated&) = delete;
+    StereoRNNAccelerated (StereoRNNAccelerated&&) noexcept = delete;
+    StereoRNNAccelerated& operator= (StereoRNNAccelerated&&) noexcept = delete;
+
+    void initialise (const ModelWeights& weights);
+
+    void prepare (int rnnDelaySamples);
+    void prepare (float rnnDelaySamples);
+    void reset();
+
+    /** Processes one or two channels. For mono signals, the right channel should be empty. */
+    void process (std::span<float> left, std::span<float> right, bool useResiduals = false) noexcept;
+    void process_conditioned (std::span<float> left, std::span<float> right, std::span<const float> condition, bool useResiduals = false) noexcept;
+
+    /** Returns a copy of the model's recurrent state. */
+    std::vector<float> get_state() const;
+
+    /** Restores a state returned by get_state(). The model must have been prepared with the same delay. */
+    void set_state (const std::vector<float>& state);
+
+private:
+    struct Internal;
+    Internal* internal = nullptr;
+
+    static constexpr size_t max_model_size = 40000;
+    static constexpr size_t alignment = 16;
+    alignas (alignment) char internal_data[max_model_size] {};
+};
 } // namespace rnn_arm
 #else // intel
 namespace rnn_sse
@@ -58,7 +107,7 @@ public:
     RNNAccelerated (RNNAccelerated&&) noexcept = delete;
     RNNAccelerated& operator= (RNNAccelerated&&) noexcept = delete;
 
-    void initialise (const nlohmann::json& weights_json);
+    void initialise (const ModelWeights& weights);
 
     void prepare (int rnnDelaySamples);
     void prepare (float rnnDelaySamples);
@@ -67,6 +116,12 @@ public:
     void process (std::span<float> buffer, bool useResiduals = false) noexcept;
     void process_conditioned (std::span<float> buffer, std::span<const float> condition, bool useResiduals = false) noexcept;
 
+    /** Returns a copy of the model's recurrent state (along with the model weights, since RTNeural keeps them together). */
+    std::shared_ptr<const void> get_state() const;
+
+    /** Restores a state returned by get_state(). The model must have been prepared with the same delay. */
+    void set_state (const std::shared_ptr<const void>& state);
+
 private:
     struct Internal;
     Internal* internal = nullptr;
@@ -75,6 +130,48 @@ private:
     static constexpr size_t alignment = 16;
     alignas (alignment) char internal_data[max_model_size] {};
 };
+
+/**
+ * An LSTM model that processes the left and right channels of a stereo
+ * signal together, so that each weight is only loaded once per sample,
+ * and is then applied to the state vectors of both channels.
+ */
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+class StereoRNNAccelerated
+{
+public:
+    StereoRNNAccelerated();
+    ~StereoRNNAccelerated();
+
+    StereoRNNAccelerated (const StereoRNNAccelerated&) = delete;
+    StereoRNNAccelerated& operator= (const StereoRNNAccelerated&) = delete;
+    StereoRNNAccelerated (StereoRNNAccelerated&&) noexcept = delete;
+    StereoRNNAccelerated& operator= (StereoRNNAccelerated&&) noexcept = delete;
+
+    void initialise (const ModelWeights& weights);
+
+    void prepare (int rnnDelaySamples);
+    void prepare (float rnnDelaySamples);
+    void reset();
+
+    /** Processes one or two channels. For mono signals, the right channel should be empty. */
+    void process (std::span<float> left, std::span<float> right, bool useResiduals = false) noexcept;
+    void process_conditioned (std::span<float> left, std::span<float> right, std::span<const float> condition, bool useResiduals = false) noexcept;
+
+    /** Returns a copy of the model's recurrent state. */
+    std::vector<float> get_state() const;
+
+    /** Restores a state returned by get_state(). The model must have been prepared with the same delay. */
+    void set_state (const std::vector<float>& state);
+
+private:
+    struct Internal;
+    Internal* internal = nullptr;
+
+    static constexpr size_t max_model_size = 40000;
+    static constexpr size_t alignment = 16;
+    alignas (alignment) char internal_data[max_model_size] {};
+};
 } // namespace rnn_sse
 
 namespace rnn_avx
@@ -91,7 +188,7 @@ public:
     RNNAccelerated (RNNAccelerated&&) noexcept = delete;
     RNNAccelerated& operator= (RNNAccelerated&&) noexcept = delete;
 
-    void initialise (const nlohmann::json& weights_json);
+    void initialise (const ModelWeights& weights);
 
     void prepare (int rnnDelaySamples);
     void prepare (float rnnDelaySamples);
@@ -100,6 +197,54 @@ public:
     void process (std::span<float> buffer, bool useResiduals = false) noexcept;
     void process_conditioned (std::span<float> buffer, std::span<const float> condition, bool useResiduals = false) noexcept;
 
+    /** Returns a copy of the model's recurrent state (along with the model weights, since RTNeural keeps them together). */
+    std::shared_ptr<const void> get_state() const;
+
+    /** Restores a state returned by get_state(). The model must have been prepared with the same delay. */
+    void set_state (const std::shared_ptr<const void>& state);
+
+private:
+    struct Internal;
+    Internal* internal = nullptr;
+
+    static constexpr size_t max_model_size = 40000;
+    static constexpr size_t alignment = 32;
+    alignas (alignment) char internal_data[max_model_size] {};
+};
+
+/**
+ * An LSTM model that processes the left and right channels of a stereo
+ * signal together, so that each weight is only loaded once per sample,
+ * and is then applied to the state vectors of both channels.
+ */
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+class StereoRNNAccelerated
+{
+public:
+    StereoRNNAccelerated();
+    ~StereoRNNAccelerated();
+
+    StereoRNNAccelerated (const StereoRNNAccelerated&) = delete;
+    StereoRNNAccelerated& operator= (const StereoRNNAccelerated&) = delete;
+    StereoRNNAccelerated (StereoRNNAccelerated&&) noexcept = delete;
+    StereoRNNAccelerated& operator= (StereoRNNAccelerated&&) noexcept = delete;
+
+    void initialise (const ModelWeights& weights);
+
+    void prepare (int rnnDelaySamples);
+    void prepare (float rnnDelaySamples);
+    void reset();
+
+    /** Processes one or two channels. For mono signals, the right channel should be empty. */
+    void process (std::span<float> left, std::span<float> right, bool useResiduals = false) noexcept;
+    void process_conditioned (std::span<float> left, std::span<float> right, std::span<const float> condition, bool useResiduals = false) noexcept;
+
+    /** Returns a copy of the model's recurrent state. */
+    std::vector<float> get_state() const;
+
+    /** Restores a state returned by get_state(). The model must have been prepared with the same delay. */
+    void set_state (const std::vector<float>& state);
+
 private:
     struct Internal;
     Internal* internal = nullptr;
@@ -109,4 +254,168 @@ private:
     alignas (alignment) char internal_data[max_model_size] {};
 };
 } // namespace rnn_avx
+
+namespace rnn_avx2
+{
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+class RNNAccelerated
+{
+public:
+    RNNAccelerated();
+    ~RNNAccelerated();
+
+    RNNAccelerated (const RNNAccelerated&) = delete;
+    RNNAccelerated& operator= (const RNNAccelerated&) = delete;
+    RNNAccelerated (RNNAccelerated&&) noexcept = delete;
+    RNNAccelerated& operator= (RNNAccelerated&&) noexcept = delete;
+
+    void initialise (const ModelWeights& weights);
+
+    void prepare (int rnnDelaySamples);
+    void prepare (float rnnDelaySamples);
+    void reset();
+
+    void process (std::span<float> buffer, bool useResiduals = false) noexcept;
+    void process_conditioned (std::span<float> buffer, std::span<const float> condition, bool useResiduals = false) noexcept;
+
+    /** Returns a copy of the model's recurrent state (along with the model weights, since RTNeural keeps them together). */
+    std::shared_ptr<const void> get_state() const;
+
+    /** Restores a state returned by get_state(). The model must have been prepared with the same delay. */
+    void set_state (const std::shared_ptr<const void>& state);
+
+private:
+    struct Internal;
+    Internal* internal = nullptr;
+
+    static constexpr size_t max_model_size = 40000;
+    static constexpr size_t alignment = 32;
+    alignas (alignment) char internal_data[max_model_size] {};
+};
+
+/**
+ * An LSTM model that processes the left and right channels of a stereo
+ * signal together, so that each weight is only loaded once per sample,
+ * and is then applied to the state vectors of both channels.
+ */
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+class StereoRNNAccelerated
+{
+public:
+    StereoRNNAccelerated();
+    ~StereoRNNAccelerated();
+
+    StereoRNNAccelerated (const StereoRNNAccelerated&) = delete;
+    StereoRNNAccelerated& operator= (const StereoRNNAccelerated&) = delete;
+    StereoRNNAccelerated (StereoRNNAccelerated&&) noexcept = delete;
+    StereoRNNAccelerated& operator= (StereoRNNAccelerated&&) noexcept = delete;
+
+    void initialise (const ModelWeights& weights);
+
+    void prepare (int rnnDelaySamples);
+    void prepare (float rnnDelaySamples);
+    void reset();
+
+    /** Processes one or two channels. For mono signals, the right channel should be empty. */
+    void process (std::span<float> left, std::span<float> right, bool useResiduals = false) noexcept;
+    void process_conditioned (std::span<float> left, std::span<float> right, std::span<const float> condition, bool useResiduals = false) noexcept;
+
+    /** Returns a copy of the model's recurrent state. */
+    std::vector<float> get_state() const;
+
+    /** Restores a state returned by get_state(). The model must have been prepared with the same delay. */
+    void set_state (const std::vector<float>& state);
+
+private:
+    struct Internal;
+    Internal* internal = nullptr;
+
+    static constexpr size_t max_model_size = 40000;
+    static constexpr size_t alignment = 32;
+    alignas (alignment) char internal_data[max_model_size] {};
+};
+} // namespace rnn_avx2
+
+#if BYOD_WITH_AVX512 || BYOD_COMPILING_WITH_AVX512
+namespace rnn_avx512
+{
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+class RNNAccelerated
+{
+public:
+    RNNAccelerated();
+    ~RNNAccelerated();
+
+    RNNAccelerated (const RNNAccelerated&) = delete;
+    RNNAccelerated& operator= (const RNNAccelerated&) = delete;
+    RNNAccelerated (RNNAccelerated&&) noexcept = delete;
+    RNNAccelerated& operator= (RNNAccelerated&&) noexcept = delete;
+
+    void initialise (const ModelWeights& weights);
+
+    void prepare (int rnnDelaySamples);
+    void prepare (float rnnDelaySamples);
+    void reset();
+
+    void process (std::span<float> buffer, bool useResiduals = false) noexcept;
+    void process_conditioned (std::span<float> buffer, std::span<const float> condition, bool useResiduals = false) noexcept;
+
+    /** Returns a copy of the model's recurrent state (along with the model weights, since RTNeural keeps them together). */
+    std::shared_ptr<const void> get_state() const;
+
+    /** Restores a state returned by get_state(). The model must have been prepared with the same delay. */
+    void set_state (const std::shared_ptr<const void>& state);
+
+private:
+    struct Internal;
+    Internal* internal = nullptr;
+
+    static constexpr size_t max_model_size = 60000;
+    static constexpr size_t alignment = 64;
+    alignas (alignment) char internal_data[max_model_size] {};
+};
+
+/**
+ * An LSTM model that processes the left and right channels of a stereo
+ * signal together, so that each weight is only loaded once per sample,
+ * and is then applied to the state vectors of both channels.
+ */
+template <int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+class StereoRNNAccelerated
+{
+public:
+    StereoRNNAccelerated();
+    ~StereoRNNAccelerated();
+
+    StereoRNNAccelerated (const StereoRNNAccelerated&) = delete;
+    StereoRNNAccelerated& operator= (const StereoRNNAccelerated&) = delete;
+    StereoRNNAccelerated (StereoRNNAccelerated&&) noexcept = delete;
+    StereoRNNAccelerated& operator= (StereoRNNAccelerated&&) noexcept = delete;
+
+    void initialise (const ModelWeights& weights);
+
+    void prepare (int rnnDelaySamples);
+    void prepare (float rnnDelaySamples);
+    void reset();
+
+    /** Processes one or two channels. For mono signals, the right channel should be empty. */
+    void process (std::span<float> left, std::span<float> right, bool useResiduals = false) noexcept;
+    void process_conditioned (std::span<float> left, std::span<float> right, std::span<const float> condition, bool useResiduals = false) noexcept;
+
+    /** Returns a copy of the model's recurrent state. */
+    std::vector<float> get_state() const;
+
+    /** Restores a state returned by get_state(). The model must have been prepared with the same delay. */
+    void set_state (const std::vector<float>& state);
+
+private:
+    struct Internal;
+    Internal* internal = nullptr;
+
+    static constexpr size_t max_model_size = 60000;
+    static constexpr size_t alignment = 64;
+    alignas (alignment) char internal_data[max_model_size] {};
+};
+} // namespace rnn_avx512
+#endif
 #endif
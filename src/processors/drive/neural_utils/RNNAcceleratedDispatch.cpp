@@ -0,0 +1,65 @@
+#include "RNNAcceleratedDispatch.h"
+
+namespace rnn_dispatch
+{
+bool isSupported (InstructionSet isa)
+{
+    switch (isa)
+    {
+        case InstructionSet::Default:
+            return true;
+#if JUCE_INTEL
+        case InstructionSet::AVX:
+            return SystemStats::hasAVX() && SystemStats::hasFMA3();
+        case InstructionSet::AVX2:
+            return SystemStats::hasAVX2() && SystemStats::hasFMA3();
+#if BYOD_WITH_AVX512
+        case InstructionSet::AVX512:
+            return SystemStats::hasAVX512F() && SystemStats::hasAVX512DQ() && SystemStats::hasAVX512VL() && SystemStats::hasAVX512BW();
+#endif
+#endif
+        default:
+            return false;
+    }
+}
+
+InstructionSet getBestInstructionSet()
+{
+    static const auto bestInstructionSet = []
+    {
+        auto best = InstructionSet::Default;
+        for (auto isa : { InstructionSet::AVX512, InstructionSet::AVX2, InstructionSet::AVX })
+        {
+            if (isSupported (isa))
+            {
+                best = isa;
+                break;
+            }
+        }
+
+        Logger::writeToLog ("Using RNN models with " + getName (best) + " SIMD instructions!");
+        return best;
+    }();
+
+    return bestInstructionSet;
+}
+
+String getName (InstructionSet isa)
+{
+    switch (isa)
+    {
+        case InstructionSet::AVX:
+            return "AVX";
+        case InstructionSet::AVX2:
+            return "AVX2";
+        case InstructionSet::AVX512:
+            return "AVX-512";
+        default:
+#if JUCE_INTEL
+            return "SSE";
+#else
+            return "NEON";
+#endif
+    }
+}
+} // namespace rnn_dispatch
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "RNNAccelerated.h"
+#include <pch.h>
+
+/**
+ * Runtime dispatch for the accelerated RNN models.
+ *
+ * The models are compiled once for each supported instruction set, and
+ * the widest instruction set supported by the CPU is chosen at run-time.
+ */
+namespace rnn_dispatch
+{
+enum class InstructionSet
+{
+    Default, // SSE on Intel, NEON on ARM
+    AVX,
+    AVX2,
+    AVX512,
+};
+
+/** Returns true if the instruction set is supported by this build, and by the current CPU. */
+bool isSupported (InstructionSet isa);
+
+/** Returns the widest instruction set supported by this build and by the current CPU. */
+InstructionSet getBestInstructionSet();
+
+/** Returns a name for the instruction set, e.g. for logging. */
+String getName (InstructionSet isa);
+
+/** The set of models, compiled for each instruction set, for a given model architecture. */
+template <bool isStereo, int inputSize, int hiddenSize, int RecurrentLayerType, int SRCMode>
+struct Models
+{
+#if JUCE_INTEL
+    using SSE = std::conditional_t<isStereo,
+                                   rnn_sse::StereoRNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>,
+                                   rnn_sse::RNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>>;
+    using AVX = std::conditional_t<isStereo,
+                                   rnn_avx::StereoRNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>,
+                                   rnn_avx::RNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>>;
+    using AVX2 = std::conditional_t<isStereo,
+                                    rnn_avx2::StereoRNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>,
+                                    rnn_avx2::RNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>>;
+#if BYOD_WITH_AVX512
+    using AVX512 = std::conditional_t<isStereo,
+                                      rnn_avx512::StereoRNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>,
+                                      rnn_avx512::RNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>>;
+    using Variant = EA::Variant<SSE, AVX, AVX2, AVX512>;
+#else
+    using Variant = EA::Variant<SSE, AVX, AVX2>;
+#endif
+#else
+    using ARM = std::conditional_t<isStereo,
+                                   rnn_arm::StereoRNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>,
+                                   rnn_arm::RNNAccelerated<inputSize, hiddenSize, RecurrentLayerType, SRCMode>>;
+    using Variant = EA::Variant<ARM>;
+#endif
+
+    /** Constructs the model for the given instruction set (which must be supported!). */
+    static void emplace (Variant& variant, [[maybe_unused]] InstructionSet isa = getBestInstructionSet())
+    {
+        jassert (isSupported (isa));
+
+#if JUCE_INTEL
+        switch (isa)
+        {
+#if BYOD_WITH_AVX512
+            case InstructionSet::AVX512:
+                variant.template emplace<AVX512>();
+                return;
+#endif
+            case InstructionSet::AVX2:
+                variant.template emplace<AVX2>();
+                return;
+            case InstructionSet::AVX:
+                variant.template emplace<AVX>();
+                return;
+            default:
+                variant.template emplace<SSE>();
+                return;
+        }
+#else
+        variant.template emplace<ARM>();
+#endif
+    }
+};
+} // namespace rnn_dispatch
@@ -3,14 +3,7 @@
 template <int numIns, int hiddenSize, int RecurrentLayerType>
 ResampledRNNAccelerated<numIns, hiddenSize, RecurrentLayerType>::ResampledRNNAccelerated()
 {
-#if JUCE_INTEL
-    if (juce::SystemStats::hasAVX() && juce::SystemStats::hasFMA3())
-    {
-        juce::Logger::writeToLog ("Using RNN model with AVX SIMD instructions!");
-        model_variant.template emplace<rnn_avx::RNNAccelerated<numIns, hiddenSize, RecurrentLayerType, (int) RTNeural::SampleRateCorrectionMode::NoInterp>>();
-    }
-#endif
-    juce::ignoreUnused (this);
+    Models::emplace (model_variant);
 }
 
 template <int numIns, int hiddenSize, int RecurrentLayerType>
@@ -18,11 +11,9 @@ void ResampledRNNAccelerated<numIns, hiddenSize, RecurrentLayerType>::initialise
 {
     targetSampleRate = modelSampleRate;
 
-    MemoryInputStream jsonInputStream (modelData, (size_t) modelDataSize, false);
-    auto weightsJson = nlohmann::json::parse (jsonInputStream.readEntireStreamAsString().toStdString());
-
-    model_variant.visit ([&weightsJson] (auto& model)
-                         { model.initialise (weightsJson); });
+    modelWeights = SharedAssetCache::getInstance().getModelWeights (SharedAssetCache::getBinaryDataKey (modelData), modelData, (size_t) modelDataSize);
+    model_variant.visit ([&weights = *modelWeights] (auto& model)
+                         { model.initialise (weights); });
 }
 
 template <int numIns, int hiddenSize, int RecurrentLayerType>
@@ -58,6 +49,22 @@ void ResampledRNNAccelerated<numIns, hiddenSize, RecurrentLayerType>::reset()
                          { model.reset(); });
 }
 
+template <int numIns, int hiddenSize, int RecurrentLayerType>
+std::shared_ptr<const void> ResampledRNNAccelerated<numIns, hiddenSize, RecurrentLayerType>::get_state()
+{
+    std::shared_ptr<const void> state;
+    model_variant.visit ([&state] (auto& model)
+                         { state = model.get_state(); });
+    return state;
+}
+
+template <int numIns, int hiddenSize, int RecurrentLayerType>
+void ResampledRNNAccelerated<numIns, hiddenSize, RecurrentLayerType>::set_state (const std::shared_ptr<const void>& state)
+{
+    model_variant.visit ([&state] (auto& model)
+                         { model.set_state (state); });
+}
+
 //=======================================================
 template class ResampledRNNAccelerated<1, 28>; // MetalFace
 template class ResampledRNNAccelerated<2, 24>; // BassFace
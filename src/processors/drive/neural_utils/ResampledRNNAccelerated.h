@@ -1,6 +1,7 @@
 #pragma once
 
-#include "RNNAccelerated.h"
+#include "RNNAcceleratedDispatch.h"
+#include "processors/SharedAssetCache.h"
 #include <pch.h>
 
 template <int numIns, int hiddenSize, int RecurrentLayerType = RecurrentLayerType::LSTMLayer>
@@ -16,6 +17,12 @@ public:
     void prepare (double sampleRate, int samplesPerBlock);
     void reset();
 
+    /** Returns a copy of the model's recurrent state (but not the resampler's state). */
+    std::shared_ptr<const void> get_state();
+
+    /** Restores a state returned by get_state(). The model must have been prepared with the same sample rate. */
+    void set_state (const std::shared_ptr<const void>& state);
+
     template <bool useResiduals = false>
     void process (std::span<float> block, std::span<const float> condition_data = {}) noexcept
     {
@@ -60,13 +67,9 @@ public:
     }
 
 private:
-#if JUCE_INTEL
-    EA::Variant<rnn_sse::RNNAccelerated<numIns, hiddenSize, RecurrentLayerType, (int) RTNeural::SampleRateCorrectionMode::NoInterp>,
-                rnn_avx::RNNAccelerated<numIns, hiddenSize, RecurrentLayerType, (int) RTNeural::SampleRateCorrectionMode::NoInterp>>
-        model_variant;
-#elif JUCE_ARM
-    EA::Variant<rnn_arm::RNNAccelerated<numIns, hiddenSize, RecurrentLayerType, (int) RTNeural::SampleRateCorrectionMode::NoInterp>> model_variant;
-#endif
+    using Models = rnn_dispatch::Models<false, numIns, hiddenSize, RecurrentLayerType, (int) RTNeural::SampleRateCorrectionMode::NoInterp>;
+    typename Models::Variant model_variant;
+    SharedAssetCache::AssetPtr<ModelWeights> modelWeights; // shared with the other instances using the same model
 
     using ResamplerType = chowdsp::ResamplingTypes::LanczosResampler<8192, 8>;
     chowdsp::ResampledProcess<ResamplerType> resampler;
@@ -0,0 +1,54 @@
+#include "ResampledStereoRNNAccelerated.h"
+
+template <int numIns, int hiddenSize, int RecurrentLayerType>
+ResampledStereoRNNAccelerated<numIns, hiddenSize, RecurrentLayerType>::ResampledStereoRNNAccelerated()
+{
+    Models::emplace (model_variant);
+}
+
+template <int numIns, int hiddenSize, int RecurrentLayerType>
+void ResampledStereoRNNAccelerated<numIns, hiddenSize, RecurrentLayerType>::initialise (const void* modelData, int modelDataSize, double modelSampleRate)
+{
+    targetSampleRate = modelSampleRate;
+
+    modelWeights = SharedAssetCache::getInstance().getModelWeights (SharedAssetCache::getBinaryDataKey (modelData), modelData, (size_t) modelDataSize);
+    model_variant.visit ([&weights = *modelWeights] (auto& model)
+                         { model.initialise (weights); });
+}
+
+template <int numIns, int hiddenSize, int RecurrentLayerType>
+void ResampledStereoRNNAccelerated<numIns, hiddenSize, RecurrentLayerType>::prepare (double sampleRate, int samplesPerBlock)
+{
+    const auto [resampleRatio, rnnDelaySamples] = [] (auto curFs, auto targetFs)
+    {
+        if (curFs == targetFs)
+            return std::make_pair (1.0, 1);
+
+        if (curFs > targetFs)
+        {
+            const auto delaySamples = std::ceil (curFs / targetFs);
+            return std::make_pair (delaySamples * targetFs / curFs, (int) delaySamples);
+        }
+
+        // curFs < targetFs
+        return std::make_pair (targetFs / curFs, 1);
+    }(sampleRate, targetSampleRate);
+
+    needsResampling = resampleRatio != 1.0;
+    resampler.prepareWithTargetSampleRate ({ sampleRate, (uint32) samplesPerBlock, 2 }, sampleRate * resampleRatio);
+
+    model_variant.visit ([delaySamples = rnnDelaySamples] (auto& model)
+                         { model.prepare (delaySamples); });
+}
+
+template <int numIns, int hiddenSize, int RecurrentLayerType>
+void ResampledStereoRNNAccelerated<numIns, hiddenSize, RecurrentLayerType>::reset()
+{
+    resampler.reset();
+    model_variant.visit ([] (auto& model)
+                         { model.reset(); });
+}
+
+//=======================================================
+template class ResampledStereoRNNAccelerated<1, 28>; // MetalFace
+template class ResampledStereoRNNAccelerated<2, 24>; // BassFace
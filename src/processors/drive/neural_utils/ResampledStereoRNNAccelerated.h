@@ -0,0 +1,71 @@
+#pragma once
+
+#include "RNNAcceleratedDispatch.h"
+#include "processors/SharedAssetCache.h"
+#include <pch.h>
+
+/**
+ * Same as ResampledRNNAccelerated, except that both channels
+ * of a stereo signal are processed by a single model.
+ */
+template <int numIns, int hiddenSize, int RecurrentLayerType = RecurrentLayerType::LSTMLayer>
+class ResampledStereoRNNAccelerated
+{
+public:
+    ResampledStereoRNNAccelerated();
+
+    void initialise (const void* modelData, int modelDataSize, double modelSampleRate);
+
+    void prepare (double sampleRate, int samplesPerBlock);
+    void reset();
+
+    template <bool useResiduals = false>
+    void process (const chowdsp::BufferView<float>& buffer, std::span<const float> condition_data = {}) noexcept
+    {
+        jassert (buffer.getNumChannels() <= 2);
+
+        auto processNNInternal = [this, &condition_data] (const chowdsp::BufferView<float>& data)
+        {
+            const auto left = data.getWriteSpan (0);
+            const auto right = data.getNumChannels() > 1 ? data.getWriteSpan (1) : std::span<float> {};
+            model_variant.visit (
+                [&left, &right, &condition_data] (auto& model)
+                {
+                    if constexpr (numIns == 1)
+                    {
+                        jassert (condition_data.empty());
+                        juce::ignoreUnused (condition_data);
+                        model.process (left, right, useResiduals);
+                    }
+                    else
+                    {
+                        jassert (condition_data.size() == left.size());
+                        model.process_conditioned (left, right, condition_data, useResiduals);
+                    }
+                });
+        };
+
+        if (! needsResampling)
+        {
+            processNNInternal (buffer);
+        }
+        else
+        {
+            auto blockAtSampleRate = resampler.processIn (buffer);
+            processNNInternal (blockAtSampleRate);
+            resampler.processOut (blockAtSampleRate, buffer);
+        }
+    }
+
+private:
+    using Models = rnn_dispatch::Models<true, numIns, hiddenSize, RecurrentLayerType, (int) RTNeural::SampleRateCorrectionMode::NoInterp>;
+    typename Models::Variant model_variant;
+    SharedAssetCache::AssetPtr<ModelWeights> modelWeights; // shared with the other instances using the same model
+
+    using ResamplerType = chowdsp::ResamplingTypes::LanczosResampler<8192, 8>;
+    chowdsp::ResampledProcess<ResamplerType> resampler;
+    bool needsResampling = true;
+    double targetSampleRate = 48000.0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ResampledStereoRNNAccelerated)
+};
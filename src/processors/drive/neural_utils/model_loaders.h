@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ModelWeights.h"
+
 namespace model_loaders
 {
 using Vec2d = std::vector<std::vector<float>>;
@@ -18,27 +20,30 @@ inline Vec2d transpose (const Vec2d& x)
     return std::move (y);
 }
 
-template <typename ModelType>
-void loadLSTMModel (ModelType& model, const nlohmann::json& weights_json)
+/** Loads a PyTorch-style LSTM model (an LSTM layer followed by a dense layer), in the same way as RTNeural::torch_helpers */
+template <int inputSize, int hiddenSize, typename ModelType>
+void loadLSTMModel (ModelType& model, const ModelWeights& weights)
 {
-    const auto& state_dict = weights_json.at ("state_dict");
-    RTNeural::torch_helpers::loadLSTM<float> (state_dict, "rec.", model.template get<0>());
-    RTNeural::torch_helpers::loadDense<float> (state_dict, "lin.", model.template get<1>());
-}
+    constexpr auto numGates = size_t (4 * hiddenSize);
+    const auto& weightsIH = weights.getTensor ("/state_dict/rec.weight_ih_l0", { numGates, (size_t) inputSize });
+    const auto& weightsHH = weights.getTensor ("/state_dict/rec.weight_hh_l0", { numGates, (size_t) hiddenSize });
+    const auto& biasIH = weights.getTensor ("/state_dict/rec.bias_ih_l0", { numGates });
+    const auto& biasHH = weights.getTensor ("/state_dict/rec.bias_hh_l0", { numGates });
+    const auto& denseWeights = weights.getTensor ("/state_dict/lin.weight", { 1, (size_t) hiddenSize });
+    const auto& denseBias = weights.getTensor ("/state_dict/lin.bias", { 1 });
 
-template <typename ModelType>
-void loadGRUModel (ModelType& model, const nlohmann::json& weights_json)
-{
-    auto json_layers = weights_json["layers"];
-    const auto gru_layer_json = json_layers.at (0);
-    const auto dense_layer_json = json_layers.at (1);
+    auto& lstm = model.template get<0>();
+    lstm.setWVals (transpose (weightsIH.toVector2D()));
+    lstm.setUVals (transpose (weightsHH.toVector2D()));
 
-    auto& gru = model.template get<0>();
-    auto& dense = model.template get<1>();
+    // PyTorch has separate input and recurrent biases, but they can be combined
+    auto bias = biasHH.toVector();
+    for (size_t i = 0; i < bias.size(); ++i)
+        bias[i] += biasIH (i);
+    lstm.setBVals (bias);
 
-    int layer_idx = 0;
-    const auto& gru_weights = gru_layer_json["weights"];
-    RTNeural::json_parser::loadGRU<float> (gru, gru_weights);
-    RTNeural::modelt_detail::loadLayer<float> (dense, layer_idx, dense_layer_json, "dense", 1, false);
+    auto& dense = model.template get<1>();
+    dense.setWeights (denseWeights.toVector2D());
+    dense.setBias (denseBias.data);
 }
 } // namespace model_loaders
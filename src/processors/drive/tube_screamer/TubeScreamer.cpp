@@ -23,8 +23,7 @@ TubeScreamer::TubeScreamer (UndoManager* um)
         "R4",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.R4_ser_C3.setResistanceValue (self.value.load());
+            wdf.R4_ser_C3.setResistanceValue (self.value.load());
         },
         100.0f,
         25.0e3f);
@@ -32,16 +31,14 @@ TubeScreamer::TubeScreamer (UndoManager* um)
                                            "R5",
                                            [this] (const netlist::CircuitQuantity& self)
                                            {
-                                               for (auto& wdfModel : wdf)
-                                                   wdfModel.R5.setResistanceValue (self.value.load());
+                                               wdf.R5.setResistanceValue (self.value.load());
                                            });
     netlistCircuitQuantities->addCapacitor (
         1.0e-6f,
         "C2",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.Vin_C2.setCapacitanceValue (self.value.load());
+            wdf.Vin_C2.setCapacitanceValue (self.value.load());
         },
         100.0e-12f);
     netlistCircuitQuantities->addCapacitor (
@@ -49,16 +46,14 @@ TubeScreamer::TubeScreamer (UndoManager* um)
         "C3",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdf)
-                wdfModel.R4_ser_C3.setCapacitanceValue (self.value.load());
+            wdf.R4_ser_C3.setCapacitanceValue (self.value.load());
         },
         1.0e-9f);
     netlistCircuitQuantities->addCapacitor (51.0e-12f,
                                             "C4",
                                             [this] (const netlist::CircuitQuantity& self)
                                             {
-                                                for (auto& wdfModel : wdf)
-                                                    wdfModel.R6_P1_par_C4.setCapacitanceValue (self.value.load());
+                                                wdf.R6_P1_par_C4.setCapacitanceValue (self.value.load());
                                             });
 }
 
@@ -78,11 +73,8 @@ void TubeScreamer::prepare (double sampleRate, int samplesPerBlock)
 {
     int diodeType = static_cast<int> (*diodeTypeParam);
     auto gainParamSkew = ParameterHelpers::logPot (*gainParam);
-    for (auto& wdfProc : wdf)
-    {
-        wdfProc.prepare (sampleRate);
-        wdfProc.setParameters (gainParamSkew, DiodeParameter::getDiodeIs (diodeType), *nDiodesParam, true);
-    }
+    wdf.prepare (sampleRate);
+    wdf.setParameters (gainParamSkew, DiodeParameter::getDiodeIs (diodeType), *nDiodesParam, true);
 
     dcBlocker.prepare (sampleRate, samplesPerBlock);
 
@@ -101,11 +93,8 @@ void TubeScreamer::processAudio (AudioBuffer<float>& buffer)
 
     int diodeType = static_cast<int> (*diodeTypeParam);
     auto gainParamSkew = ParameterHelpers::logPot (*gainParam);
-    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
-    {
-        wdf[ch].setParameters (gainParamSkew, DiodeParameter::getDiodeIs (diodeType), *nDiodesParam);
-        wdf[ch].process (buffer.getWritePointer (ch), buffer.getNumSamples());
-    }
+    wdf.setParameters (gainParamSkew, DiodeParameter::getDiodeIs (diodeType), *nDiodesParam);
+    wdf.process (buffer);
 
     dcBlocker.processAudio (buffer);
 
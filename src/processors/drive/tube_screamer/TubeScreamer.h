@@ -10,6 +10,7 @@ public:
     explicit TubeScreamer (UndoManager* um = nullptr);
 
     ProcessorType getProcessorType() const override { return Drive; }
+    double getTailLengthSeconds() const override { return 0.0; }
     static ParamLayout createParameterLayout();
 
     void prepare (double sampleRate, int samplesPerBlock) override;
@@ -20,7 +21,7 @@ private:
     std::atomic<float>* diodeTypeParam = nullptr;
     chowdsp::FloatParameter* nDiodesParam = nullptr;
 
-    TubeScreamerWDF wdf[2];
+    TubeScreamerWDF<wdf_simd::Batch> wdf;
     DCBlocker dcBlocker;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (TubeScreamer)
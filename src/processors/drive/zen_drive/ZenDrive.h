@@ -10,6 +10,7 @@ public:
     explicit ZenDrive (UndoManager* um = nullptr);
 
     ProcessorType getProcessorType() const override { return Drive; }
+    double getTailLengthSeconds() const override { return 0.0; }
     static ParamLayout createParameterLayout();
 
     void prepare (double sampleRate, int samplesPerBlock) override;
@@ -19,7 +20,7 @@ private:
     chowdsp::FloatParameter* voiceParam = nullptr;
     chowdsp::FloatParameter* gainParam = nullptr;
 
-    ZenDriveWDF wdf[2];
+    ZenDriveWDF<wdf_simd::Batch> wdf;
     DCBlocker dcBlocker;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ZenDrive)
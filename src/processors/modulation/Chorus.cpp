@@ -65,17 +65,32 @@ ParamLayout Chorus::createParameterLayout()
     return { params.begin(), params.end() };
 }
 
+double Chorus::getTailLengthSeconds() const
+{
+    // Each trip around the feedback loop is quieter than the last by (at most) the feedback gain
+    // of the clean delay, so we need enough trips through the longest delay for the feedback to
+    // decay below the silence threshold. (The chorus has modulation ports, so it never actually
+    // goes to sleep, but this is still its tail.)
+    const auto feedbackGain = 0.5 * std::sqrt ((double) fbParam->getCurrentValue());
+    const auto numRepeats = feedbackGain > 0.0 ? std::ceil (std::log ((double) Decibels::decibelsToGain (silenceThresholdDB)) / std::log (feedbackGain)) : 0.0;
+    const auto maxDelaySeconds = 1.95 * 0.001 * (double) (delay1Ms + delay2Ms) * (double) depthParam->getCurrentValue();
+    return (numRepeats + 1.0) * maxDelaySeconds;
+}
+
 void Chorus::prepare (double sampleRate, int samplesPerBlock)
 {
     dsp::ProcessSpec spec { sampleRate, (uint32) samplesPerBlock, 2 };
     dsp::ProcessSpec monoSpec { sampleRate, (uint32) samplesPerBlock, 1 };
     fs = (float) sampleRate;
 
+    // longest delay we can get with full depth, at the peaks of both LFOs
+    const auto maxDelaySamples = (int) std::ceil (1.95f * (delay1Ms + delay2Ms) * 0.001f * fs);
+
+    cleanDelay.prepare (sampleRate, numDelayLanes, maxDelaySamples);
     for (int ch = 0; ch < 2; ++ch)
     {
         for (int i = 0; i < delaysPerChannel; ++i)
         {
-            cleanDelay[ch][i].prepare (monoSpec);
             lofiDelay[ch][i].prepare (monoSpec);
 
             slowLFOs[ch][i].prepare (monoSpec);
@@ -88,9 +103,9 @@ void Chorus::prepare (double sampleRate, int samplesPerBlock)
         slowSmooth[ch].reset (sampleRate, 0.05);
         fastSmooth[ch].reset (sampleRate, 0.05);
 
-        feedbackState[ch] = 0.0f;
         fbSmooth[ch].reset (sampleRate, 0.01);
     }
+    feedbackState = Vec (0.0f);
 
     // set phase offsets
     constexpr float piOver3 = MathConstants<float>::pi / 3.0f;
@@ -99,13 +114,13 @@ void Chorus::prepare (double sampleRate, int samplesPerBlock)
     slowLFOs[1][1].reset (piOver3);
     fastLFOs[1][1].reset (piOver3);
 
-    aaFilter.prepare (spec);
+    aaFilter.prepare (monoSpec);
     aaFilter.setCutoffFrequency (12000.0f);
 
     dryWetMixer.prepare (spec);
     dryWetMixer.setMixingRule (dsp::DryWetMixingRule::sin3dB);
 
-    dcBlocker.prepare (spec);
+    dcBlocker.prepare (monoSpec);
     dcBlocker.setCutoffFrequency (60.0f);
 
     audioOutBuffer.setSize (2, samplesPerBlock);
@@ -190,51 +205,96 @@ void Chorus::processModulation (int numSamples)
     }
 }
 
-template <typename DelayArrType>
-void Chorus::processChorus (AudioBuffer<float>& buffer, DelayArrType& delay)
+template <typename DelayType>
+void Chorus::processChorus (AudioBuffer<float>& buffer, DelayType& delay)
 {
     jassert (buffer.getNumChannels() == 2); // always processing in stereo
     const auto numSamples = buffer.getNumSamples();
 
-    for (int ch = 0; ch < 2; ++ch)
+    auto fbAmount = std::sqrt (fbParam->getCurrentValue());
+    if constexpr (std::is_same_v<DelayType, CleanDelayType>)
     {
-        for (int i = 0; i < delaysPerChannel; ++i)
-            delay[ch][i].setFilterFreq (10000.0f);
-
-        auto fbAmount = std::sqrt (fbParam->getCurrentValue());
-        if constexpr (std::is_same_v<DelayArrType, decltype (lofiDelay)>)
-            fbAmount *= 0.4f;
-        else
-            fbAmount *= 0.5f;
+        delay.setFilterFreq (10000.0f);
+        fbAmount *= 0.5f;
+    }
+    else
+    {
+        for (auto& delaySet : delay)
+            for (auto& laneDelay : delaySet)
+                laneDelay.setFilterFreq (10000.0f);
+        fbAmount *= 0.4f;
+    }
 
+    for (int ch = 0; ch < 2; ++ch)
+    {
         fbSmooth[ch].setTargetValue (fbAmount);
         slowSmooth[ch].setTargetValue (delay1Ms * 0.001f * fs * *depthParam);
         fastSmooth[ch].setTargetValue (delay2Ms * 0.001f * fs * *depthParam);
+    }
 
-        auto* x = buffer.getWritePointer (ch);
-        for (int n = 0; n < numSamples; ++n)
+    float* x[2] = { buffer.getWritePointer (0), buffer.getWritePointer (1) };
+    alignas (Vec::arch_type::alignment()) float laneData[Vec::size] {};
+    alignas (Vec::arch_type::alignment()) float laneDelayData[Vec::size] {};
+    alignas (Vec::arch_type::alignment()) float laneFeedbackData[Vec::size] {};
+    for (int n = 0; n < numSamples; ++n)
+    {
+        float slowSmoothMult[2], fastSmoothMult[2], fbGain[2];
+        for (int ch = 0; ch < 2; ++ch)
         {
-            auto xIn = std::tanh (x[n] * 0.75f - feedbackState[ch]);
+            slowSmoothMult[ch] = slowSmooth[ch].getNextValue();
+            fastSmoothMult[ch] = fastSmooth[ch].getNextValue();
+            fbGain[ch] = fbSmooth[ch].getNextValue();
+        }
 
-            auto slowSmoothMult = slowSmooth[ch].getNextValue();
-            auto fastSmoothMult = fastSmooth[ch].getNextValue();
+        for (int lane = 0; lane < (int) Vec::size; ++lane)
+        {
+            const auto ch = lane % 2;
+            laneData[lane] = x[ch][n];
+            laneFeedbackData[lane] = fbGain[ch];
 
-            x[n] = 0.0f;
-            for (int i = 0; i < delaysPerChannel; ++i)
+            if (lane < numDelayLanes)
             {
-                float delayAmt = slowSmoothMult * (1.0f + 0.95f * slowLFOData[ch][i][(size_t) n]);
-                delayAmt += fastSmoothMult * (1.0f + 0.95f * fastLFOData[ch][i][(size_t) n]);
-
-                delay[ch][i].setDelay (delayAmt);
-                delay[ch][i].pushSample (0, xIn);
-                x[n] += delay[ch][i].popSample (0);
+                const auto i = lane / 2;
+                laneDelayData[lane] = slowSmoothMult[ch] * (1.0f + 0.95f * slowLFOData[ch][i][(size_t) n]);
+                laneDelayData[lane] += fastSmoothMult[ch] * (1.0f + 0.95f * fastLFOData[ch][i][(size_t) n]);
             }
+        }
 
-            x[n] = aaFilter.processSample (ch, x[n]);
+        const auto xIn = xsimd::tanh (xsimd::load_aligned (laneData) * 0.75f - feedbackState);
 
-            feedbackState[ch] = fbSmooth[ch].getNextValue() * x[n];
-            feedbackState[ch] = dcBlocker.processSample (ch, feedbackState[ch]);
+        Vec delayOut;
+        if constexpr (std::is_same_v<DelayType, CleanDelayType>)
+        {
+            delayOut = delay.processSample (xIn, xsimd::load_aligned (laneDelayData));
         }
+        else
+        {
+            // the BBD delay lines can't be vectorised, so they're processed one lane at a time
+            xIn.store_aligned (laneData);
+            for (int lane = 0; lane < numDelayLanes; ++lane)
+            {
+                auto& laneDelay = delay[(size_t) lane % 2][(size_t) lane / 2];
+                laneDelay.setDelay (laneDelayData[lane]);
+                laneDelay.pushSample (0, laneData[lane]);
+                laneData[lane] = laneDelay.popSample (0);
+            }
+            delayOut = xsimd::load_aligned (laneData);
+        }
+
+        // sum the delay lines for each channel
+        delayOut.store_aligned (laneData);
+        float y[2] { 0.0f, 0.0f };
+        for (int lane = 0; lane < numDelayLanes; ++lane)
+            y[lane % 2] += laneData[lane];
+        for (int lane = 0; lane < (int) Vec::size; ++lane)
+            laneData[lane] = y[lane % 2];
+
+        const auto yVec = aaFilter.processSample (0, xsimd::load_aligned (laneData));
+        yVec.store_aligned (laneData);
+        x[0][n] = laneData[0];
+        x[1][n] = laneData[1];
+
+        feedbackState = dcBlocker.processSample (0, xsimd::load_aligned (laneFeedbackData) * yVec);
     }
 }
 
@@ -261,9 +321,7 @@ void Chorus::processAudio (AudioBuffer<float>& buffer)
         const auto delayTypeIndex = (int) *delayTypeParam;
         if (delayTypeIndex != prevDelayTypeIndex)
         {
-            for (auto& delaySet : cleanDelay)
-                for (auto& delay : delaySet)
-                    delay.reset();
+            cleanDelay.reset();
 
             for (auto& delaySet : lofiDelay)
                 for (auto& delay : delaySet)
@@ -295,9 +353,7 @@ void Chorus::processAudioBypassed (AudioBuffer<float>& buffer)
 {
     if (bypassNeedsReset)
     {
-        for (auto& delaySet : cleanDelay)
-            for (auto& delay : delaySet)
-                delay.reset();
+        cleanDelay.reset();
 
         for (auto& delaySet : lofiDelay)
             for (auto& delay : delaySet)
@@ -9,6 +9,7 @@ public:
     explicit Chorus (UndoManager* um = nullptr);
 
     ProcessorType getProcessorType() const override { return Modulation; }
+    double getTailLengthSeconds() const override;
     static ParamLayout createParameterLayout();
 
     void prepare (double sampleRate, int samplesPerBlock) override;
@@ -31,8 +32,8 @@ public:
     static constexpr auto numOutputs = (int) magic_enum::enum_count<OutputPort>();
 
 private:
-    template <typename DelayArrType>
-    void processChorus (AudioBuffer<float>& buffer, DelayArrType& delay);
+    template <typename DelayType>
+    void processChorus (AudioBuffer<float>& buffer, DelayType& delay);
     void processModulation (int numSamples);
 
     chowdsp::FloatParameter* rateParam = nullptr;
@@ -55,19 +56,24 @@ private:
     std::vector<float> fastLFOData[2][delaysPerChannel];
     chowdsp::HilbertFilter<float> hilbertFilter[2];
 
+    // Both channels are processed at once, with SIMD lane (2 * i + ch) running delay line i for channel ch
+    using Vec = CleanDelayType::Vec;
+    static constexpr int numDelayLanes = 2 * delaysPerChannel;
+    static_assert (numDelayLanes <= (int) Vec::size);
+
     template <typename DelayType>
     using DelaySet = std::array<std::array<DelayType, delaysPerChannel>, 2>;
-    DelaySet<CleanDelayType> cleanDelay;
+    CleanDelayType cleanDelay;
 
     using LofiDelayType = chowdsp::BBD::BBDDelayWrapper<1024>;
     DelaySet<LofiDelayType> lofiDelay;
     int prevDelayTypeIndex = 0;
 
-    chowdsp::SVFLowpass<float> aaFilter;
+    chowdsp::SVFLowpass<Vec> aaFilter;
 
-    float feedbackState[2] { 0.0f, 0.0f };
+    Vec feedbackState { 0.0f };
     SmoothedValue<float, ValueSmoothingTypes::Linear> fbSmooth[2];
-    chowdsp::SVFHighpass<float> dcBlocker;
+    chowdsp::SVFHighpass<Vec> dcBlocker;
 
     float fs = 48000.0f;
     AudioBuffer<float> audioOutBuffer;
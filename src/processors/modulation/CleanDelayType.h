@@ -1,15 +1,20 @@
 #pragma once
 
+#include "processors/BlockDelayLine.h"
+
 /*
- This class wraps chowdsp::DelayLine so it has an equivalent
- interface to chowdsp::BBBDelayWrapper
+ This class runs all of the clean delay lines for a
+ modulation effect at once, with each delay line
+ (and its lowpass filter) in its own SIMD lane.
  */
 struct CleanDelayType
 {
-    void prepare (const dsp::ProcessSpec& spec)
+    using Vec = BlockDelayLine::Vec;
+
+    void prepare (double sampleRate, int numDelayLines, int maxDelaySamples)
     {
-        lpf.prepare (spec);
-        delay.prepare (spec);
+        lpf.prepare ({ sampleRate, (uint32) 256, 1 });
+        delay.prepare (numDelayLines, maxDelaySamples);
     }
 
     void reset()
@@ -18,12 +23,13 @@ struct CleanDelayType
         delay.reset();
     }
 
-    void setDelay (float newDelayInSamples) { delay.setDelay (newDelayInSamples); }
     void setFilterFreq (float freqHz) { lpf.setCutoffFrequency (freqHz); }
 
-    inline void pushSample (int channel, float sample) { delay.pushSample (channel, sample); }
-    inline float popSample (int channel) { return lpf.processSample (channel, delay.popSample (channel)); }
+    inline Vec processSample (const Vec& x, const Vec& delaySamples) noexcept
+    {
+        return lpf.processSample (0, delay.processLanes (x, delaySamples));
+    }
 
-    chowdsp::SVFLowpass<float> lpf;
-    chowdsp::DelayLine<float, chowdsp::DelayLineInterpolationTypes::Lagrange5th> delay { 1 << 18 };
+    chowdsp::SVFLowpass<Vec> lpf;
+    BlockDelayLine delay;
 };
@@ -69,17 +69,33 @@ ParamLayout Flanger::createParameterLayout()
     return { params.begin(), params.end() };
 }
 
+double Flanger::getTailLengthSeconds() const
+{
+    // Each trip around the feedback loop is quieter than the last by (at most) the feedback gain
+    // of the clean delay, so we need enough trips through the longest delay for the feedback to
+    // decay below the silence threshold. (The flanger has modulation ports, so it never actually
+    // goes to sleep, but this is still its tail.)
+    const auto feedbackGain = 0.5 * std::sqrt ((double) fbParam->getCurrentValue());
+    const auto numRepeats = feedbackGain > 0.0 ? std::ceil (std::log ((double) Decibels::decibelsToGain (silenceThresholdDB)) / std::log (feedbackGain)) : 0.0;
+    const auto maxDelaySeconds = (double) delayMs * ((double) delayAmountParam->getCurrentValue() + 0.975 * (double) delayOffsetParam->getCurrentValue());
+    return (numRepeats + 1.0) * maxDelaySeconds;
+}
+
 void Flanger::prepare (double sampleRate, int samplesPerBlock)
 {
     dsp::ProcessSpec spec { sampleRate, (uint32) samplesPerBlock, 2 };
     dsp::ProcessSpec monoSpec { sampleRate, (uint32) samplesPerBlock, 1 };
     fs = (float) sampleRate;
 
+    // longest delay we can get with the maximum amount and offset, at the peak of the LFO
+    const auto maxDelayMs = delayAmountParam->getNormalisableRange().end + 0.975f * delayOffsetParam->getNormalisableRange().end;
+    const auto maxDelaySamples = (int) std::ceil (delayMs * fs * maxDelayMs);
+
+    cleanDelay.prepare (sampleRate, numDelayLanes, maxDelaySamples);
     for (int ch = 0; ch < 2; ++ch)
     {
         for (int i = 0; i < delaysPerChannel; ++i)
         {
-            cleanDelay[ch][i].prepare (monoSpec);
             lofiDelay[ch][i].prepare (monoSpec);
 
             LFOs[ch][i].prepare (monoSpec);
@@ -88,24 +104,24 @@ void Flanger::prepare (double sampleRate, int samplesPerBlock)
 
         smooth[ch].reset (sampleRate, 0.05);
 
-        feedbackState[ch] = 0.0f;
         fbSmooth[ch].reset (sampleRate, 0.01);
 
         delaySmoothSamples[ch].reset (sampleRate, 0.01);
         delayOffsetSmoothSamples[ch].reset (sampleRate, 0.01);
     }
+    feedbackState = Vec (0.0f);
 
     // set phase offset
     constexpr float piOver2 = MathConstants<float>::pi / 2.0f;
     LFOs[1][0].reset (piOver2);
 
-    aaFilter.prepare (spec);
+    aaFilter.prepare (monoSpec);
     aaFilter.setCutoffFrequency (12000.0f);
 
     dryWetMixer.prepare (spec);
     dryWetMixer.setMixingRule (dsp::DryWetMixingRule::sin3dB);
 
-    dcBlocker.prepare (spec);
+    dcBlocker.prepare (monoSpec);
     dcBlocker.setCutoffFrequency (60.0f);
 
     audioOutBuffer.setSize (2, samplesPerBlock);
@@ -164,51 +180,92 @@ void Flanger::processModulation (int numSamples)
     }
 }
 
-template <typename DelayArrType>
-void Flanger::processFlanger (AudioBuffer<float>& buffer, DelayArrType& delay)
+template <typename DelayType>
+void Flanger::processFlanger (AudioBuffer<float>& buffer, DelayType& delay)
 {
     jassert (buffer.getNumChannels() == 2); // always processing in stereo
     const auto numSamples = buffer.getNumSamples();
 
-    for (int ch = 0; ch < 2; ++ch)
+    auto fbAmount = std::sqrt (fbParam->getCurrentValue());
+    if constexpr (std::is_same_v<DelayType, CleanDelayType>)
     {
-        for (int i = 0; i < delaysPerChannel; ++i)
-            delay[ch][i].setFilterFreq (10000.0f);
-
-        auto fbAmount = std::sqrt (fbParam->getCurrentValue());
-        if constexpr (std::is_same_v<DelayArrType, decltype (lofiDelay)>)
-            fbAmount *= 0.4f;
-        else
-            fbAmount *= 0.5f;
+        delay.setFilterFreq (10000.0f);
+        fbAmount *= 0.5f;
+    }
+    else
+    {
+        for (auto& delaySet : delay)
+            for (auto& laneDelay : delaySet)
+                laneDelay.setFilterFreq (10000.0f);
+        fbAmount *= 0.4f;
+    }
 
+    for (int ch = 0; ch < 2; ++ch)
+    {
         fbSmooth[ch].setTargetValue (fbAmount);
-
         delaySmoothSamples[ch].setTargetValue (delayMs * fs * delayAmountParam->getCurrentValue());
         delayOffsetSmoothSamples[ch].setTargetValue (delayMs * fs * delayOffsetParam->getCurrentValue());
+    }
+
+    float* x[2] = { buffer.getWritePointer (0), buffer.getWritePointer (1) };
+    alignas (Vec::arch_type::alignment()) float laneData[Vec::size] {};
+    alignas (Vec::arch_type::alignment()) float laneDelayData[Vec::size] {};
+    alignas (Vec::arch_type::alignment()) float laneFeedbackData[Vec::size] {};
+    for (int n = 0; n < numSamples; ++n)
+    {
+        float delayValue[2], delayOffsetValue[2], fbGain[2];
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            delayValue[ch] = delaySmoothSamples[ch].getNextValue();
+            delayOffsetValue[ch] = delayOffsetSmoothSamples[ch].getNextValue();
+            fbGain[ch] = fbSmooth[ch].getNextValue();
+        }
 
-        auto* x = buffer.getWritePointer (ch);
-        for (int n = 0; n < numSamples; ++n)
+        for (int lane = 0; lane < (int) Vec::size; ++lane)
         {
-            auto xIn = std::tanh (x[n] * 0.75f - feedbackState[ch]);
+            const auto ch = lane % 2;
+            laneData[lane] = x[ch][n];
+            laneFeedbackData[lane] = fbGain[ch];
 
-            auto delayValue = delaySmoothSamples[ch].getNextValue();
-            auto delayOffsetValue = delayOffsetSmoothSamples[ch].getNextValue();
+            if (lane < numDelayLanes)
+                laneDelayData[lane] = delayValue[ch] + delayOffsetValue[ch] * 0.5f * (1.0f + 0.95f * LFOData[ch][lane / 2][(size_t) n]);
+        }
 
-            x[n] = 0.0f;
-            for (int i = 0; i < delaysPerChannel; ++i)
-            {
-                float delayAmt = delayValue + delayOffsetValue * 0.5f * (1.0f + 0.95f * LFOData[ch][i][(size_t) n]);
+        const auto xIn = xsimd::tanh (xsimd::load_aligned (laneData) * 0.75f - feedbackState);
 
-                delay[ch][i].setDelay (delayAmt);
-                delay[ch][i].pushSample (0, xIn);
-                x[n] += delay[ch][i].popSample (0);
+        Vec delayOut;
+        if constexpr (std::is_same_v<DelayType, CleanDelayType>)
+        {
+            delayOut = delay.processSample (xIn, xsimd::load_aligned (laneDelayData));
+        }
+        else
+        {
+            // the BBD delay lines can't be vectorised, so they're processed one lane at a time
+            xIn.store_aligned (laneData);
+            for (int lane = 0; lane < numDelayLanes; ++lane)
+            {
+                auto& laneDelay = delay[(size_t) lane % 2][(size_t) lane / 2];
+                laneDelay.setDelay (laneDelayData[lane]);
+                laneDelay.pushSample (0, laneData[lane]);
+                laneData[lane] = laneDelay.popSample (0);
             }
+            delayOut = xsimd::load_aligned (laneData);
+        }
 
-            x[n] = aaFilter.processSample (ch, x[n]);
+        // sum the delay lines for each channel
+        delayOut.store_aligned (laneData);
+        float y[2] { 0.0f, 0.0f };
+        for (int lane = 0; lane < numDelayLanes; ++lane)
+            y[lane % 2] += laneData[lane];
+        for (int lane = 0; lane < (int) Vec::size; ++lane)
+            laneData[lane] = y[lane % 2];
 
-            feedbackState[ch] = fbSmooth[ch].getNextValue() * x[n];
-            feedbackState[ch] = dcBlocker.processSample (ch, feedbackState[ch]);
-        }
+        const auto yVec = aaFilter.processSample (0, xsimd::load_aligned (laneData));
+        yVec.store_aligned (laneData);
+        x[0][n] = laneData[0];
+        x[1][n] = laneData[1];
+
+        feedbackState = dcBlocker.processSample (0, xsimd::load_aligned (laneFeedbackData) * yVec);
     }
 }
 
@@ -235,9 +292,7 @@ void Flanger::processAudio (AudioBuffer<float>& buffer)
         const auto delayTypeIndex = (int) *delayTypeParam;
         if (delayTypeIndex != prevDelayTypeIndex)
         {
-            for (auto& delaySet : cleanDelay)
-                for (auto& delay : delaySet)
-                    delay.reset();
+            cleanDelay.reset();
 
             for (auto& delaySet : lofiDelay)
                 for (auto& delay : delaySet)
@@ -269,9 +324,7 @@ void Flanger::processAudioBypassed (AudioBuffer<float>& buffer)
 {
     if (bypassNeedsReset)
     {
-        for (auto& delaySet : cleanDelay)
-            for (auto& delay : delaySet)
-                delay.reset();
+        cleanDelay.reset();
 
         for (auto& delaySet : lofiDelay)
             for (auto& delay : delaySet)
@@ -5,6 +5,9 @@ namespace
 {
 const String delayTypeTag = "delay_type";
 const String pingPongTag = "ping_pong";
+
+// while the delay time or cutoff are smoothing, the clean delay filter is updated at this rate
+constexpr int smoothingBlockSize = 32;
 } // namespace
 
 DelayModule::DelayModule (UndoManager* um) : BaseProcessor ("Delay", createParameterLayout(), um)
@@ -43,6 +46,16 @@ ParamLayout DelayModule::createParameterLayout()
     return { params.begin(), params.end() };
 }
 
+double DelayModule::getTailLengthSeconds() const
+{
+    // Each repeat is quieter than the last by the feedback gain, so we need enough repeats
+    // for the feedback to decay below the silence threshold. In ping-pong mode, each channel
+    // only repeats every other delay period, so we double the tail length to be safe.
+    const auto feedbackGain = (double) std::pow (feedbackParam->getCurrentValue() * 0.67f, 0.9f);
+    const auto numRepeats = feedbackGain > 0.0 ? std::ceil (std::log ((double) Decibels::decibelsToGain (silenceThresholdDB)) / std::log (feedbackGain)) : 0.0;
+    return 2.0 * (numRepeats + 1.0) * 0.001 * (double) delayTimeMsParam->getCurrentValue();
+}
+
 void DelayModule::prepare (double sampleRate, int samplesPerBlock)
 {
     fs = (float) sampleRate;
@@ -52,7 +65,9 @@ void DelayModule::prepare (double sampleRate, int samplesPerBlock)
     dsp::ProcessSpec monoSpec = stereoSpec;
     monoSpec.numChannels = 1;
 
-    cleanDelayLine.prepare (stereoSpec);
+    // the delay line only needs to be long enough for the longest delay time at the current sample rate
+    const auto maxDelaySamples = (int) std::ceil (sampleRate * 0.001 * (double) delayTimeMsParam->getNormalisableRange().end);
+    cleanDelayLine.prepare (stereoSpec, maxDelaySamples);
     lofiDelayLine.prepare (stereoSpec);
 
     dryWetMixer.prepare (stereoSpec);
@@ -60,8 +75,11 @@ void DelayModule::prepare (double sampleRate, int samplesPerBlock)
     dryWetMixerMono.prepare (monoSpec);
     dryWetMixerMono.setMixingRule (dsp::DryWetMixingRule::balanced);
 
+    // start the smoothers at the current parameter values, so the delay doesn't ramp up from zero after every prepare
     delaySmooth.reset (sampleRate, 0.1);
+    delaySmooth.setCurrentAndTargetValue (fs * *delayTimeMsParam * 0.001f);
     freqSmooth.reset (sampleRate, 0.1);
+    freqSmooth.setCurrentAndTargetValue (*freqParam);
 
     feedbackSmoothBuffer.prepare (sampleRate, samplesPerBlock);
     feedbackSmoothBuffer.setRampLength (0.01);
@@ -75,6 +93,64 @@ void DelayModule::releaseMemory()
     lofiDelayLine.free();
 }
 
+template <typename ProcessFunc>
+void DelayModule::processCleanDelayBlocks (int numChannels, int numSamples, ProcessFunc&& processBlock)
+{
+    auto& lpf = cleanDelayLine.lpf;
+    auto& delayLine = cleanDelayLine.delay;
+    auto& delayOutBuffer = cleanDelayLine.outputBuffer;
+
+    const auto isSmoothing = delaySmooth.isSmoothing() || freqSmooth.isSmoothing();
+    auto* delaySamples = cleanDelayLine.delaySamplesData.data();
+    auto minDelaySamples = delaySmooth.getTargetValue();
+    if (isSmoothing)
+    {
+        for (int n = 0; n < numSamples; ++n)
+            delaySamples[n] = delaySmooth.getNextValue();
+        minDelaySamples = FloatVectorOperations::findMinimum (delaySamples, numSamples);
+    }
+    else
+    {
+        lpf.setCutoffFrequency (freqSmooth.getTargetValue());
+    }
+
+    // The delay line is read in blocks that are shorter than the delay time, so each block
+    // only reads samples that were written by the previous blocks. Delays that are too short
+    // for that (less than 2 samples) fall back to processing one sample at a time.
+    auto maxBlockSize = BlockDelayLine::getMaxBlockSize (minDelaySamples);
+    if (isSmoothing)
+        maxBlockSize = jmin (maxBlockSize, smoothingBlockSize);
+    maxBlockSize = jmax (maxBlockSize, 1);
+
+    for (int startSample = 0; startSample < numSamples;)
+    {
+        const auto blockSize = jmin (maxBlockSize, numSamples - startSample);
+        if (isSmoothing)
+        {
+            lpf.setCutoffFrequency (freqSmooth.getNextValue());
+            freqSmooth.skip (blockSize - 1);
+        }
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto* y = delayOutBuffer.getWritePointer (ch, startSample);
+            if (isSmoothing)
+                delayLine.read (ch, y, blockSize, delaySamples + startSample);
+            else
+                delayLine.read (ch, y, blockSize, minDelaySamples);
+
+            for (int n = 0; n < blockSize; ++n)
+                y[n] = lpf.processSample (ch, y[n]);
+        }
+
+        // processBlock should write the next block of samples into each channel of the delay line
+        processBlock (startSample, blockSize);
+        delayLine.advance (blockSize);
+
+        startSample += blockSize;
+    }
+}
+
 template <typename DelayType>
 void DelayModule::processMonoStereoDelay (AudioBuffer<float>& buffer, DelayType& delayLine)
 {
@@ -88,7 +164,24 @@ void DelayModule::processMonoStereoDelay (AudioBuffer<float>& buffer, DelayType&
     dryWet.pushDrySamples (block);
 
     const auto* fbData = feedbackSmoothBuffer.getSmoothedBuffer();
-    if (delaySmooth.isSmoothing() || freqSmooth.isSmoothing())
+    if constexpr (std::is_same_v<DelayType, CleanDelayType>)
+    {
+        processCleanDelayBlocks (numChannels,
+                                 numSamples,
+                                 [&] (int startSample, int blockSize)
+                                 {
+                                     for (int ch = 0; ch < numChannels; ++ch)
+                                     {
+                                         auto* x = buffer.getWritePointer (ch, startSample);
+                                         const auto* y = delayLine.outputBuffer.getReadPointer (ch, startSample);
+
+                                         FloatVectorOperations::addWithMultiply (x, y, fbData + startSample, blockSize);
+                                         delayLine.delay.write (ch, x, blockSize);
+                                         FloatVectorOperations::copy (x, y, blockSize);
+                                     }
+                                 });
+    }
+    else if (delaySmooth.isSmoothing() || freqSmooth.isSmoothing())
     {
         if (numChannels == 1)
         {
@@ -176,37 +269,62 @@ void DelayModule::processPingPongDelay (AudioBuffer<float>& buffer, DelayType& d
     auto* dataR = bufferToProcess.getWritePointer (1);
 
     const auto* fbData = feedbackSmoothBuffer.getSmoothedBuffer();
-    auto processSample = [&] (int n)
+    if constexpr (std::is_same_v<DelayType, CleanDelayType>)
+    {
+        processCleanDelayBlocks (2,
+                                 numSamples,
+                                 [&] (int startSample, int blockSize)
+                                 {
+                                     auto* xL = dataL + startSample;
+                                     auto* xR = dataR + startSample;
+                                     const auto* yL = delayLine.outputBuffer.getReadPointer (0, startSample);
+                                     const auto* yR = delayLine.outputBuffer.getReadPointer (1, startSample);
+                                     const auto* fb = fbData + startSample;
+
+                                     FloatVectorOperations::add (xL, xR, blockSize);
+                                     FloatVectorOperations::addWithMultiply (xL, yR, fb, blockSize);
+                                     FloatVectorOperations::multiply (xR, yL, fb, blockSize);
+                                     delayLine.delay.write (0, xL, blockSize);
+                                     delayLine.delay.write (1, xR, blockSize);
+
+                                     FloatVectorOperations::copy (xL, yL, blockSize);
+                                     FloatVectorOperations::copy (xR, yR, blockSize);
+                                 });
+    }
+    else
     {
-        auto yL = delayLine.popSample (0);
-        auto yR = delayLine.popSample (1);
+        auto processSample = [&] (int n)
+        {
+            auto yL = delayLine.popSample (0);
+            auto yR = delayLine.popSample (1);
 
-        auto xL = dataL[n] + dataR[n] + fbData[n] * yR;
-        auto xR = fbData[n] * yL;
+            auto xL = dataL[n] + dataR[n] + fbData[n] * yR;
+            auto xR = fbData[n] * yL;
 
-        delayLine.pushSample (0, xL);
-        delayLine.pushSample (1, xR);
+            delayLine.pushSample (0, xL);
+            delayLine.pushSample (1, xR);
 
-        dataL[n] = yL;
-        dataR[n] = yR;
-    };
+            dataL[n] = yL;
+            dataR[n] = yR;
+        };
 
-    if (delaySmooth.isSmoothing() || freqSmooth.isSmoothing())
-    {
-        for (int n = 0; n < numSamples; ++n)
+        if (delaySmooth.isSmoothing() || freqSmooth.isSmoothing())
         {
-            delayLine.setDelay (delaySmooth.getNextValue());
-            delayLine.setFilterFreq (freqSmooth.getNextValue());
-            processSample (n);
+            for (int n = 0; n < numSamples; ++n)
+            {
+                delayLine.setDelay (delaySmooth.getNextValue());
+                delayLine.setFilterFreq (freqSmooth.getNextValue());
+                processSample (n);
+            }
         }
-    }
-    else
-    {
-        delayLine.setDelay (delaySmooth.getTargetValue());
-        delayLine.setFilterFreq (freqSmooth.getTargetValue());
+        else
+        {
+            delayLine.setDelay (delaySmooth.getTargetValue());
+            delayLine.setFilterFreq (freqSmooth.getTargetValue());
 
-        for (int n = 0; n < numSamples; ++n)
-            processSample (n);
+            for (int n = 0; n < numSamples; ++n)
+                processSample (n);
+        }
     }
 
     dryWetMixer.mixWetSamples (block);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../BaseProcessor.h"
+#include "../BlockDelayLine.h"
 
 class DelayModule : public BaseProcessor
 {
@@ -8,6 +9,8 @@ public:
     explicit DelayModule (UndoManager* um = nullptr);
 
     ProcessorType getProcessorType() const override { return Other; }
+    double getTailLengthSeconds() const override;
+    bool needsOversampling() const override { return false; }
     static ParamLayout createParameterLayout();
 
     void prepare (double sampleRate, int samplesPerBlock) override;
@@ -20,6 +23,8 @@ private:
     void processMonoStereoDelay (AudioBuffer<float>& buffer, DelayType& delayLine);
     template <typename DelayType>
     void processPingPongDelay (AudioBuffer<float>& buffer, DelayType& delayLine);
+    template <typename ProcessFunc>
+    void processCleanDelayBlocks (int numChannels, int numSamples, ProcessFunc&& processBlock);
 
     chowdsp::FloatParameter* delayTimeMsParam = nullptr;
     chowdsp::FloatParameter* freqParam = nullptr;
@@ -33,10 +38,12 @@ private:
 
     struct CleanDelayType
     {
-        void prepare (dsp::ProcessSpec& spec)
+        void prepare (dsp::ProcessSpec& spec, int maxDelaySamples)
         {
             lpf.prepare (spec);
-            delay.prepare (spec);
+            delay.prepare ((int) spec.numChannels, maxDelaySamples);
+            outputBuffer.setSize ((int) spec.numChannels, (int) spec.maximumBlockSize);
+            delaySamplesData.resize ((size_t) spec.maximumBlockSize, 0.0f);
         }
 
         void reset()
@@ -45,14 +52,11 @@ private:
             delay.reset();
         }
 
-        void setDelay (float newDelayInSamples) { delay.setDelay (newDelayInSamples); }
-        void setFilterFreq (float freqHz) { lpf.setCutoffFrequency (freqHz); }
-
-        inline void pushSample (int channel, float sample) { delay.pushSample (channel, sample); }
-        inline float popSample (int channel) { return lpf.processSample (channel, delay.popSample (channel)); }
-
         chowdsp::SVFLowpass<float> lpf;
-        chowdsp::DelayLine<float, chowdsp::DelayLineInterpolationTypes::Lagrange5th> delay { 1 << 20 };
+        BlockDelayLine delay;
+
+        AudioBuffer<float> outputBuffer; // filtered output from the delay line
+        std::vector<float> delaySamplesData; // per-sample delay times, while the delay time is smoothing
     };
     CleanDelayType cleanDelayLine;
 
@@ -7,6 +7,9 @@ const String shiftTag = "shift";
 const String sizeTag = "size";
 const String feedbackTag = "feedback";
 const String mixTag = "mix";
+
+float getSizeMs (float sizeParam) { return 50.0f * std::pow (250.0f / 50.0f, sizeParam); }
+float getDecayMs (float decayParam) { return 1000.0f * std::pow (10000.0f / 1000.0f, decayParam); }
 } // namespace
 
 void ShimmerReverb::ShimmerFDNConfig::prepare (double sampleRate)
@@ -58,6 +61,8 @@ ShimmerReverb::ShimmerReverb (UndoManager* um) : BaseProcessor ("Shimmer Reverb"
     sizeParam.setParameterHandle (getParameterPointer<chowdsp::FloatParameter*> (vts, sizeTag));
     feedbackParam.setParameterHandle (getParameterPointer<chowdsp::FloatParameter*> (vts, feedbackTag));
     loadParameterPointer (mixParam, vts, mixTag);
+    loadParameterPointer (sizeParamHandle, vts, sizeTag);
+    loadParameterPointer (decayParamHandle, vts, feedbackTag);
 
     uiOptions.backgroundColour = Colours::lightgrey;
     uiOptions.powerColour = Colours::darksalmon.darker (0.2f);
@@ -84,24 +89,24 @@ ParamLayout ShimmerReverb::createParameterLayout()
     return { params.begin(), params.end() };
 }
 
+double ShimmerReverb::getTailLengthSeconds() const
+{
+    // The decay time is the time taken for the low frequencies to decay by 60 dB, so decaying
+    // below the silence threshold takes about one and a half times as long. We double it, and
+    // add the longest FDN delay, to leave some space for the pitch-shifter and modulation.
+    return 0.001 * (2.0 * (double) getDecayMs (decayParamHandle->getCurrentValue()) + (double) getSizeMs (sizeParamHandle->getCurrentValue()));
+}
+
 void ShimmerReverb::prepare (double sampleRate, int samplesPerBlock)
 {
     shiftParam.prepare (sampleRate, samplesPerBlock);
     shiftParam.setRampLength (0.05);
 
-    sizeParam.mappingFunction = [] (float x)
-    {
-        const auto delayMs = 50.0f * std::pow (250.0f / 50.0f, x);
-        return delayMs;
-    };
+    sizeParam.mappingFunction = &getSizeMs;
     sizeParam.setRampLength (0.2);
     sizeParam.prepare (sampleRate, samplesPerBlock);
 
-    feedbackParam.mappingFunction = [] (float x)
-    {
-        const auto delayMs = 1000.0f * std::pow (10000.0f / 1000.0f, x);
-        return delayMs;
-    };
+    feedbackParam.mappingFunction = &getDecayMs;
     feedbackParam.setRampLength (0.05);
     feedbackParam.prepare (sampleRate, samplesPerBlock);
 
@@ -8,6 +8,8 @@ public:
     explicit ShimmerReverb (UndoManager* um);
 
     ProcessorType getProcessorType() const override { return Other; }
+    bool needsOversampling() const override { return false; }
+    double getTailLengthSeconds() const override;
     static ParamLayout createParameterLayout();
 
     void prepare (double sampleRate, int samplesPerBlock) override;
@@ -19,6 +21,8 @@ private:
     chowdsp::SmoothedBufferValue<float, ValueSmoothingTypes::Multiplicative> sizeParam;
     chowdsp::SmoothedBufferValue<float, ValueSmoothingTypes::Multiplicative> feedbackParam;
     chowdsp::FloatParameter* mixParam = nullptr;
+    chowdsp::FloatParameter* sizeParamHandle = nullptr;
+    chowdsp::FloatParameter* decayParamHandle = nullptr;
 
     static constexpr int numFDNChannels = 12;
     struct ShimmerFDNConfig : chowdsp::Reverb::DefaultFDNConfig<float, numFDNChannels>
@@ -48,6 +48,14 @@ ParamLayout SmoothReverb::createParameterLayout()
     return { params.begin(), params.end() };
 }
 
+double SmoothReverb::getTailLengthSeconds() const
+{
+    // The decay time is the time taken to decay by 60 dB, so decaying
+    // below the silence threshold takes about one and a half times as long.
+    // We double it to leave some space for the pre-delays and modulation.
+    return 2.0 * 0.001 * (double) decayMsParam->getCurrentValue();
+}
+
 void SmoothReverb::prepare (double sampleRate, int samplesPerBlock)
 {
     auto spec = dsp::ProcessSpec { sampleRate, (uint32_t) samplesPerBlock, 2 };
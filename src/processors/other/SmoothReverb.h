@@ -8,6 +8,7 @@ public:
     explicit SmoothReverb (UndoManager* um);
 
     ProcessorType getProcessorType() const override { return Other; }
+    double getTailLengthSeconds() const override;
     static ParamLayout createParameterLayout();
 
     void prepare (double sampleRate, int samplesPerBlock) override;
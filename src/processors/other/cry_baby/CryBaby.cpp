@@ -13,8 +13,8 @@ const String attackTag = "attack";
 const String releaseTag = "release";
 const String directControlTag = "direct_control";
 
-// this module needs some extra oversampling to help the Newton-Raphson solver converge
-constexpr int oversampleRatio = 2;
+// this module needs to run at a high enough sample rate to help the Newton-Raphson solver converge
+constexpr double targetSampleRate = 88'200.0;
 } // namespace
 
 CryBaby::CryBaby (UndoManager* um)
@@ -87,17 +87,15 @@ void CryBaby::prepare (double sampleRate, int samplesPerBlock)
     audioOutBuffer.setSize (2, samplesPerBlock);
     levelOutBuffer.setSize (1, samplesPerBlock);
 
-    needsOversampling = sampleRate < 88'200.0f;
-    if (needsOversampling)
-    {
-        upsampler.prepare ({ sampleRate, (uint32_t) samplesPerBlock, 2 }, oversampleRatio);
-        downsampler.prepare ({ oversampleRatio * sampleRate, oversampleRatio * (uint32_t) samplesPerBlock, 2 }, oversampleRatio);
-    }
+    // if the chain is already oversampling, we may be able to run the model at a lower rate
+    const auto resampleRatio = getInternalResamplingRatio (sampleRate, targetSampleRate);
+    resampler.prepare (sampleRate, samplesPerBlock, resampleRatio);
 
     ndk_model = std::make_unique<CryBabyNDK>();
-    ndk_model->reset ((needsOversampling ? oversampleRatio : 1.0) * sampleRate);
+    ndk_model->use_pot_table = true; // the wah pot can move on every sub-block, so pre-compute the NDK matrices
+    ndk_model->reset (resampleRatio * sampleRate);
     const auto alpha = (double) alphaSmooth.getCurrentValue();
-    ndk_model->update_pots ({ (1.0 - alpha) * CryBabyNDK::VR1, alpha * CryBabyNDK::VR1 });
+    ndk_model->update_wah_position (alpha);
 
     // pre-buffering
     AudioBuffer<float> buffer (2, samplesPerBlock);
@@ -110,26 +108,40 @@ void CryBaby::prepare (double sampleRate, int samplesPerBlock)
     }
 }
 
-void CryBaby::processBlockNDK (const chowdsp::BufferView<float>& block, int smootherDivide)
+void CryBaby::processBlockNDK (const chowdsp::BufferView<float>& block, double resampleRatio)
 {
-    depthSmooth.process (block.getNumSamples());
+    depthSmooth.process ((int) ((double) block.getNumSamples() / resampleRatio));
     const auto depthSmoothData = depthSmooth.getSmoothedBuffer();
     const auto levelInputData = levelOutBuffer.getReadPointer (0);
 
-    for (auto [ch, n, data] : chowdsp::buffer_iters::sub_blocks<32, true> (block))
+    static constexpr int subBlockSize = 32;
+    const auto numChannels = block.getNumChannels();
+    const auto numSamples = block.getNumSamples();
+    for (int n = 0; n < numSamples; n += subBlockSize)
     {
-        if (ch == 0)
-        {
-            auto targetFreqControl = controlFreqParam->getCurrentValue();
-            if (! directControlParam->get())
-                targetFreqControl += 0.98f * depthSmoothData[n / smootherDivide] * levelInputData[n / smootherDivide];
-            alphaSmooth.process (jlimit (0.0f, 1.0f, targetFreqControl), (int) data.size() / smootherDivide);
+        const auto subBlockLength = jmin (subBlockSize, numSamples - n);
 
-            const auto alpha = (double) alphaSmooth.getCurrentValue();
-            ndk_model->update_pots ({ (1.0 - alpha) * CryBabyNDK::VR1, alpha * CryBabyNDK::VR1 });
+        auto targetFreqControl = controlFreqParam->getCurrentValue();
+        if (! directControlParam->get())
+        {
+            const auto smootherIndex = (int) ((double) n / resampleRatio);
+            targetFreqControl += 0.98f * depthSmoothData[smootherIndex] * levelInputData[smootherIndex];
         }
+        alphaSmooth.process (jlimit (0.0f, 1.0f, targetFreqControl), jmax (1, (int) ((double) subBlockLength / resampleRatio)));
 
-        ndk_model->process (data, ch);
+        const auto alpha = (double) alphaSmooth.getCurrentValue();
+        ndk_model->update_wah_position (alpha);
+
+        if (numChannels == 2)
+        {
+            ndk_model->process_stereo ({ block.getWritePointer (0) + n, (size_t) subBlockLength },
+                                       { block.getWritePointer (1) + n, (size_t) subBlockLength });
+        }
+        else
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+                ndk_model->process ({ block.getWritePointer (ch) + n, (size_t) subBlockLength }, (size_t) ch);
+        }
     }
 }
 
@@ -162,16 +174,9 @@ void CryBaby::processAudio (AudioBuffer<float>& buffer)
 
         dcBlocker.processBlock (buffer);
 
-        if (needsOversampling)
-        {
-            const auto osBufferView = upsampler.process (audioOutBuffer);
-            processBlockNDK (osBufferView, oversampleRatio);
-            downsampler.process (osBufferView, audioOutBuffer);
-        }
-        else
-        {
-            processBlockNDK (audioOutBuffer);
-        }
+        auto& internalBuffer = resampler.processIn (audioOutBuffer);
+        processBlockNDK (internalBuffer, resampler.getRatio());
+        resampler.processOut (internalBuffer, audioOutBuffer);
     }
     else
     {
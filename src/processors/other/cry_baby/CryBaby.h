@@ -1,6 +1,7 @@
 #pragma once
 
 #include "processors/BaseProcessor.h"
+#include "processors/InternalResampler.h"
 
 struct CryBabyNDK;
 class CryBaby : public BaseProcessor
@@ -34,7 +35,7 @@ public:
     static constexpr auto numOutputs = (int) magic_enum::enum_count<OutputPort>();
 
 private:
-    void processBlockNDK (const chowdsp::BufferView<float>& block, int smootherDivide = 1);
+    void processBlockNDK (const chowdsp::BufferView<float>& block, double resampleRatio = 1.0);
 
     chowdsp::FloatParameter* controlFreqParam = nullptr;
     chowdsp::FloatParameter* attackParam = nullptr;
@@ -48,9 +49,7 @@ private:
     chowdsp::FirstOrderHPF<float> dcBlocker;
 
     using AAFilter = chowdsp::EllipticFilter<4>;
-    chowdsp::Upsampler<float, AAFilter> upsampler;
-    chowdsp::Downsampler<float, AAFilter, false> downsampler;
-    bool needsOversampling = false;
+    InternalResampler<AAFilter> resampler;
 
     chowdsp::LevelDetector<float> levelDetector;
 
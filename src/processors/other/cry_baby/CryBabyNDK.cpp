@@ -8,6 +8,7 @@
 JUCE_BEGIN_IGNORE_WARNINGS_MSVC (4459)
 
 #include "CryBabyNDK.h"
+#include "processors/NDKSimdHelpers.h"
 
 namespace
 {
@@ -126,6 +127,11 @@ void CryBabyNDK::reset (T fs)
     K0_mat = Nn_0 * (S0_inv * Nn_0.transpose());
     two_Z_Gx = (T) 2 * (Z.toDenseMatrix() * Gx.toDenseMatrix());
 
+    if (use_pot_table)
+        pot_table.compute (*this, &get_wah_pot_values);
+    else
+        pot_table.clear();
+
     // reset state vectors
     for (size_t ch = 0; ch < MAX_NUM_CHANNELS; ++ch)
     {
@@ -158,6 +164,19 @@ void CryBabyNDK::update_pots (const std::array<T, num_pots>& pot_values)
     K_mat = K0_mat - (Un * (Rv_Q_inv * Un.transpose()));
 }
 
+std::array<CryBabyNDK::T, CryBabyNDK::num_pots> CryBabyNDK::get_wah_pot_values (T position) noexcept
+{
+    return { ((T) 1 - position) * VR1, position * VR1 };
+}
+
+void CryBabyNDK::update_wah_position (T position)
+{
+    if (pot_table.is_ready())
+        pot_table.apply (*this, position, Eigen::Vector<T, num_voltages_constant> { Vcc });
+    else
+        update_pots (get_wah_pot_values (position));
+}
+
 void CryBabyNDK::process (std::span<float> channel_data, size_t ch) noexcept
 {
     Eigen::Vector<T, num_voltages_variable> u_n_var;
@@ -226,4 +245,12 @@ void CryBabyNDK::process (std::span<float> channel_data, size_t ch) noexcept
     }
 }
 
+void CryBabyNDK::process_stereo (std::span<float> left_channel_data, std::span<float> right_channel_data) noexcept
+{
+    ndk_simd::processStereoTwoBJTs<8> (*this,
+                                       { { { Is_Q1, BetaF_Q1, BetaR_Q1, Vt }, { Is_Q2, BetaF_Q2, BetaR_Q2, Vt } } },
+                                       left_channel_data,
+                                       right_channel_data);
+}
+
 JUCE_END_IGNORE_WARNINGS_MSVC
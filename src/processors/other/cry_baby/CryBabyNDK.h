@@ -10,6 +10,7 @@
 
 // START USER INCLUDES
 #include <modules/Eigen/Eigen/Dense>
+#include "processors/NDKPotTable.h"
 // END USER INCLUDES
 
 struct CryBabyNDK
@@ -17,6 +18,7 @@ struct CryBabyNDK
     // START USER ENTRIES
     static constexpr size_t MAX_NUM_CHANNELS = 2;
     static constexpr double VR1 = 100.0e3;
+    bool use_pot_table = false; // if true, reset() pre-computes the NDK matrices over the range of the wah pot
     // END USER ENTRIES
 
     using T = double;
@@ -65,7 +67,19 @@ struct CryBabyNDK
     Eigen::Matrix<T, num_nl_ports, num_nl_ports> K0_mat;
     Eigen::Matrix<T, num_states, num_states> two_Z_Gx;
 
+    // Pre-computed NDK matrices for the wah pot
+    NDKPotTable<num_pots, num_states, num_nl_ports, num_outputs, num_voltages_variable, num_voltages_constant> pot_table;
+
     void reset (T fs);
     void update_pots (const std::array<T, num_pots>& pot_values);
+
+    /** Returns the pot values for a wah pot position in the range [0, 1]. */
+    static std::array<T, num_pots> get_wah_pot_values (T position) noexcept;
+
+    /** Updates the NDK matrices for a wah pot position in the range [0, 1], using the pot table if it has been computed. */
+    void update_wah_position (T position);
     void process (std::span<float> channel_data, size_t channel_index) noexcept;
+
+    /** Processes both channels of a stereo signal at once, using SIMD. */
+    void process_stereo (std::span<float> left_channel_data, std::span<float> right_channel_data) noexcept;
 };
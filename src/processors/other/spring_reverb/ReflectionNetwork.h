@@ -11,8 +11,12 @@ public:
     {
         fs = (float) spec.sampleRate;
 
-        for (auto& d : delays)
-            d.prepare (spec);
+        // the longest delays happen when the reverb size is at its maximum (1)
+        for (size_t i = 0; i < delays.size(); ++i)
+        {
+            delays[i].setMaximumDelayInSamples ((int) std::ceil (baseDelaysSec[i] * fs));
+            delays[i].prepare (spec);
+        }
 
         shelfFilter.reset();
     }
@@ -25,8 +29,6 @@ public:
 
     void setParams (float reverbSize, float t60, float mix, float damping)
     {
-        constexpr float baseDelaysSec[4] = { 0.07f, 0.17f, 0.23f, 0.29f };
-
         float delaySamples alignas (16)[4];
         for (int i = 0; i < 4; ++i)
         {
@@ -67,10 +69,8 @@ public:
 private:
     using VecType = xsimd::batch<float>;
     using ReflectionDelay = chowdsp::DelayLine<float, chowdsp::DelayLineInterpolationTypes::Lagrange3rd>;
-    std::array<ReflectionDelay, 4> delays { ReflectionDelay { 1 << 18 },
-                                            ReflectionDelay { 1 << 18 },
-                                            ReflectionDelay { 1 << 18 },
-                                            ReflectionDelay { 1 << 18 } };
+    std::array<ReflectionDelay, 4> delays;
+    static constexpr float baseDelaysSec[4] = { 0.07f, 0.17f, 0.23f, 0.29f };
 
     VecType feedback {};
     float fs = 48000.0f;
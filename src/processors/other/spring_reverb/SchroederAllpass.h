@@ -8,12 +8,13 @@ class SchroederAllpass
 public:
     SchroederAllpass() = default;
 
-    void prepare (double sampleRate)
+    void prepare (double sampleRate, int maxDelaySamples)
     {
         dsp::ProcessSpec spec { sampleRate, (uint32) 256, 1 };
+        delay.setMaximumDelayInSamples (maxDelaySamples);
         delay.prepare (spec);
 
-        nestedAllpass.prepare (sampleRate);
+        nestedAllpass.prepare (sampleRate, maxDelaySamples);
     }
 
     void reset()
@@ -39,7 +40,7 @@ public:
     }
 
 private:
-    chowdsp::DelayLine<T, chowdsp::DelayLineInterpolationTypes::Thiran> delay { 1 << 18 };
+    chowdsp::DelayLine<T, chowdsp::DelayLineInterpolationTypes::Thiran> delay;
     SchroederAllpass<T, order - 1> nestedAllpass;
     T g = 0.0f;
 
@@ -52,9 +53,10 @@ class SchroederAllpass<T, 1>
 public:
     SchroederAllpass() = default;
 
-    void prepare (double sampleRate)
+    void prepare (double sampleRate, int maxDelaySamples)
     {
         dsp::ProcessSpec spec { sampleRate, (uint32) 256, 1 };
+        delay.setMaximumDelayInSamples (maxDelaySamples);
         delay.prepare (spec);
     }
 
@@ -78,7 +80,7 @@ public:
     }
 
 private:
-    chowdsp::DelayLine<T, chowdsp::DelayLineInterpolationTypes::Thiran> delay { 1 << 18 };
+    chowdsp::DelayLine<T, chowdsp::DelayLineInterpolationTypes::Thiran> delay;
     T g;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SchroederAllpass)
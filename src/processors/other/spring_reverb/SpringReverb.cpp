@@ -5,6 +5,11 @@ namespace
 constexpr int downsampleFactor = 2;
 constexpr double preDelayMs = 2.0;
 
+// delay line lengths, for the largest reverb size (see setParams())
+constexpr float maxSpringDelaySeconds = 0.099f;
+constexpr float maxSpringDelayChaos = 0.07f;
+constexpr float maxAllpassDelayMs = 0.35f + 3.0f;
+
 constexpr float smallShakeSeconds = 0.0005f;
 constexpr float largeShakeSeconds = 0.001f;
 } // namespace
@@ -22,13 +27,15 @@ int SpringReverb::prepareRebuffering (const dsp::ProcessSpec& spec)
     blockSize = upsampledBlockSize / downsampleFactor;
     downsampledBuffer.setSize (2, blockSize);
     dsp::ProcessSpec dsSpec { (double) fs, (uint32) blockSize, 2 };
+    delay.setMaximumDelayInSamples ((int) std::ceil ((1.0f + maxSpringDelayChaos) * (1000.0f + maxSpringDelaySeconds * fs)));
     delay.prepare (dsSpec);
 
     dcBlocker.prepare (dsSpec);
     dcBlocker.setCutoffFrequency (40.0f);
 
+    const auto maxAllpassDelaySamples = (int) std::ceil (maxAllpassDelayMs * 0.001f * fs);
     for (auto& apf : vecAPFs)
-        apf.prepare ((double) fs);
+        apf.prepare ((double) fs, maxAllpassDelaySamples);
 
     lpf.prepare (dsSpec);
 
@@ -46,6 +53,14 @@ int SpringReverb::prepareRebuffering (const dsp::ProcessSpec& spec)
     return upsampledBlockSize;
 }
 
+float SpringReverb::getT60Seconds (float size, float decay) noexcept
+{
+    constexpr float lowT60 = 0.5f;
+    constexpr float highT60 = 4.5f;
+    const auto decayCorr = 0.7f * (1.0f - size * size);
+    return lowT60 * std::pow (highT60 / lowT60, 0.95f * decay - decayCorr);
+}
+
 void SpringReverb::setParams (const Params& params)
 {
     auto msToSamples = [this] (float ms)
@@ -73,13 +88,10 @@ void SpringReverb::setParams (const Params& params)
         shakeCounter = -1;
     }
 
-    constexpr float lowT60 = 0.5f;
-    constexpr float highT60 = 4.5f;
-    const auto decayCorr = 0.7f * (1.0f - params.size * params.size);
-    float t60Seconds = lowT60 * std::pow (highT60 / lowT60, 0.95f * params.decay - decayCorr);
+    const auto t60Seconds = getT60Seconds (params.size, params.decay);
 
-    float delaySamples = 1000.0f + std::pow (params.size * 0.099f, 1.0f) * fs;
-    chaosSmooth.setTargetValue (rand.nextFloat() * delaySamples * 0.07f);
+    float delaySamples = 1000.0f + std::pow (params.size * maxSpringDelaySeconds, 1.0f) * fs;
+    chaosSmooth.setTargetValue (rand.nextFloat() * delaySamples * maxSpringDelayChaos);
     delaySamples += std::pow (params.chaos, 3.0f) * chaosSmooth.skip (blockSize);
     delay.setDelay (delaySamples);
 
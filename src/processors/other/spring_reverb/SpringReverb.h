@@ -21,6 +21,9 @@ public:
 
     void setParams (const Params& params);
 
+    /** Returns the time taken for the reverb to decay by 60 dB, for the given size and decay parameters. */
+    static float getT60Seconds (float size, float decay) noexcept;
+
     int prepareRebuffering (const dsp::ProcessSpec& spec) override;
     void processRebufferedBlock (const chowdsp::BufferView<float>& buffer) override;
 
@@ -32,7 +35,7 @@ private:
     chowdsp::Upsampler<float, AAFilter, false> upsample;
     AudioBuffer<float> downsampledBuffer;
 
-    chowdsp::DelayLine<float, chowdsp::DelayLineInterpolationTypes::Lagrange3rd> delay { 1 << 18 };
+    chowdsp::DelayLine<float, chowdsp::DelayLineInterpolationTypes::Lagrange3rd> delay;
     float feedbackGain = 0.0f;
 
     chowdsp::SVFHighpass<float> dcBlocker;
@@ -36,6 +36,17 @@ ParamLayout SpringReverbProcessor::createParameterLayout()
     return { params.begin(), params.end() };
 }
 
+double SpringReverbProcessor::getTailLengthSeconds() const
+{
+    // Shaking the spring makes a sound without any input, so we can't go to sleep while it's shaking.
+    if (shakeParam->getCurrentValue() > 0.5f)
+        return std::numeric_limits<double>::infinity();
+
+    // Decaying below the silence threshold takes about one and a half times as long as the T60.
+    // We double it to leave some space for the early reflections and the rebuffering.
+    return 2.0 * (double) SpringReverb::getT60Seconds (sizeParam->getCurrentValue(), decayParam->getCurrentValue());
+}
+
 void SpringReverbProcessor::prepare (double sampleRate, int samplesPerBlock)
 {
     dsp::ProcessSpec spec { sampleRate, (uint32) samplesPerBlock, 2 };
@@ -9,6 +9,8 @@ public:
     explicit SpringReverbProcessor (UndoManager* um = nullptr);
 
     ProcessorType getProcessorType() const override { return Other; }
+    bool needsOversampling() const override { return false; }
+    double getTailLengthSeconds() const override;
     static ParamLayout createParameterLayout();
 
     void prepare (double sampleRate, int samplesPerBlock) override;
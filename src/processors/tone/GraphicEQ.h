@@ -8,6 +8,7 @@ public:
     explicit GraphicEQ (UndoManager* um = nullptr);
 
     ProcessorType getProcessorType() const override { return Tone; }
+    bool needsOversampling() const override { return false; }
     static ParamLayout createParameterLayout();
 
     void prepare (double sampleRate, int samplesPerBlock) override;
@@ -21,8 +21,7 @@ const String mixTag = "mix";
 const String gainTag = "gain";
 } // namespace
 
-LofiIrs::LofiIrs (UndoManager* um) : BaseProcessor ("LoFi IRs", createParameterLayout(), um),
-                                     convolution (getSharedConvolutionMessageQueue())
+LofiIrs::LofiIrs (UndoManager* um) : BaseProcessor ("LoFi IRs", createParameterLayout(), um)
 {
     for (const auto& irName : irNames)
     {
@@ -38,6 +37,8 @@ LofiIrs::LofiIrs (UndoManager* um) : BaseProcessor ("LoFi IRs", createParameterL
     loadParameterPointer (mixParam, vts, mixTag);
     loadParameterPointer (gainParam, vts, gainTag);
 
+    parameterChanged (irTag, vts.getRawParameterValue (irTag)->load());
+
     uiOptions.backgroundColour = Colours::darkgrey.brighter (0.15f);
     uiOptions.powerColour = Colours::red.darker (0.1f);
     uiOptions.info.description = "A collection of impulse responses from vintage toys and keyboards.";
@@ -70,17 +71,31 @@ void LofiIrs::parameterChanged (const String& parameterID, float newValue)
     if (parameterID != irTag)
         return;
 
+    // Under host automation, this may be called from the audio thread,
+    // but IRs can only be loaded from the message thread.
+    if (! MessageManager::existsAndIsCurrentThread())
+    {
+        mainThreadAction.call ([this, newValue]
+                               { parameterChanged (irTag, newValue); },
+                               true);
+        return;
+    }
+
     auto irIdx = (int) newValue;
     auto& irData = irMap[irNames[irIdx]];
-    convolution.loadImpulseResponse (irData.first, irData.second, dsp::Convolution::Stereo::yes, dsp::Convolution::Trim::yes, 0);
+    const auto irKey = SharedAssetCache::getBinaryDataKey (irData.first);
+    currentIR = SharedAssetCache::getInstance().getIR (irKey, irData.first, irData.second);
+    jassert (currentIR != nullptr); // built-in IRs should always be valid!
+    convolution.loadIR (currentIR, irKey);
 }
 
 void LofiIrs::prepare (double sampleRate, int samplesPerBlock)
 {
-    dsp::ProcessSpec spec { sampleRate, (uint32) samplesPerBlock, 2 };
-    convolution.prepare (spec);
+    convolution.prepare (sampleRate, samplesPerBlock);
     parameterChanged (irTag, vts.getRawParameterValue (irTag)->load());
 
+    dsp::ProcessSpec spec { sampleRate, (uint32) samplesPerBlock, 2 };
+
     gain.prepare (spec);
     gain.setRampDurationSeconds (0.01);
 
@@ -102,7 +117,7 @@ void LofiIrs::processAudio (AudioBuffer<float>& buffer)
     gain.setGainDecibels (gainParam->getCurrentValue() + makeupGainDB);
 
     dryWet.pushDrySamples (block);
-    convolution.process (context);
+    convolution.process (buffer);
     gain.process (context);
     dryWet.mixWetSamples (block);
 }
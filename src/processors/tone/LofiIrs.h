@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../BaseProcessor.h"
+#include "../SharedAssetCache.h"
+#include "ir_utils/PartitionedConvolution.h"
 
 class LofiIrs : public BaseProcessor, private AudioProcessorValueTreeState::Listener
 {
@@ -9,6 +11,7 @@ public:
     ~LofiIrs() override;
 
     ProcessorType getProcessorType() const override { return Tone; }
+    bool needsOversampling() const override { return false; }
     static ParamLayout createParameterLayout();
 
     void parameterChanged (const String& parameterID, float newValue) override;
@@ -22,8 +25,9 @@ private:
 
     using IRType = std::pair<void*, size_t>;
     std::unordered_map<String, IRType> irMap;
+    SharedAssetCache::AssetPtr<SharedAssetCache::IR> currentIR; // shared with the other instances using the same IR
 
-    dsp::Convolution convolution;
+    PartitionedConvolution convolution;
     dsp::Gain<float> gain;
 
     float makeupGainDB = 0.0f;
@@ -31,5 +35,7 @@ private:
     dsp::DryWetMixer<float> dryWetMixer;
     dsp::DryWetMixer<float> dryWetMixerMono;
 
+    chowdsp::DeferredAction mainThreadAction;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LofiIrs)
 };
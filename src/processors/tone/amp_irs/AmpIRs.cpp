@@ -1,8 +1,7 @@
 #include "AmpIRs.h"
 #include "processors/ParameterHelpers.h"
 
-AmpIRs::AmpIRs (UndoManager* um) : BaseProcessor ("Amp IRs", createParameterLayout(), um),
-                                   convolution (getSharedConvolutionMessageQueue())
+AmpIRs::AmpIRs (UndoManager* um) : BaseProcessor ("Amp IRs", createParameterLayout(), um)
 {
     audioFormatManager.registerBasicFormats();
 
@@ -17,8 +16,11 @@ AmpIRs::AmpIRs (UndoManager* um) : BaseProcessor ("Amp IRs", createParameterLayo
 
     using namespace ParameterHelpers;
     vts.addParameterListener (irTag, this);
+    vts.addParameterListener (minPhaseTag, this);
     loadParameterPointer (mixParam, vts, mixTag);
     loadParameterPointer (gainParam, vts, gainTag);
+    loadParameterPointer (minPhaseParam, vts, minPhaseTag);
+    addPopupMenuParameter (minPhaseTag);
 
     parameterChanged (irTag, vts.getRawParameterValue (irTag)->load());
 
@@ -31,6 +33,7 @@ AmpIRs::AmpIRs (UndoManager* um) : BaseProcessor ("Amp IRs", createParameterLayo
 AmpIRs::~AmpIRs()
 {
     vts.removeParameterListener (irTag, this);
+    vts.removeParameterListener (minPhaseTag, this);
 }
 
 ParamLayout AmpIRs::createParameterLayout()
@@ -45,6 +48,7 @@ ParamLayout AmpIRs::createParameterLayout()
 
     createGainDBParameter (params, gainTag, "Gain", -18.0f, 18.0f, 0.0f);
     createPercentParameter (params, mixTag, "Mix", 1.0f);
+    emplace_param<chowdsp::BoolParameter> (params, minPhaseTag, "Minimum Phase", false);
 
     return { params.begin(), params.end() };
 }
@@ -56,9 +60,27 @@ void AmpIRs::setMakeupGain (float irSampleRate)
 
 void AmpIRs::parameterChanged (const String& parameterID, float newValue)
 {
-    if (parameterID != irTag)
+    if (parameterID != irTag && parameterID != minPhaseTag)
         return;
 
+    // Under host automation, this may be called from the audio thread,
+    // but IRs can only be loaded from the message thread.
+    if (! MessageManager::existsAndIsCurrentThread())
+    {
+        mainThreadAction.call ([this, parameterID, newValue]
+                               { parameterChanged (parameterID, newValue); },
+                               true);
+        return;
+    }
+
+    if (parameterID == minPhaseTag)
+    {
+        // re-prepare the current IR with the new options
+        if (currentIR != nullptr)
+            convolution.loadIR (currentIR, currentIRKey, getPreprocessingOptions());
+        return;
+    }
+
     auto irIdx = (int) newValue;
     if (irIdx >= irNames.size() - 1)
         return;
@@ -71,10 +93,25 @@ void AmpIRs::parameterChanged (const String& parameterID, float newValue)
     irState.name = irNames[irIdx];
     irChangedBroadcaster();
 
+    const auto irKey = SharedAssetCache::getBinaryDataKey (irData.first);
+    auto ir = SharedAssetCache::getInstance().getIR (irKey, irData.first, irData.second);
+    jassert (ir != nullptr); // built-in IRs should always be valid!
     setMakeupGain (96000.0f);
+    loadDecodedIR (std::move (ir), irKey);
+}
+
+void AmpIRs::loadDecodedIR (SharedAssetCache::AssetPtr<SharedAssetCache::IR>&& ir, const String& irKey)
+{
+    currentIR = std::move (ir);
+    currentIRKey = irKey;
+    convolution.loadIR (currentIR, currentIRKey, getPreprocessingOptions());
+}
 
-    ScopedLock sl (irMutex);
-    convolution.loadImpulseResponse (irData.first, irData.second, dsp::Convolution::Stereo::yes, dsp::Convolution::Trim::yes, 0);
+ir_preprocessing::Options AmpIRs::getPreprocessingOptions() const
+{
+    ir_preprocessing::Options options;
+    options.minimumPhase = minPhaseParam->get();
+    return options;
 }
 
 void AmpIRs::prepare (double sampleRate, int samplesPerBlock)
@@ -82,7 +119,7 @@ void AmpIRs::prepare (double sampleRate, int samplesPerBlock)
     fs = (float) sampleRate;
 
     dsp::ProcessSpec spec { sampleRate, (uint32) samplesPerBlock, 2 };
-    convolution.prepare (spec);
+    convolution.prepare (sampleRate, samplesPerBlock);
 
     gain.prepare (spec);
     gain.setRampDurationSeconds (0.01);
@@ -108,7 +145,7 @@ void AmpIRs::processAudio (AudioBuffer<float>& buffer)
     gain.setGainDecibels (gainParam->getCurrentValue() + makeupGainDB.load());
 
     dryWet.pushDrySamples (block);
-    convolution.process (context);
+    convolution.process (buffer);
     gain.process (context);
     dryWet.mixWetSamples (block);
 }
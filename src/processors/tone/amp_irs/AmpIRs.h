@@ -1,6 +1,9 @@
 #pragma once
 
 #include "processors/BaseProcessor.h"
+#include "processors/SharedAssetCache.h"
+#include "processors/tone/ir_utils/PartitionedConvolution.h"
+#include "state/StateAssets.h"
 
 class AmpIRs : public BaseProcessor, private AudioProcessorValueTreeState::Listener
 {
@@ -9,6 +12,7 @@ public:
     ~AmpIRs() override;
 
     ProcessorType getProcessorType() const override { return Tone; }
+    bool needsOversampling() const override { return false; }
     static ParamLayout createParameterLayout();
 
     void parameterChanged (const String& parameterID, float newValue) final;
@@ -23,13 +27,17 @@ public:
     void fromXML (XmlElement* xml, const chowdsp::Version& version, bool loadPosition) override;
 
 private:
+    void loadIRFromAsset (StateAssets::Asset&& irAsset, const String& name, const juce::File& file, Component* associatedComp);
     void loadIRFromCurrentState();
     void setMakeupGain (float irSampleRate);
+    void loadDecodedIR (SharedAssetCache::AssetPtr<SharedAssetCache::IR>&& ir, const String& irKey);
+    ir_preprocessing::Options getPreprocessingOptions() const;
 
     chowdsp::FloatParameter* mixParam = nullptr;
     chowdsp::FloatParameter* gainParam = nullptr;
+    chowdsp::BoolParameter* minPhaseParam = nullptr;
 
-    dsp::Convolution convolution { juce::dsp::Convolution::NonUniform { 256 } };
+    PartitionedConvolution convolution;
     dsp::Gain<float> gain;
     std::atomic<float> makeupGainDB { 0.0f };
 
@@ -49,13 +57,16 @@ private:
         String name {};
         File file {};
         int paramIndex = -1;
-        std::unique_ptr<MemoryBlock> data {};
+        StateAssets::Asset data {};
     };
 
     IRState irState;
-    CriticalSection irMutex;
+    SharedAssetCache::AssetPtr<SharedAssetCache::IR> currentIR; // shared with the other instances using the same IR
+    String currentIRKey;
+    StateAssets stateAssets;
     chowdsp::Broadcaster<void()> irChangedBroadcaster;
     AudioFormatManager audioFormatManager;
+    chowdsp::DeferredAction mainThreadAction;
 
     inline static const StringArray irNames {
         "Fender",
@@ -68,6 +79,7 @@ private:
     inline static const String irTag = "ir";
     inline static const String mixTag = "mix";
     inline static const String gainTag = "gain";
+    inline static const String minPhaseTag = "min_phase";
     inline static const int customIRIndex = irNames.indexOf ("Custom");
 
     friend struct AmpIRsSelector;
@@ -16,31 +16,28 @@ void AmpIRs::loadIRFromStream (std::unique_ptr<InputStream>&& stream, const Stri
     }
 
     MemoryBlock irData;
-    const auto originalStreamPosition = stream->getPosition();
     stream->readIntoMemoryBlock (irData);
-    stream->setPosition (originalStreamPosition);
-    std::unique_ptr<AudioFormatReader> formatReader (audioFormatManager.createReaderFor (std::move (stream)));
+    loadIRFromAsset (stateAssets.addAsset (std::move (irData)), name, file, associatedComp);
+}
 
-    if (formatReader == nullptr)
+void AmpIRs::loadIRFromAsset (StateAssets::Asset&& irAsset, const String& name, const juce::File& file, Component* associatedComp)
+{
+    auto failToLoad = [this, associatedComp] (const String& message)
     {
-        failToLoad ("The following IR file was not valid: " + file.getFullPathName() + " (invalid format)");
-        return;
-    }
-
-    const auto fileLength = static_cast<size_t> (formatReader->lengthInSamples);
-    AudioBuffer<float> resultBuffer { jlimit (1, 2, static_cast<int> (formatReader->numChannels)), static_cast<int> (fileLength) };
+        ErrorMessageView::showErrorMessage ("Unable to load IR!", message, "OK", associatedComp);
+        vts.getParameter (irTag)->setValueNotifyingHost (0.0f);
+    };
 
-    if (! formatReader->read (resultBuffer.getArrayOfWritePointers(),
-                              resultBuffer.getNumChannels(),
-                              0,
-                              resultBuffer.getNumSamples()))
+    const auto irKey = SharedAssetCache::getContentKey (irAsset.hash);
+    auto ir = SharedAssetCache::getInstance().getIR (irKey, irAsset.data, irAsset.size);
+    if (ir == nullptr)
     {
-        failToLoad ("Unable to read data from IR file: " + file.getFullPathName());
+        failToLoad ("The following IR file was not valid: " + file.getFullPathName() + " (invalid format)");
         return;
     }
 
     irState.paramIndex = customIRIndex;
-    irState.data = std::make_unique<MemoryBlock> (std::move (irData));
+    irState.data = std::move (irAsset);
     if (file != File {})
     {
         irState.name = file.getFileNameWithoutExtension();
@@ -55,21 +52,20 @@ void AmpIRs::loadIRFromStream (std::unique_ptr<InputStream>&& stream, const Stri
     irChangedBroadcaster();
     vts.getParameter (irTag)->setValueNotifyingHost (1.0f);
 
-    setMakeupGain ((float) formatReader->sampleRate);
-
-    ScopedLock sl (irMutex);
-    convolution.loadImpulseResponse (std::move (resultBuffer), formatReader->sampleRate, dsp::Convolution::Stereo::yes, dsp::Convolution::Trim::yes, dsp::Convolution::Normalise::yes);
+    setMakeupGain ((float) ir->sampleRate);
+    loadDecodedIR (std::move (ir), irKey);
 }
 
 void AmpIRs::loadIRFromCurrentState()
 {
-    loadIRFromStream (std::make_unique<MemoryInputStream> (*irState.data, true), irState.name, irState.file, nullptr);
+    loadIRFromAsset (StateAssets::Asset { irState.data }, irState.name, irState.file, nullptr);
 }
 
 namespace
 {
 const String irNameTag { "ir_custom_name" };
 const String irDataTag { "ir_custom_data" };
+const String irDataHashTag { "ir_custom_data_hash" };
 const String irFileTag { "ir_custom_file" };
 } // namespace
 
@@ -77,10 +73,13 @@ std::unique_ptr<XmlElement> AmpIRs::toXML()
 {
     auto xml = BaseProcessor::toXML();
 
-    if (irState.data != nullptr)
+    if (irState.data.isValid())
     {
         xml->setAttribute (irNameTag, irState.name);
-        xml->setAttribute (irDataTag, Base64::toBase64 (irState.data->getData(), irState.data->getSize()));
+        if (StateAssets::collectAsset (irState.data))
+            xml->setAttribute (irDataHashTag, StateAssets::hashToString (irState.data.hash));
+        else
+            xml->setAttribute (irDataTag, Base64::toBase64 (irState.data.data, irState.data.size));
         if (irState.file != File {})
             xml->setAttribute (irFileTag, irState.file.getFullPathName());
     }
@@ -95,7 +94,19 @@ void AmpIRs::fromXML (XmlElement* xml, const chowdsp::Version& version, bool loa
     using namespace chowdsp::version_literals;
     if (version >= "1.1.4"_v)
     {
-        if (xml->hasAttribute (irNameTag) && xml->hasAttribute (irDataTag))
+        if (xml->hasAttribute (irNameTag) && xml->hasAttribute (irDataHashTag))
+        {
+            irState.name = xml->getStringAttribute (irNameTag);
+            irState.file = xml->getStringAttribute (irFileTag);
+
+            // the IR data is stored alongside the binary state, so it should already be in the asset store
+            irState.data = stateAssets.getAsset (StateAssets::hashFromString (xml->getStringAttribute (irDataHashTag)));
+            if (irState.data.isValid())
+                loadIRFromCurrentState();
+            else
+                vts.getParameter (irTag)->setValueNotifyingHost (0.0f);
+        }
+        else if (xml->hasAttribute (irNameTag) && xml->hasAttribute (irDataTag))
         {
             irState.name = xml->getStringAttribute (irNameTag);
             irState.file = xml->getStringAttribute (irFileTag);
@@ -106,7 +117,7 @@ void AmpIRs::fromXML (XmlElement* xml, const chowdsp::Version& version, bool loa
             if (! successfulRead)
                 vts.getParameter ("ir")->setValueNotifyingHost (0.0f);
 
-            irState.data = std::make_unique<MemoryBlock> (outStream.getMemoryBlock());
+            irState.data = stateAssets.addAsset (outStream.getMemoryBlock());
             loadIRFromCurrentState();
         }
     }
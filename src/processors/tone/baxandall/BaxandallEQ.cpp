@@ -30,8 +30,7 @@ BaxandallEQ::BaxandallEQ (UndoManager* um) : BaseProcessor ("Baxandall EQ", crea
         "Ra",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdfCircuit)
-                wdfModel.Resa.setResistanceValue (self.value.load());
+            wdfCircuit.Resa.setResistanceValue (self.value.load());
         },
         100.0f,
         2.0e6f);
@@ -40,8 +39,7 @@ BaxandallEQ::BaxandallEQ (UndoManager* um) : BaseProcessor ("Baxandall EQ", crea
         "Rb",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdfCircuit)
-                wdfModel.Resb.setResistanceValue (self.value.load());
+            wdfCircuit.Resb.setResistanceValue (self.value.load());
         },
         100.0f,
         2.0e6f);
@@ -50,8 +48,7 @@ BaxandallEQ::BaxandallEQ (UndoManager* um) : BaseProcessor ("Baxandall EQ", crea
         "Rc",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdfCircuit)
-                wdfModel.Resc.setResistanceValue (self.value.load());
+            wdfCircuit.Resc.setResistanceValue (self.value.load());
         },
         100.0f,
         2.0e6f);
@@ -60,8 +57,7 @@ BaxandallEQ::BaxandallEQ (UndoManager* um) : BaseProcessor ("Baxandall EQ", crea
         "Rd",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdfCircuit)
-                wdfModel.Resd = self.value.load();
+            wdfCircuit.Resd = self.value.load();
         },
         100.0f,
         2.0e6f);
@@ -70,8 +66,7 @@ BaxandallEQ::BaxandallEQ (UndoManager* um) : BaseProcessor ("Baxandall EQ", crea
         "Re",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdfCircuit)
-                wdfModel.Rese = self.value.load();
+            wdfCircuit.Rese = self.value.load();
         },
         100.0f,
         2.0e6f);
@@ -80,8 +75,7 @@ BaxandallEQ::BaxandallEQ (UndoManager* um) : BaseProcessor ("Baxandall EQ", crea
         "RL",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdfCircuit)
-                wdfModel.Rl.setResistanceValue (self.value.load());
+            wdfCircuit.Rl.setResistanceValue (self.value.load());
         },
         100.0f,
         2.0e6f);
@@ -90,8 +84,7 @@ BaxandallEQ::BaxandallEQ (UndoManager* um) : BaseProcessor ("Baxandall EQ", crea
         "Ca",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdfCircuit)
-                wdfModel.Ca.setCapacitanceValue (self.value.load());
+            wdfCircuit.Ca.setCapacitanceValue (self.value.load());
         },
         100.0e-12f,
         100.0e-3f);
@@ -100,8 +93,7 @@ BaxandallEQ::BaxandallEQ (UndoManager* um) : BaseProcessor ("Baxandall EQ", crea
         "Cb",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdfCircuit)
-                wdfModel.Pb_plus_Cb.setCapacitanceValue (self.value.load());
+            wdfCircuit.Pb_plus_Cb.setCapacitanceValue (self.value.load());
         },
         1.0e-12f,
         100.0e-3f);
@@ -110,8 +102,7 @@ BaxandallEQ::BaxandallEQ (UndoManager* um) : BaseProcessor ("Baxandall EQ", crea
         "Cc",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdfCircuit)
-                wdfModel.Pb_minus_Cc.setCapacitanceValue (self.value.load());
+            wdfCircuit.Pb_minus_Cc.setCapacitanceValue (self.value.load());
         },
         1.0e-12f,
         100.0e-3f);
@@ -120,8 +111,7 @@ BaxandallEQ::BaxandallEQ (UndoManager* um) : BaseProcessor ("Baxandall EQ", crea
         "Cd",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdfCircuit)
-                wdfModel.Pt_plus_Resd_Cd.setCapacitanceValue (self.value.load());
+            wdfCircuit.Pt_plus_Resd_Cd.setCapacitanceValue (self.value.load());
         },
         1.0e-12f,
         100.0e-3f);
@@ -130,8 +120,7 @@ BaxandallEQ::BaxandallEQ (UndoManager* um) : BaseProcessor ("Baxandall EQ", crea
         "Ce",
         [this] (const netlist::CircuitQuantity& self)
         {
-            for (auto& wdfModel : wdfCircuit)
-                wdfModel.Pt_minus_Rese_Ce.setCapacitanceValue (self.value.load());
+            wdfCircuit.Pt_minus_Rese_Ce.setCapacitanceValue (self.value.load());
         },
         1.0e-12f,
         100.0e-3f);
@@ -150,44 +139,34 @@ ParamLayout BaxandallEQ::createParameterLayout()
 
 void BaxandallEQ::prepare (double sampleRate, int /*samplesPerBlock*/)
 {
-    for (int ch = 0; ch < 2; ++ch)
-    {
-        wdfCircuit[ch].prepare (sampleRate);
+    wdfCircuit.prepare (sampleRate);
 
-        bassSmooth[ch].reset (sampleRate, 0.05);
-        bassSmooth[ch].setCurrentAndTargetValue (skewParam (*bassParam));
+    bassSmooth.reset (sampleRate, 0.05);
+    bassSmooth.setCurrentAndTargetValue (skewParam (*bassParam));
 
-        trebleSmooth[ch].reset (sampleRate, 0.05);
-        trebleSmooth[ch].setCurrentAndTargetValue (skewParam (*trebleParam));
-    }
+    trebleSmooth.reset (sampleRate, 0.05);
+    trebleSmooth.setCurrentAndTargetValue (skewParam (*trebleParam));
 }
 
 void BaxandallEQ::processAudio (AudioBuffer<float>& buffer)
 {
-    const auto numChannels = buffer.getNumChannels();
-    const auto numSamples = buffer.getNumSamples();
+    bassSmooth.setTargetValue (skewParam (*bassParam));
+    trebleSmooth.setTargetValue (skewParam (*trebleParam));
 
-    for (int ch = 0; ch < numChannels; ++ch)
+    if (bassSmooth.isSmoothing() || trebleSmooth.isSmoothing())
     {
-        bassSmooth[ch].setTargetValue (skewParam (*bassParam));
-        trebleSmooth[ch].setTargetValue (skewParam (*trebleParam));
-
-        auto* x = buffer.getWritePointer (ch);
-        if (bassSmooth[ch].isSmoothing() || trebleSmooth[ch].isSmoothing())
-        {
-            for (int n = 0; n < numSamples; ++n)
-            {
-                wdfCircuit[ch].setParams (bassSmooth[ch].getNextValue(), trebleSmooth[ch].getNextValue());
-                x[n] = wdfCircuit[ch].processSample (x[n]);
-            }
-        }
-        else
-        {
-            wdfCircuit[ch].setParams (bassSmooth[ch].getNextValue(), trebleSmooth[ch].getNextValue());
-
-            for (int n = 0; n < numSamples; ++n)
-                x[n] = wdfCircuit[ch].processSample (x[n]);
-        }
+        wdf_simd::processChannels (buffer,
+                                   [this] (int, wdf_simd::Batch x)
+                                   {
+                                       wdfCircuit.setParams (bassSmooth.getNextValue(), trebleSmooth.getNextValue());
+                                       return wdfCircuit.processSample (x);
+                                   });
+    }
+    else
+    {
+        wdfCircuit.setParams (bassSmooth.getNextValue(), trebleSmooth.getNextValue());
+        wdf_simd::processChannels (buffer, [this] (int, wdf_simd::Batch x)
+                                   { return wdfCircuit.processSample (x); });
     }
 
     buffer.applyGain (Decibels::decibelsToGain (21.0f));
@@ -2,6 +2,7 @@
 
 #include "../../BaseProcessor.h"
 #include "BaxandallWDF.h"
+#include "processors/WDFSimdHelpers.h"
 
 class BaxandallEQ : public BaseProcessor
 {
@@ -18,10 +19,10 @@ private:
     chowdsp::FloatParameter* bassParam = nullptr;
     chowdsp::FloatParameter* trebleParam = nullptr;
 
-    SmoothedValue<float, ValueSmoothingTypes::Linear> bassSmooth[2];
-    SmoothedValue<float, ValueSmoothingTypes::Linear> trebleSmooth[2];
+    SmoothedValue<float, ValueSmoothingTypes::Linear> bassSmooth;
+    SmoothedValue<float, ValueSmoothingTypes::Linear> trebleSmooth;
 
-    BaxandallWDF wdfCircuit[2];
+    BaxandallWDF<wdf_simd::Batch> wdfCircuit;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BaxandallEQ)
 };
@@ -1,6 +1,8 @@
 #include "BaxandallWDF.h"
+#include "processors/WDFSimdHelpers.h"
 
-void BaxandallWDF::prepare (double fs)
+template <typename T>
+void BaxandallWDF<T>::prepare (double fs)
 {
     Ca.prepare ((float) fs);
     Pb_plus_Cb.prepare ((float) fs);
@@ -9,7 +11,8 @@ void BaxandallWDF::prepare (double fs)
     Pt_minus_Rese_Ce.prepare ((float) fs);
 }
 
-void BaxandallWDF::setParams (float bassParam, float trebleParam)
+template <typename T>
+void BaxandallWDF<T>::setParams (float bassParam, float trebleParam)
 {
     {
         chowdsp::wdft::ScopedDeferImpedancePropagation deferImpedance { P1, S2, S3, Pt_plus_Resd_Cd };
@@ -23,3 +26,5 @@ void BaxandallWDF::setParams (float bassParam, float trebleParam)
 
     R.propagateImpedanceChange();
 }
+
+template class BaxandallWDF<wdf_simd::Batch>;
@@ -0,0 +1,168 @@
+#include "IRPreprocessing.h"
+
+namespace ir_preprocessing
+{
+namespace
+{
+    /** Trims any silence from the start of the IR. */
+    AudioBuffer<float> trimLeadingSilence (const AudioBuffer<float>& buffer)
+    {
+        const auto thresholdTrim = Decibels::decibelsToGain (-80.0f);
+        const auto numChannels = buffer.getNumChannels();
+        const auto numSamples = buffer.getNumSamples();
+
+        auto startSample = numSamples;
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            const auto* data = buffer.getReadPointer (ch);
+            const auto* firstAboveThreshold = std::find_if (data, data + numSamples, [thresholdTrim] (auto x)
+                                                            { return std::abs (x) >= thresholdTrim; });
+            startSample = jmin (startSample, (int) std::distance (data, firstAboveThreshold));
+        }
+
+        if (startSample == numSamples)
+            return AudioBuffer<float> { numChannels, 1 }; // the IR is silent!
+
+        AudioBuffer<float> trimmed { numChannels, numSamples - startSample };
+        for (int ch = 0; ch < numChannels; ++ch)
+            trimmed.copyFrom (ch, 0, buffer, ch, startSample, trimmed.getNumSamples());
+
+        return trimmed;
+    }
+
+    AudioBuffer<float> resampleIR (const AudioBuffer<float>& buffer, double irSampleRate, double targetSampleRate)
+    {
+        if (irSampleRate == targetSampleRate)
+            return buffer;
+
+        const auto resampleRatio = irSampleRate / targetSampleRate;
+        const auto resampledSize = roundToInt (jmax (1.0, buffer.getNumSamples() / resampleRatio));
+
+        AudioBuffer<float> original { buffer };
+        MemoryAudioSource memorySource { original, false };
+        ResamplingAudioSource resamplingSource { &memorySource, false, buffer.getNumChannels() };
+        resamplingSource.setResamplingRatio (resampleRatio);
+        resamplingSource.prepareToPlay (resampledSize, irSampleRate);
+
+        AudioBuffer<float> resampled { buffer.getNumChannels(), resampledSize };
+        resamplingSource.getNextAudioBlock ({ &resampled, 0, resampledSize });
+
+        return resampled;
+    }
+
+    /**
+     * Converts the IR to minimum phase (keeping the same magnitude response), using the
+     * real cepstrum. The FFT is zero-padded to reduce time-aliasing in the cepstrum.
+     */
+    void makeMinimumPhase (AudioBuffer<float>& buffer)
+    {
+        using Complex = dsp::Complex<float>;
+
+        const auto numSamples = buffer.getNumSamples();
+        const auto fftSize = nextPowerOfTwo (4 * numSamples);
+        dsp::FFT fft { roundToInt (std::log2 ((double) fftSize)) };
+
+        std::vector<Complex> timeData ((size_t) fftSize);
+        std::vector<Complex> freqData ((size_t) fftSize);
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        {
+            std::fill (timeData.begin(), timeData.end(), Complex {});
+            std::copy (buffer.getReadPointer (ch), buffer.getReadPointer (ch) + numSamples, timeData.begin());
+            fft.perform (timeData.data(), freqData.data(), false);
+
+            // real cepstrum
+            for (auto& x : freqData)
+                x = std::log (jmax (std::abs (x), 1.0e-9f));
+            fft.perform (freqData.data(), timeData.data(), true);
+
+            // fold the anti-causal part of the cepstrum onto the causal part
+            for (int n = 1; n < fftSize / 2; ++n)
+                timeData[(size_t) n] *= 2.0f;
+            std::fill (timeData.begin() + fftSize / 2 + 1, timeData.end(), Complex {});
+
+            fft.perform (timeData.data(), freqData.data(), false);
+            for (auto& x : freqData)
+                x = std::exp (x);
+            fft.perform (freqData.data(), timeData.data(), true);
+
+            auto* data = buffer.getWritePointer (ch);
+            for (int n = 0; n < numSamples; ++n)
+                data[n] = timeData[(size_t) n].real();
+        }
+    }
+
+    /** Truncates the IR once the remaining energy (across all channels) is below the threshold, with a short fade-out. */
+    void truncateTail (AudioBuffer<float>& buffer, float thresholdDB, double sampleRate)
+    {
+        const auto numChannels = buffer.getNumChannels();
+        const auto numSamples = buffer.getNumSamples();
+
+        const auto getEnergy = [&buffer, numChannels] (int n)
+        {
+            auto energy = 0.0;
+            for (int ch = 0; ch < numChannels; ++ch)
+                energy += (double) buffer.getSample (ch, n) * (double) buffer.getSample (ch, n);
+            return energy;
+        };
+
+        auto totalEnergy = 0.0;
+        for (int n = 0; n < numSamples; ++n)
+            totalEnergy += getEnergy (n);
+
+        const auto thresholdEnergy = totalEnergy * std::pow (10.0, (double) thresholdDB / 10.0);
+        auto truncatedLength = numSamples;
+        for (auto tailEnergy = 0.0; truncatedLength > 1; --truncatedLength)
+        {
+            tailEnergy += getEnergy (truncatedLength - 1);
+            if (tailEnergy > thresholdEnergy)
+                break;
+        }
+
+        if (truncatedLength == numSamples)
+            return;
+
+        buffer.setSize (numChannels, truncatedLength, true);
+
+        const auto fadeLength = jmin (truncatedLength / 4, roundToInt (0.002 * sampleRate));
+        if (fadeLength == 0)
+            return;
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            buffer.applyGainRamp (ch, truncatedLength - fadeLength, fadeLength, 1.0f, 0.0f);
+    }
+
+    /** Normalises the IR energy (same as juce::dsp::Convolution). */
+    void normaliseIR (AudioBuffer<float>& buffer)
+    {
+        auto maxSumSquared = 0.0f;
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        {
+            const auto* data = buffer.getReadPointer (ch);
+            maxSumSquared = jmax (maxSumSquared, std::inner_product (data, data + buffer.getNumSamples(), data, 0.0f));
+        }
+
+        if (maxSumSquared < 1.0e-8f)
+            return;
+
+        buffer.applyGain (0.125f / std::sqrt (maxSumSquared));
+    }
+} // namespace
+
+AudioBuffer<float> prepareIR (const SharedAssetCache::IR& ir, double sampleRate, const Options& options)
+{
+    auto irBuffer = resampleIR (trimLeadingSilence (ir.buffer), ir.sampleRate, sampleRate);
+
+    if (options.minimumPhase)
+        makeMinimumPhase (irBuffer);
+
+    truncateTail (irBuffer, options.truncationThresholdDB, sampleRate);
+    normaliseIR (irBuffer);
+
+    return irBuffer;
+}
+
+String getPreparedIRKey (const String& irKey, double sampleRate, const Options& options)
+{
+    return irKey + "|" + String (sampleRate) + (options.minimumPhase ? "|min_phase" : "") + "|" + String (options.truncationThresholdDB);
+}
+} // namespace ir_preprocessing
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "processors/SharedAssetCache.h"
+
+/**
+ * Prepares IRs for convolution at a given sample rate. The pipeline is:
+ * - Trim any silence from the start of the IR
+ * - Resample the IR to the processing sample rate
+ * - (Optionally) convert the IR to minimum phase
+ * - Truncate the tail of the IR, once the remaining energy is below a threshold
+ * - Normalise the IR energy, so that different IRs have a similar level
+ *
+ * The prepared IRs are cached by the convolution engine (see PartitionedConvolution),
+ * so each IR only needs to be prepared once for each sample rate.
+ */
+namespace ir_preprocessing
+{
+struct Options
+{
+    /** Converts the IR to minimum phase, which moves the IR energy as early as possible. */
+    bool minimumPhase = false;
+
+    /** The IR tail is truncated once the remaining energy is this far below the total energy. */
+    float truncationThresholdDB = -60.0f;
+
+    bool operator== (const Options& other) const noexcept
+    {
+        return minimumPhase == other.minimumPhase && truncationThresholdDB == other.truncationThresholdDB;
+    }
+    bool operator!= (const Options& other) const noexcept { return ! (*this == other); }
+};
+
+/** Returns the IR, prepared for processing at the given sample rate. */
+AudioBuffer<float> prepareIR (const SharedAssetCache::IR& ir, double sampleRate, const Options& options);
+
+/** Returns a key that uniquely identifies a prepared variant of an IR (see SharedAssetCache). */
+String getPreparedIRKey (const String& irKey, double sampleRate, const Options& options);
+} // namespace ir_preprocessing
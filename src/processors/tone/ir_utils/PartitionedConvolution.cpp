@@ -0,0 +1,674 @@
+#include "PartitionedConvolution.h"
+
+namespace
+{
+int getFFTOrder (int fftSize)
+{
+    return roundToInt (std::log2 ((double) fftSize));
+}
+
+/** Multiplies two interleaved complex spectra, and adds the result to the accumulator. */
+void multiplyAccumulate (float* accumulator, const float* x, const float* h, int numBins) noexcept
+{
+    for (int k = 0; k < numBins; ++k)
+    {
+        const auto xRe = x[2 * k];
+        const auto xIm = x[2 * k + 1];
+        const auto hRe = h[2 * k];
+        const auto hIm = h[2 * k + 1];
+        accumulator[2 * k] += xRe * hRe - xIm * hIm;
+        accumulator[2 * k + 1] += xRe * hIm + xIm * hRe;
+    }
+}
+} // namespace
+
+//======================================================================
+/**
+ * The IR, prepared for a given sample rate: the reversed head of the IR, and the
+ * spectra of the IR partitions for each stage. Shared between all the engines
+ * using the same IR.
+ */
+struct PartitionedConvolution::IRSpectra
+{
+    struct StageSpectra
+    {
+        int partitionSize = 0;
+        int numPartitions = 0;
+
+        // The first stage starts one partition into the IR, so its output has to be computed
+        // as soon as an input block is finished. The later stages start two partitions in,
+        // which leaves a whole block to compute the output (possibly in the background).
+        bool hasOneBlockDelay = false;
+
+        std::vector<std::vector<float>> channelSpectra; // numPartitions interleaved complex spectra (partitionSize + 1 bins), for each channel
+    };
+
+    std::vector<std::vector<float>> headTaps; // headSize taps in reverse order, for each channel
+    std::vector<StageSpectra> stages;
+
+    static std::shared_ptr<const IRSpectra> create (const SharedAssetCache::IR& ir, double sampleRate, const ir_preprocessing::Options& options)
+    {
+        const auto irBuffer = ir_preprocessing::prepareIR (ir, sampleRate, options);
+        const auto numChannels = irBuffer.getNumChannels();
+        const auto irLength = irBuffer.getNumSamples();
+
+        auto spectra = std::make_shared<IRSpectra>();
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto& taps = spectra->headTaps.emplace_back ((size_t) headSize, 0.0f);
+            for (int n = 0; n < jmin (headSize, irLength); ++n)
+                taps[size_t (headSize - 1 - n)] = irBuffer.getSample (ch, n);
+        }
+
+        // Each stage's partitions are 4x bigger than the previous stage's, and each
+        // stage ends where the next stage can start (two of its partitions in).
+        auto partitionSize = headSize;
+        auto stageStart = headSize;
+        while (stageStart < irLength)
+        {
+            const auto isLastStage = partitionSize >= maxPartitionSize;
+            const auto stageEnd = isLastStage ? irLength : jmin (irLength, 8 * partitionSize);
+
+            auto& stage = spectra->stages.emplace_back();
+            stage.partitionSize = partitionSize;
+            stage.numPartitions = (stageEnd - stageStart + partitionSize - 1) / partitionSize;
+            stage.hasOneBlockDelay = stageStart >= 2 * partitionSize;
+
+            const auto numBins = partitionSize + 1;
+            dsp::FFT fft { getFFTOrder (2 * partitionSize) };
+            std::vector<float> fftData ((size_t) (4 * partitionSize));
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                auto& channelSpectra = stage.channelSpectra.emplace_back ((size_t) (stage.numPartitions * 2 * numBins), 0.0f);
+                for (int p = 0; p < stage.numPartitions; ++p)
+                {
+                    const auto partitionStart = stageStart + p * partitionSize;
+                    const auto partitionLength = jmin (partitionSize, irLength - partitionStart);
+
+                    std::fill (fftData.begin(), fftData.end(), 0.0f);
+                    std::copy (irBuffer.getReadPointer (ch, partitionStart), irBuffer.getReadPointer (ch, partitionStart) + partitionLength, fftData.begin());
+                    fft.performRealOnlyForwardTransform (fftData.data(), true);
+                    std::copy (fftData.begin(), fftData.begin() + 2 * numBins, channelSpectra.begin() + p * 2 * numBins);
+                }
+            }
+
+            stageStart += stage.numPartitions * partitionSize;
+            partitionSize *= 4;
+        }
+
+        return spectra;
+    }
+};
+
+//======================================================================
+/**
+ * One stage of uniformly partitioned (overlap-save) convolution. The input is collected
+ * into blocks of the partition size, and the spectrum of each finished block goes into
+ * a frequency-domain delay line, which is then multiplied with the IR partition spectra
+ * to compute the stage output for the next block.
+ */
+struct PartitionedConvolution::Stage
+{
+    Stage (const IRSpectra::StageSpectra& stageSpectra, bool useWorker)
+        : spectra (stageSpectra),
+          processInBackground (useWorker && stageSpectra.hasOneBlockDelay),
+          partitionSize (stageSpectra.partitionSize),
+          numBins (stageSpectra.partitionSize + 1),
+          fft (getFFTOrder (2 * stageSpectra.partitionSize)),
+          fftData ((size_t) (4 * stageSpectra.partitionSize), 0.0f)
+    {
+        for (auto& state : channels)
+        {
+            state.inputBuffer.resize ((size_t) (2 * partitionSize), 0.0f);
+            state.jobInput.resize ((size_t) (2 * partitionSize), 0.0f);
+            state.delayLine.resize ((size_t) (spectra.numPartitions * 2 * numBins), 0.0f);
+            state.output.resize ((size_t) partitionSize, 0.0f);
+            state.nextOutput.resize ((size_t) partitionSize, 0.0f);
+        }
+    }
+
+    void reset()
+    {
+        jassert (! hasPendingJob());
+        for (auto& state : channels)
+        {
+            std::fill (state.inputBuffer.begin(), state.inputBuffer.end(), 0.0f);
+            std::fill (state.delayLine.begin(), state.delayLine.end(), 0.0f);
+            std::fill (state.output.begin(), state.output.end(), 0.0f);
+            std::fill (state.nextOutput.begin(), state.nextOutput.end(), 0.0f);
+        }
+        inputPosition = 0;
+        delayLineIndex = 0;
+    }
+
+    /** Adds a new input block to the delay line, and computes the output for one channel. */
+    void computeOutput (int channel, const float* inputWindow, float* output) noexcept
+    {
+        auto& state = channels[(size_t) channel];
+        const auto& irSpectra = spectra.channelSpectra[(size_t) jmin (channel, (int) spectra.channelSpectra.size() - 1)];
+
+        // the last two input blocks go into the FFT
+        std::copy (inputWindow, inputWindow + 2 * partitionSize, fftData.begin());
+        std::fill (fftData.begin() + 2 * partitionSize, fftData.end(), 0.0f);
+        fft.performRealOnlyForwardTransform (fftData.data(), true);
+        std::copy (fftData.begin(), fftData.begin() + 2 * numBins, state.delayLine.begin() + delayLineIndex * 2 * numBins);
+
+        std::fill (fftData.begin(), fftData.end(), 0.0f);
+        for (int p = 0; p < spectra.numPartitions; ++p)
+        {
+            const auto delayLineSlot = (delayLineIndex + spectra.numPartitions - p) % spectra.numPartitions;
+            multiplyAccumulate (fftData.data(),
+                                state.delayLine.data() + delayLineSlot * 2 * numBins,
+                                irSpectra.data() + p * 2 * numBins,
+                                numBins);
+        }
+
+        // fill in the negative frequencies for the inverse transform
+        for (int k = 1; k < partitionSize; ++k)
+        {
+            fftData[size_t (2 * (2 * partitionSize - k))] = fftData[size_t (2 * k)];
+            fftData[size_t (2 * (2 * partitionSize - k) + 1)] = -fftData[size_t (2 * k + 1)];
+        }
+        fft.performRealOnlyInverseTransform (fftData.data());
+
+        // overlap-save: only the second half of the output is valid
+        std::copy (fftData.begin() + partitionSize, fftData.begin() + 2 * partitionSize, output);
+    }
+
+    /** Called by the audio thread, once a whole input block has been collected. */
+    void blockFinished (int numChannels, TailWorker& worker);
+
+    /**
+     * Claims a queued job, so that it can be run by the calling thread.
+     * Returns false if the job has already been claimed (or finished) by another thread.
+     */
+    bool tryClaimJob() noexcept
+    {
+        auto expected = JobState::Queued;
+        return jobState.compare_exchange_strong (expected, JobState::Running, std::memory_order_acq_rel);
+    }
+
+    /** Computes the output for the next block, once the job has been claimed (usually by the worker thread). */
+    void runJob() noexcept
+    {
+        for (int ch = 0; ch < numJobChannels; ++ch)
+            computeOutput (ch, channels[(size_t) ch].jobInput.data(), channels[(size_t) ch].nextOutput.data());
+        delayLineIndex = (delayLineIndex + 1) % spectra.numPartitions;
+
+        jobState.store (JobState::Idle, std::memory_order_release);
+    }
+
+    /** Makes sure that the job for this stage is finished, without ever blocking the audio thread. */
+    void waitForJob() noexcept
+    {
+        // The worker has had a whole block to compute the output for the next block, so it should
+        // be finished already, unless we're running faster than real-time (e.g. rendering offline).
+        // If the worker hasn't got to the job yet, we just do it here. If it's in the middle of the
+        // job, it won't be long, so we spin until it's done.
+        for (int spinCount = 0; jobState.load (std::memory_order_acquire) != JobState::Idle; ++spinCount)
+        {
+            if (spinCount >= maxSpinCount && tryClaimJob())
+                runJob();
+        }
+    }
+
+    /** Returns true if the stage has a job that isn't finished yet, or if the worker's queue still refers to the stage. */
+    bool hasPendingJob() const noexcept
+    {
+        return jobState.load (std::memory_order_acquire) != JobState::Idle || numQueuedJobs.load (std::memory_order_acquire) > 0;
+    }
+
+    const IRSpectra::StageSpectra& spectra;
+    const bool processInBackground; // if false, the stage is processed on the audio thread
+    const int partitionSize;
+    const int numBins;
+    dsp::FFT fft;
+    std::vector<float> fftData;
+
+    struct ChannelState
+    {
+        std::vector<float> inputBuffer; // the previous input block, followed by the block that's being collected
+        std::vector<float> jobInput; // the input blocks for the background job
+        std::vector<float> delayLine; // spectra of the previous input blocks
+        std::vector<float> output; // the stage output for the current block
+        std::vector<float> nextOutput; // the stage output for the next block, computed in the background
+    };
+    std::array<ChannelState, 2> channels;
+
+    int inputPosition = 0;
+    int delayLineIndex = 0;
+    int numJobChannels = 0;
+    enum class JobState
+    {
+        Idle,
+        Queued,
+        Running,
+    };
+    std::atomic<JobState> jobState { JobState::Idle };
+    std::atomic<int> numQueuedJobs { 0 }; // entries in the worker's queue that point to this stage
+
+    static constexpr int maxSpinCount = 64;
+
+    JUCE_DECLARE_NON_COPYABLE (Stage)
+};
+
+//======================================================================
+/**
+ * The real-time thread that computes the outputs of the background stages.
+ * A single worker is shared between all the convolution engines.
+ */
+class PartitionedConvolution::TailWorker : public Thread
+{
+public:
+    TailWorker() : Thread ("BYOD Convolution Worker")
+    {
+        startRealtimeThread (RealtimeOptions {});
+    }
+
+    ~TailWorker() override
+    {
+        stopThread (1000);
+    }
+
+    /**
+     * Called by the audio thread(s) to hand a stage over to the worker. The worker polls
+     * the job queue, so the audio thread doesn't need to wake it up (or take any locks
+     * that the worker might be holding).
+     */
+    void addJob (Stage* stage)
+    {
+        {
+            // the queue may be written to from several audio threads, but only for a moment
+            const SpinLock::ScopedLockType writeLock { writeMutex };
+            const auto scopedWrite = jobQueue.write (1);
+            if (scopedWrite.blockSize1 > 0)
+            {
+                stage->numQueuedJobs.fetch_add (1, std::memory_order_acq_rel);
+                jobs[(size_t) scopedWrite.startIndex1] = stage;
+                return;
+            }
+        }
+
+        // the job queue is full, so we'll just have to do the work here!
+        if (stage->tryClaimJob())
+            stage->runJob();
+    }
+
+    void run() override
+    {
+        int idleCount = 0;
+        while (! threadShouldExit())
+        {
+            Stage* stage = nullptr;
+            {
+                const auto scopedRead = jobQueue.read (1);
+                if (scopedRead.blockSize1 > 0)
+                    stage = jobs[(size_t) scopedRead.startIndex1];
+            }
+
+            if (stage != nullptr)
+            {
+                idleCount = 0;
+
+                // the audio thread may have already done the job itself, if it couldn't wait for us
+                if (stage->tryClaimJob())
+                    stage->runJob();
+
+                // after this, the stage might be deleted at any time
+                stage->numQueuedJobs.fetch_sub (1, std::memory_order_acq_rel);
+            }
+            else if (++idleCount > maxSpinCount + maxYieldCount)
+            {
+                // nothing's happened for a while, so poll less often until the next job comes along
+                wait (1);
+            }
+            else if (idleCount > maxSpinCount)
+            {
+                Thread::yield();
+            }
+        }
+    }
+
+private:
+    static constexpr int maxNumJobs = 256;
+    AbstractFifo jobQueue { maxNumJobs };
+    std::array<Stage*, (size_t) maxNumJobs> jobs {};
+    SpinLock writeMutex;
+
+    static constexpr int maxSpinCount = 256;
+    static constexpr int maxYieldCount = 64;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (TailWorker)
+};
+
+void PartitionedConvolution::Stage::blockFinished (int numChannels, TailWorker& worker)
+{
+    inputPosition = 0;
+
+    if (! spectra.hasOneBlockDelay)
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+            computeOutput (ch, channels[(size_t) ch].inputBuffer.data(), channels[(size_t) ch].output.data());
+        delayLineIndex = (delayLineIndex + 1) % spectra.numPartitions;
+    }
+    else
+    {
+        waitForJob();
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto& state = channels[(size_t) ch];
+            std::swap (state.output, state.nextOutput);
+            std::copy (state.inputBuffer.begin(), state.inputBuffer.end(), state.jobInput.begin());
+        }
+
+        numJobChannels = numChannels;
+        jobState.store (JobState::Queued, std::memory_order_release);
+        if (processInBackground)
+            worker.addJob (this);
+        else if (tryClaimJob())
+            runJob();
+    }
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        auto& inputBuffer = channels[(size_t) ch].inputBuffer;
+        std::copy (inputBuffer.begin() + partitionSize, inputBuffer.end(), inputBuffer.begin());
+    }
+}
+
+//======================================================================
+/** The processing state for one IR. */
+struct PartitionedConvolution::Engine
+{
+    Engine (std::shared_ptr<const IRSpectra> irSpectra, const String& key, double fs, int maxNumSamples, const ir_preprocessing::Options& preprocessingOptions)
+        : spectra (std::move (irSpectra)),
+          irKey (key),
+          sampleRate (fs),
+          maxBlockSize (maxNumSamples),
+          options (preprocessingOptions)
+    {
+        for (auto& history : headHistory)
+            history.resize ((size_t) (2 * headSize), 0.0f);
+
+        // If the host blocks are at least as big as a stage's partitions, the audio thread would have to wait
+        // for the worker in (almost) every block, so those stages are better off on the audio thread.
+        for (const auto& stageSpectra : spectra->stages)
+            stages.push_back (std::make_unique<Stage> (stageSpectra, stageSpectra.partitionSize > maxBlockSize));
+    }
+
+    void reset()
+    {
+        for (auto& history : headHistory)
+            std::fill (history.begin(), history.end(), 0.0f);
+        headPosition = 0;
+
+        for (auto& stage : stages)
+            stage->reset();
+    }
+
+    bool hasPendingJobs() const
+    {
+        return std::any_of (stages.begin(), stages.end(), [] (const auto& stage)
+                            { return stage->hasPendingJob(); });
+    }
+
+    /** Processes the input into the output (which may be the same buffer). */
+    void process (const float* const* input, float* const* output, int numChannels, int numSamples, TailWorker& worker)
+    {
+        for (int startSample = 0; startSample < numSamples;)
+        {
+            // process up to the end of the current head block, since all the stage blocks finish on a head block boundary
+            const auto chunkSize = jmin (numSamples - startSample, headSize - headPosition);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                const auto* x = input[ch] + startSample;
+                auto* history = headHistory[(size_t) ch].data();
+                std::copy (x, x + chunkSize, history + headSize + headPosition);
+                for (auto& stage : stages)
+                    std::copy (x, x + chunkSize, stage->channels[(size_t) ch].inputBuffer.begin() + stage->partitionSize + stage->inputPosition);
+
+                // direct convolution for the head of the IR
+                const auto* taps = spectra->headTaps[(size_t) jmin (ch, (int) spectra->headTaps.size() - 1)].data();
+                for (int n = 0; n < chunkSize; ++n)
+                {
+                    const auto* historyPtr = history + headPosition + n + 1;
+                    auto y = 0.0f;
+                    for (int k = 0; k < headSize; ++k)
+                        y += taps[k] * historyPtr[k];
+                    chunkOutput[(size_t) n] = y;
+                }
+
+                for (auto& stage : stages)
+                {
+                    const auto* stageOutput = stage->channels[(size_t) ch].output.data() + stage->inputPosition;
+                    FloatVectorOperations::add (chunkOutput.data(), stageOutput, chunkSize);
+                }
+
+                std::copy (chunkOutput.begin(), chunkOutput.begin() + chunkSize, output[ch] + startSample);
+            }
+
+            headPosition += chunkSize;
+            if (headPosition == headSize)
+            {
+                for (int ch = 0; ch < numChannels; ++ch)
+                {
+                    auto& history = headHistory[(size_t) ch];
+                    std::copy (history.begin() + headSize, history.end(), history.begin());
+                }
+                headPosition = 0;
+            }
+
+            for (auto& stage : stages)
+            {
+                stage->inputPosition += chunkSize;
+                if (stage->inputPosition == stage->partitionSize)
+                    stage->blockFinished (numChannels, worker);
+            }
+
+            startSample += chunkSize;
+        }
+    }
+
+    const std::shared_ptr<const IRSpectra> spectra;
+    const String irKey;
+    const double sampleRate;
+    const int maxBlockSize;
+    const ir_preprocessing::Options options;
+
+    std::array<std::vector<float>, 2> headHistory; // the previous head block, followed by the block that's being collected
+    std::array<float, (size_t) headSize> chunkOutput {};
+    int headPosition = 0;
+
+    std::vector<std::unique_ptr<Stage>> stages;
+
+    JUCE_DECLARE_NON_COPYABLE (Engine)
+};
+
+//======================================================================
+/** State shared between the engine and its background loading jobs, which may outlive the engine. */
+struct PartitionedConvolution::LoaderState
+{
+    ~LoaderState()
+    {
+        delete pendingEngine.exchange (nullptr);
+    }
+
+    std::atomic<Engine*> pendingEngine { nullptr };
+    std::atomic<int> numLoadsInFlight { 0 };
+};
+
+/** A single background thread that's shared between all the convolution engines, for preparing IRs. */
+struct PartitionedConvolution::LoaderThreadPool
+{
+    ~LoaderThreadPool()
+    {
+        pool.removeAllJobs (true, 1000);
+    }
+
+    ThreadPool pool { 1 };
+};
+
+//======================================================================
+PartitionedConvolution::PartitionedConvolution() : loaderState (std::make_shared<LoaderState>())
+{
+}
+
+PartitionedConvolution::~PartitionedConvolution()
+{
+    stopTimer();
+
+    // the worker is shared, so we need to wait for it to finish with our stages before getting rid of them
+    waitForBackgroundJobs();
+    delete retiredEngine.exchange (nullptr);
+}
+
+std::unique_ptr<PartitionedConvolution::Engine> PartitionedConvolution::createEngine (const IRPtr& ir, const String& irKey, double sampleRate, int maxBlockSize, const ir_preprocessing::Options& options)
+{
+    auto spectra = SharedAssetCache::getInstance().getOrCreate<IRSpectra> (ir_preprocessing::getPreparedIRKey (irKey, sampleRate, options),
+                                                                          [&ir, sampleRate, &options]
+                                                                          { return IRSpectra::create (*ir, sampleRate, options); });
+    return std::make_unique<Engine> (std::move (spectra), irKey, sampleRate, maxBlockSize, options);
+}
+
+void PartitionedConvolution::waitForBackgroundJobs()
+{
+    for (const auto* engine : { activeEngine.get(), fadingOutEngine.get(), retiredEngine.load() })
+    {
+        while (engine != nullptr && engine->hasPendingJobs())
+            std::this_thread::yield();
+    }
+}
+
+void PartitionedConvolution::prepare (double sampleRate, int maxBlockSize)
+{
+    // The audio thread isn't running, so we can wait for any IRs that are still
+    // loading, and then swap to the latest one straight away.
+    while (loaderState->numLoadsInFlight.load() > 0)
+        Thread::sleep (1);
+    waitForBackgroundJobs();
+
+    std::unique_ptr<Engine> pendingEngine { loaderState->pendingEngine.exchange (nullptr) };
+    if (pendingEngine != nullptr)
+        activeEngine = std::move (pendingEngine);
+    fadingOutEngine.reset();
+    delete retiredEngine.exchange (nullptr);
+
+    processSampleRate = sampleRate;
+    processMaxBlockSize = maxBlockSize;
+    if (latestIR != nullptr
+        && (activeEngine == nullptr
+            || activeEngine->sampleRate != sampleRate
+            || activeEngine->maxBlockSize != maxBlockSize
+            || activeEngine->irKey != latestIRKey
+            || activeEngine->options != latestOptions))
+        activeEngine = createEngine (latestIR, latestIRKey, sampleRate, maxBlockSize, latestOptions);
+
+    if (activeEngine != nullptr)
+        activeEngine->reset();
+
+    fadeBuffer.setSize (2, maxBlockSize);
+    fadeLengthSamples = jmax (1, (int) (fadeTimeSeconds * sampleRate));
+    fadeSamplesRemaining = 0;
+}
+
+void PartitionedConvolution::loadIR (IRPtr ir, const String& irKey, const ir_preprocessing::Options& options)
+{
+    if (ir == nullptr || (ir == latestIR && irKey == latestIRKey && options == latestOptions))
+        return;
+
+    latestIR = ir;
+    latestIRKey = irKey;
+    latestOptions = options;
+
+    // if we haven't been prepared yet, the IR will be loaded in prepare()
+    if (processSampleRate <= 0.0)
+        return;
+
+    loaderState->numLoadsInFlight.fetch_add (1);
+    loaderThreadPool->pool.addJob (
+        [state = loaderState, ir = std::move (ir), irKey, sampleRate = processSampleRate, maxBlockSize = processMaxBlockSize, options]
+        {
+            // if the audio thread never picked up the previous engine, then it's safe to delete it here
+            auto newEngine = createEngine (ir, irKey, sampleRate, maxBlockSize, options);
+            delete state->pendingEngine.exchange (newEngine.release());
+
+            state->numLoadsInFlight.fetch_sub (1);
+        });
+
+    startTimer (100);
+}
+
+void PartitionedConvolution::timerCallback()
+{
+    // the worker might still be finishing a job for the retired engine
+    if (auto* engine = retiredEngine.load(); engine != nullptr && ! engine->hasPendingJobs())
+        delete retiredEngine.exchange (nullptr);
+
+    if (loaderState->numLoadsInFlight.load() == 0 && loaderState->pendingEngine.load() == nullptr && retiredEngine.load() == nullptr)
+        stopTimer();
+}
+
+void PartitionedConvolution::updateEngineForBlock (int numSamples, int numChannels)
+{
+    // wait until the last swap has finished, and the message thread has reclaimed the old engine
+    if (fadingOutEngine != nullptr || retiredEngine.load() != nullptr)
+        return;
+
+    auto* newEngine = loaderState->pendingEngine.exchange (nullptr);
+    if (newEngine == nullptr)
+        return;
+
+    // engines that were loaded before the last call to prepare() should have been picked up there
+    jassert (newEngine->sampleRate == processSampleRate);
+
+    fadingOutEngine = std::exchange (activeEngine, std::unique_ptr<Engine> { newEngine });
+    if (fadingOutEngine == nullptr)
+        return;
+
+    fadeSamplesRemaining = fadeLengthSamples;
+    if (numSamples > fadeBuffer.getNumSamples() || numChannels > fadeBuffer.getNumChannels())
+    {
+        // the host has sent us a larger block than we were prepared for, so we can't crossfade this time
+        jassertfalse;
+        retiredEngine.store (fadingOutEngine.release());
+        fadeSamplesRemaining = 0;
+    }
+}
+
+void PartitionedConvolution::process (AudioBuffer<float>& buffer)
+{
+    const auto numChannels = jmin (buffer.getNumChannels(), 2);
+    const auto numSamples = buffer.getNumSamples();
+    updateEngineForBlock (numSamples, numChannels);
+
+    if (activeEngine == nullptr)
+        return; // no IR has been loaded yet
+
+    // run the outgoing engine first, since the active engine processes the buffer in-place
+    if (fadingOutEngine != nullptr)
+        fadingOutEngine->process (buffer.getArrayOfReadPointers(), fadeBuffer.getArrayOfWritePointers(), numChannels, numSamples, tailWorker.getObject());
+
+    activeEngine->process (buffer.getArrayOfReadPointers(), buffer.getArrayOfWritePointers(), numChannels, numSamples, tailWorker.getObject());
+
+    if (fadingOutEngine != nullptr)
+    {
+        const auto numFadeSamples = jmin (numSamples, fadeSamplesRemaining);
+        const auto fadeStartSample = fadeLengthSamples - fadeSamplesRemaining;
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto* newData = buffer.getWritePointer (ch);
+            const auto* oldData = fadeBuffer.getReadPointer (ch);
+            for (int n = 0; n < numFadeSamples; ++n)
+            {
+                const auto fadeGain = (float) (fadeStartSample + n + 1) / (float) fadeLengthSamples;
+                newData[n] = oldData[n] + fadeGain * (newData[n] - oldData[n]);
+            }
+        }
+
+        fadeSamplesRemaining -= numFadeSamples;
+        if (fadeSamplesRemaining == 0)
+            retiredEngine.store (fadingOutEngine.release());
+    }
+}
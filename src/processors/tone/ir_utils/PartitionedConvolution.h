@@ -0,0 +1,86 @@
+#pragma once
+
+#include "IRPreprocessing.h"
+
+/**
+ * A zero-latency, non-uniformly partitioned convolution engine, for the IR modules.
+ *
+ * The first few samples of the IR are convolved directly (in the time domain), and
+ * the rest of the IR is split into FFT partitions that get bigger towards the tail:
+ * - The smallest partitions are processed on the audio thread.
+ * - The partitions that are larger than the host block size are processed on a real-time
+ *   worker thread (shared between all the engines), which has a whole partition's worth
+ *   of time to finish before the audio thread needs the result (if the worker falls
+ *   behind, e.g. when rendering offline, the audio thread does the work itself).
+ *   The audio thread only uses atomics to hand jobs to the worker, and never waits on a lock.
+ *
+ * New IRs are prepared on a background thread (see ir_preprocessing), and then handed
+ * over to the audio thread with an atomic pointer swap, and crossfaded in. The prepared
+ * IR spectra are shared between all the engines using the same IR at the same sample
+ * rate (with the same preprocessing options).
+ */
+class PartitionedConvolution : private Timer
+{
+public:
+    using IRPtr = SharedAssetCache::AssetPtr<SharedAssetCache::IR>;
+
+    PartitionedConvolution();
+    ~PartitionedConvolution() override;
+
+    /**
+     * Prepares the engine to process at the given sample rate. If an IR has already
+     * been loaded, it is prepared straight away, so that it is ready for the first block.
+     */
+    void prepare (double sampleRate, int maxBlockSize);
+
+    /**
+     * Loads a new IR. The key should uniquely identify the IR data (see SharedAssetCache).
+     * Once the engine has been prepared, the IR is prepared on a background thread, and
+     * then crossfaded in by the audio thread.
+     */
+    void loadIR (IRPtr ir, const String& irKey, const ir_preprocessing::Options& options = {});
+
+    /** Processes a mono or stereo buffer in-place. */
+    void process (AudioBuffer<float>& buffer);
+
+    /** Size of the directly-convolved head of the IR, and of the smallest FFT partitions. */
+    static constexpr int headSize = 64;
+
+    /** Size of the largest FFT partitions. */
+    static constexpr int maxPartitionSize = 4096;
+
+private:
+    struct IRSpectra;
+    struct Stage;
+    struct Engine;
+    struct LoaderState;
+    struct LoaderThreadPool;
+    class TailWorker;
+
+    static std::unique_ptr<Engine> createEngine (const IRPtr& ir, const String& irKey, double sampleRate, int maxBlockSize, const ir_preprocessing::Options& options);
+    void updateEngineForBlock (int numSamples, int numChannels);
+    void waitForBackgroundJobs();
+    void timerCallback() override;
+
+    double processSampleRate = 0.0;
+    int processMaxBlockSize = 0;
+    IRPtr latestIR;
+    String latestIRKey;
+    ir_preprocessing::Options latestOptions;
+
+    SharedResourcePointer<TailWorker> tailWorker;
+    std::shared_ptr<LoaderState> loaderState;
+    SharedResourcePointer<LoaderThreadPool> loaderThreadPool;
+
+    // audio thread state
+    std::unique_ptr<Engine> activeEngine;
+    std::unique_ptr<Engine> fadingOutEngine;
+    std::atomic<Engine*> retiredEngine { nullptr };
+    AudioBuffer<float> fadeBuffer;
+    int fadeLengthSamples = 1;
+    int fadeSamplesRemaining = 0;
+
+    static constexpr double fadeTimeSeconds = 0.05;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PartitionedConvolution)
+};
@@ -38,6 +38,9 @@ public:
         filter.processBlock (buffer);
     }
 
+    /** Returns the filter, e.g. for including its state in a steady-state snapshot. */
+    auto& getFilter() noexcept { return filter; }
+
 private:
     chowdsp::FloatParameter* freqHzParam = nullptr;
     chowdsp::SVFHighpass<float> filter;
@@ -30,12 +30,8 @@ ParamLayout Mixer::createParameterLayout()
 
 void Mixer::prepare (double sampleRate, int samplesPerBlock)
 {
-    dsp::ProcessSpec spec { sampleRate, (uint32) samplesPerBlock, 2 };
     for (auto& gain : gains)
-    {
-        gain.prepare (spec);
-        gain.setRampDurationSeconds (0.01);
-    }
+        gain.reset (sampleRate, 0.01);
 
     monoBuffer.setSize (1, samplesPerBlock);
     stereoBuffer.setSize (2, samplesPerBlock);
@@ -47,14 +43,14 @@ void Mixer::processAudio (AudioBuffer<float>& buffer)
     int numInputsProcessed = 0;
     for (int i = 0; i < numIns; ++i)
     {
-        gains[i].setGainDecibels (*gainDBParams[i]);
+        gains[i].setTargetValue (Decibels::decibelsToGain (gainDBParams[i]->get()));
 
         if (! inputsConnected.contains (i))
             continue;
 
         numInputsProcessed++;
 
-        auto& inBuffer = getInputBufferNonConst (i);
+        const auto& inBuffer = getInputBuffer (i);
         int numChannels = inBuffer.getNumChannels();
         int numSamples = inBuffer.getNumSamples();
 
@@ -75,14 +71,29 @@ void Mixer::processAudio (AudioBuffer<float>& buffer)
                 outBuffer->copyFrom (ch, 0, monoBuffer, 0, 0, numSamples);
         }
 
-        dsp::AudioBlock<float> block (inBuffer);
-        dsp::ProcessContextReplacing<float> ctx (block);
-        gains[i].process (ctx);
-
-        for (int ch = 0; ch < outBuffer->getNumChannels(); ++ch)
+        // the input buffer may be shared with other processors, so we apply the gain while mixing
+        const auto numOutChannels = outBuffer->getNumChannels();
+        if (! gains[i].isSmoothing())
+        {
+            for (int ch = 0; ch < numOutChannels; ++ch)
+            {
+                int sourceCh = numChannels == 1 ? 0 : ch;
+                outBuffer->addFrom (ch, 0, inBuffer, sourceCh, 0, numSamples, gains[i].getTargetValue());
+            }
+        }
+        else
         {
-            int sourceCh = numChannels == 1 ? 0 : ch;
-            outBuffer->addFrom (ch, 0, inBuffer, sourceCh, 0, numSamples);
+            auto* const* outData = outBuffer->getArrayOfWritePointers();
+            const auto* const* inData = inBuffer.getArrayOfReadPointers();
+            for (int n = 0; n < numSamples; ++n)
+            {
+                const auto gain = gains[i].getNextValue();
+                for (int ch = 0; ch < numOutChannels; ++ch)
+                {
+                    int sourceCh = numChannels == 1 ? 0 : ch;
+                    outData[ch][n] += gain * inData[sourceCh][n];
+                }
+            }
         }
     }
 
@@ -108,8 +119,9 @@ void Mixer::processAudioBypassed (AudioBuffer<float>& buffer)
     {
         if (inputsConnected.contains (i))
         {
-            auto& inBuffer = getInputBufferNonConst (i);
-            outputBuffers.getReference (0) = &inBuffer;
+            if (const auto& inBuffer = getInputBuffer (i); &inBuffer != &buffer)
+                buffer.makeCopyOf (inBuffer, true);
+            outputBuffers.getReference (0) = &buffer;
             return;
         }
     }
@@ -27,7 +27,7 @@ public:
 
 private:
     std::array<chowdsp::FloatParameter*, numIns> gainDBParams { nullptr };
-    std::array<dsp::Gain<float>, numIns> gains;
+    std::array<SmoothedValue<float>, numIns> gains;
 
     AudioBuffer<float> monoBuffer;
     AudioBuffer<float> stereoBuffer;
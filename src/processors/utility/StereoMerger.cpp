@@ -42,17 +42,12 @@ void StereoMerger::processAudio (AudioBuffer<float>& buffer)
     stereoBuffer.setSize (2, numSamples, false, false, true);
     stereoBuffer.clear();
 
-    auto makeBufferMono = [numSamples] (AudioBuffer<float>& b)
+    // the input buffers may be shared with other processors, so we mix them down to mono while adding them to the output
+    auto addMonoSum = [numSamples] (AudioBuffer<float>& outBuffer, int outChannel, const AudioBuffer<float>& inBuffer, float gain)
     {
-        const auto nChannels = b.getNumChannels();
-
-        if (nChannels == 1)
-            return;
-
-        for (int ch = 1; ch < nChannels; ++ch)
-            b.addFrom (0, 0, b, ch, 0, numSamples);
-
-        b.applyGain (1.0f / (float) nChannels);
+        const auto nChannels = inBuffer.getNumChannels();
+        for (int ch = 0; ch < nChannels; ++ch)
+            outBuffer.addFrom (outChannel, 0, inBuffer, ch, 0, numSamples, gain / (float) nChannels);
     };
 
     bool isInput0Connected = inputsConnected.contains (LeftChannel);
@@ -68,28 +63,25 @@ void StereoMerger::processAudio (AudioBuffer<float>& buffer)
 
     if (isInput0Connected)
     {
-        auto& inBuffer = getInputBufferNonConst (LeftChannel);
-        makeBufferMono (inBuffer);
+        const auto& inBuffer = getInputBuffer (LeftChannel);
 
-        stereoBuffer.addFrom (0, 0, inBuffer, 0, 0, numSamples);
+        addMonoSum (stereoBuffer, 0, inBuffer, 1.0f);
         if (! isLeftRight)
-            stereoBuffer.addFrom (1, 0, inBuffer, 0, 0, numSamples);
+            addMonoSum (stereoBuffer, 1, inBuffer, 1.0f);
     }
 
     if (isInput1Connected)
     {
-        auto& inBuffer = getInputBufferNonConst (RightChannel);
-        makeBufferMono (inBuffer);
+        const auto& inBuffer = getInputBuffer (RightChannel);
 
         if (isLeftRight)
         {
-            stereoBuffer.addFrom (1, 0, inBuffer, 0, 0, numSamples);
+            addMonoSum (stereoBuffer, 1, inBuffer, 1.0f);
         }
         else
         {
-            stereoBuffer.addFrom (0, 0, inBuffer, 0, 0, numSamples);
-            inBuffer.applyGain (-1.0f);
-            stereoBuffer.addFrom (1, 0, inBuffer, 0, 0, numSamples);
+            addMonoSum (stereoBuffer, 0, inBuffer, 1.0f);
+            addMonoSum (stereoBuffer, 1, inBuffer, -1.0f);
         }
     }
 
@@ -0,0 +1,110 @@
+#include "StateAssets.h"
+
+struct StateAssets::Store
+{
+    struct Entry
+    {
+        std::weak_ptr<const void> owner;
+        const void* data = nullptr;
+        size_t size = 0;
+    };
+
+    Asset add (const std::shared_ptr<const void>& owner, const void* data, size_t size)
+    {
+        const auto hash = computeHash (data, size);
+
+        const ScopedLock sl (lock);
+        if (auto existingAsset = get (hash); existingAsset.isValid())
+        {
+            // the same contents are already being used somewhere, so let's share them
+            if (existingAsset.size == size && std::memcmp (existingAsset.data, data, size) == 0)
+                return existingAsset;
+
+            jassertfalse; // hash collision!
+        }
+
+        // clean up any assets that are no longer being used
+        for (auto iter = entries.begin(); iter != entries.end();)
+            iter = iter->second.owner.expired() ? entries.erase (iter) : std::next (iter);
+
+        entries[hash] = { owner, data, size };
+        return { owner, data, size, hash };
+    }
+
+    Asset get (uint64_t hash) const
+    {
+        const ScopedLock sl (lock);
+        const auto entryIter = entries.find (hash);
+        if (entryIter == entries.end())
+            return {};
+
+        auto owner = entryIter->second.owner.lock();
+        if (owner == nullptr)
+            return {};
+
+        return { std::move (owner), entryIter->second.data, entryIter->second.size, hash };
+    }
+
+    CriticalSection lock;
+    std::unordered_map<uint64_t, Entry> entries;
+};
+
+namespace
+{
+thread_local StateAssets::ScopedAssetCollector* activeCollector = nullptr;
+} // namespace
+
+StateAssets::Asset StateAssets::addAsset (MemoryBlock&& data)
+{
+    auto owner = std::make_shared<const MemoryBlock> (std::move (data));
+    return store->add (owner, owner->getData(), owner->getSize());
+}
+
+StateAssets::Asset StateAssets::addAssetView (const std::shared_ptr<const void>& owner, const void* data, size_t size)
+{
+    // give each asset its own reference count, so that the store can tell when it is no longer in use
+    std::shared_ptr<const void> assetOwner { data, [owner] (const void*) {} };
+    return store->add (assetOwner, data, size);
+}
+
+StateAssets::Asset StateAssets::getAsset (uint64_t hash) const
+{
+    return store->get (hash);
+}
+
+uint64_t StateAssets::computeHash (const void* data, size_t size) noexcept
+{
+    // 64-bit FNV-1a: this needs to be stable between platforms and plugin versions,
+    // since the hashes are stored as part of the plugin state.
+    auto hash = (uint64_t) 0xcbf29ce484222325;
+    const auto* bytes = static_cast<const uint8_t*> (data);
+    for (size_t i = 0; i < size; ++i)
+        hash = (hash ^ bytes[i]) * (uint64_t) 0x100000001b3;
+
+    return hash;
+}
+
+StateAssets::ScopedAssetCollector::ScopedAssetCollector (std::vector<Asset>& assetsToCollectInto)
+    : assets (assetsToCollectInto),
+      previousCollector (activeCollector)
+{
+    activeCollector = this;
+}
+
+StateAssets::ScopedAssetCollector::~ScopedAssetCollector()
+{
+    activeCollector = previousCollector;
+}
+
+bool StateAssets::collectAsset (const Asset& asset)
+{
+    if (activeCollector == nullptr || ! asset.isValid())
+        return false;
+
+    auto& assets = activeCollector->assets;
+    if (std::none_of (assets.begin(), assets.end(), [&asset] (const Asset& a)
+                      { return a.hash == asset.hash; }))
+        assets.push_back (asset);
+
+    return true;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <pch.h>
+
+/**
+ * Content-addressed storage for the large binary assets in the plugin state
+ * (custom IR files, neural network weights, etc.).
+ *
+ * Assets are identified by a hash of their contents, and are shared between
+ * all the plugin instances in the process, so each asset is only held in memory
+ * once, and only written once into a binary state chunk.
+ */
+class StateAssets
+{
+public:
+    StateAssets() = default;
+
+    /** A read-only view of an asset's contents, which keeps the underlying memory alive. */
+    struct Asset
+    {
+        std::shared_ptr<const void> owner {};
+        const void* data = nullptr;
+        size_t size = 0;
+        uint64_t hash = 0;
+
+        [[nodiscard]] bool isValid() const noexcept { return data != nullptr; }
+        [[nodiscard]] std::string_view toStringView() const noexcept { return { static_cast<const char*> (data), size }; }
+        [[nodiscard]] std::unique_ptr<InputStream> createInputStream() const { return std::make_unique<MemoryInputStream> (data, size, false); }
+    };
+
+    /** Adds an asset to the store (or returns the existing asset, if the same contents are already stored). */
+    Asset addAsset (MemoryBlock&& data);
+
+    /**
+     * Adds an asset to the store without copying it. The asset will keep the owner alive
+     * for as long as the asset is in use.
+     */
+    Asset addAssetView (const std::shared_ptr<const void>& owner, const void* data, size_t size);
+
+    /** Returns the asset with the given hash, or an invalid asset if it is not in the store. */
+    [[nodiscard]] Asset getAsset (uint64_t hash) const;
+
+    static uint64_t computeHash (const void* data, size_t size) noexcept;
+    static String hashToString (uint64_t hash) { return String::toHexString ((int64) hash); }
+    static uint64_t hashFromString (const String& hashString) { return (uint64_t) hashString.getHexValue64(); }
+
+    /**
+     * While one of these is in scope, processors on this thread should reference their assets
+     * by hash (see collectAsset()), rather than writing the asset data into their XML state.
+     */
+    struct ScopedAssetCollector
+    {
+        explicit ScopedAssetCollector (std::vector<Asset>& assetsToCollectInto);
+        ~ScopedAssetCollector();
+
+        std::vector<Asset>& assets;
+        ScopedAssetCollector* previousCollector;
+
+        JUCE_DECLARE_NON_COPYABLE (ScopedAssetCollector)
+    };
+
+    /**
+     * If a ScopedAssetCollector is active on this thread, this adds the asset
+     * to the collector and returns true. Otherwise the caller should write the
+     * asset data inline (e.g. for presets that need to be self-contained).
+     */
+    static bool collectAsset (const Asset& asset);
+
+private:
+    struct Store;
+    SharedResourcePointer<Store> store;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (StateAssets)
+};
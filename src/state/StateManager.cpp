@@ -5,7 +5,23 @@
 namespace
 {
 const Identifier statePluginVersionTag = "state_plugin_version";
+
+/**
+ * Binary state chunk layout (all integers are little-endian):
+ * - Header: magic number, schema version, number of assets, XML size
+ * - Asset table: content hash and size for each asset
+ * - XML state (UTF-8), with the assets referenced by hash
+ * - Asset data, each aligned to binaryStateAlignment bytes
+ */
+constexpr uint32_t binaryStateMagic = 0x53444f42; // "BODS"
+constexpr uint32_t binaryStateSchemaVersion = 1;
+constexpr size_t binaryStateAlignment = 16;
+
+size_t getAlignedSize (size_t size)
+{
+    return (size + binaryStateAlignment - 1) & ~(binaryStateAlignment - 1);
 }
+} // namespace
 
 StateManager::StateManager (AudioProcessorValueTreeState& vtState, ProcessorChain& procs, chowdsp::PresetManager& presetMgr)
     : vts (vtState),
@@ -73,3 +89,110 @@ void StateManager::loadState (XmlElement* xmlState)
     if (auto* um = vts.undoManager)
         um->clearUndoHistory();
 }
+
+void StateManager::saveBinaryState (MemoryBlock& destData)
+{
+    std::vector<StateAssets::Asset> assets;
+    std::unique_ptr<XmlElement> xml;
+    {
+        StateAssets::ScopedAssetCollector assetCollector { assets };
+        xml = saveState();
+    }
+
+    const auto xmlString = xml->toString (XmlElement::TextFormat().singleLine().withoutHeader());
+    const auto xmlSize = xmlString.getNumBytesAsUTF8();
+
+    MemoryOutputStream stream { destData, false };
+    stream.writeInt ((int) binaryStateMagic);
+    stream.writeInt ((int) binaryStateSchemaVersion);
+    stream.writeInt ((int) assets.size());
+    stream.writeInt64 ((int64) xmlSize);
+    for (const auto& asset : assets)
+    {
+        stream.writeInt64 ((int64) asset.hash);
+        stream.writeInt64 ((int64) asset.size);
+    }
+
+    stream.write (xmlString.toRawUTF8(), xmlSize);
+
+    for (const auto& asset : assets)
+    {
+        stream.writeRepeatedByte (0, getAlignedSize ((size_t) stream.getPosition()) - (size_t) stream.getPosition());
+        stream.write (asset.data, asset.size);
+    }
+}
+
+bool StateManager::loadBinaryState (const void* data, int sizeInBytes)
+{
+    // If the state can't be read, we return false, so that the caller can fall back to loading the XML state.
+    constexpr auto headerSize = 3 * sizeof (uint32_t) + sizeof (uint64_t);
+    constexpr auto assetTableEntrySize = 2 * sizeof (uint64_t);
+    if (data == nullptr || sizeInBytes < (int) headerSize)
+        return false;
+
+    const auto dataSize = (size_t) sizeInBytes;
+    MemoryInputStream headerStream { data, dataSize, false };
+    if ((uint32_t) headerStream.readInt() != binaryStateMagic)
+        return false;
+
+    if ((uint32_t) headerStream.readInt() > binaryStateSchemaVersion)
+    {
+        jassertfalse; // state was saved by a newer version of the plugin!
+        return false;
+    }
+
+    // check each size against the remaining data before adding them up, so the offsets can't overflow
+    const auto numAssets = (size_t) (uint32_t) headerStream.readInt();
+    const auto xmlSize = (uint64_t) headerStream.readInt64();
+    if (numAssets > (dataSize - headerSize) / assetTableEntrySize
+        || xmlSize > (uint64_t) (dataSize - headerSize - numAssets * assetTableEntrySize))
+    {
+        jassertfalse; // invalid state
+        return false;
+    }
+
+    // The host only guarantees that the data is valid for the duration of this call, so we
+    // copy it once, and then the assets just point into our copy.
+    auto stateData = std::make_shared<const MemoryBlock> (data, dataSize);
+    const auto* stateBytes = static_cast<const char*> (stateData->getData());
+
+    // validate all the assets before adding any of them to the store
+    const auto xmlStart = headerSize + numAssets * assetTableEntrySize;
+    std::vector<std::pair<size_t, size_t>> assetRanges;
+    assetRanges.reserve (numAssets);
+    auto assetOffset = getAlignedSize (xmlStart + (size_t) xmlSize);
+    for (size_t i = 0; i < numAssets; ++i)
+    {
+        const auto assetHash = (uint64_t) headerStream.readInt64();
+        const auto assetSize = (uint64_t) headerStream.readInt64();
+        if (assetOffset > dataSize || assetSize > (uint64_t) (dataSize - assetOffset))
+        {
+            jassertfalse; // invalid state
+            return false;
+        }
+
+        // the XML refers to the assets by hash, so an asset with the wrong contents can't be used
+        if (StateAssets::computeHash (stateBytes + assetOffset, (size_t) assetSize) != assetHash)
+        {
+            jassertfalse; // asset data has been corrupted!
+            return false;
+        }
+
+        assetRanges.emplace_back (assetOffset, (size_t) assetSize);
+        assetOffset = getAlignedSize (assetOffset + (size_t) assetSize);
+    }
+
+    std::vector<StateAssets::Asset> assets;
+    assets.reserve (numAssets);
+    for (const auto& [offset, size] : assetRanges)
+        assets.push_back (stateAssets.addAssetView (stateData, stateBytes + offset, size));
+
+    const auto xml = parseXML (String::fromUTF8 (stateBytes + xmlStart, (int) xmlSize));
+    if (xml == nullptr)
+        return false;
+
+    loadedAssets = std::move (assets);
+    loadState (xml.get());
+
+    return true;
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "StateAssets.h"
 #include "processors/chain/ProcessorChain.h"
 
 class StateManager
@@ -12,6 +13,15 @@ public:
     std::unique_ptr<XmlElement> saveState();
     void loadState (XmlElement* xml);
 
+    /**
+     * Saves the state as a binary chunk, with the large assets (custom IRs, model weights, etc.)
+     * stored as raw data after the XML state, rather than inlined into the XML.
+     */
+    void saveBinaryState (MemoryBlock& destData);
+
+    /** Loads a binary state chunk. Returns false if the data is not a binary state chunk (e.g. an older XML state). */
+    bool loadBinaryState (const void* data, int sizeInBytes);
+
     auto& getUIState() { return uiState; }
 
     static void setCurrentPluginVersionInXML (XmlElement* xml);
@@ -24,5 +34,8 @@ private:
 
     chowdsp::UIState uiState;
 
+    StateAssets stateAssets;
+    std::vector<StateAssets::Asset> loadedAssets; // keeps the assets from the last state alive while it's being loaded
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (StateManager)
 };